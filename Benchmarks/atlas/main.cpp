@@ -0,0 +1,181 @@
+//
+// Created by niek on 11/26/2025.
+//
+
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <GLCore/App.h>
+#include <GLCore/Atlas.h>
+#include <GLCore/SpriteBatch.h>
+#include <gtc/matrix_transform.hpp>
+using namespace GLCore;
+
+/**
+ * kImages procedural sprites of random sizes (8..96 texels):
+ * - packing: PackAtlas / CookAtlas time and occupancy for a few page sizes, gutters and mip-safe levels
+ * - drawing: kSprites random sprites per frame, once from one texture per image and once from the atlas by ID
+ *   (SpriteBatch::Draw(atlas, id, sprite)); reports sprites/sec, End() ms, draw calls and texture binds per frame.
+ */
+class AtlasBench final : public App {
+public:
+    using App::App;
+
+protected:
+    void OnInit() override {
+        std::mt19937 rng(11);
+        std::uniform_int_distribution<int> side(8, 96);
+        for (int i = 0; i < kImages; ++i) {
+            names.push_back("sprite_" + std::to_string(i));
+            images.push_back(MakeImage(i, side(rng), side(rng)));
+        }
+        std::vector<glm::ivec2> sizes;
+        for (const Image& image : images) sizes.emplace_back(image.width, image.height);
+
+        std::cout << "Packing " << kImages << " images\n\n" << std::left << std::setw(24) << "settings" << std::right
+                  << std::setw(8) << "pages" << std::setw(12) << "size" << std::setw(12) << "occupancy" << std::setw(12)
+                  << "pack ms" << std::endl;
+        constexpr AtlasSettings configs[] = {{2048, 0, 1, true}, {2048, 2, 1, true}, {2048, 2, 4, true}, {2048, 4, 6, true},
+                                             {512, 2, 4, true}};
+        for (const AtlasSettings& settings : configs) {
+            AtlasLayout layout;
+            const auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < kPackRuns; ++i) layout = PackAtlas(sizes, settings);
+            const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / kPackRuns;
+            const std::string label = std::to_string(settings.maxSize) + ", gutter " + std::to_string(settings.gutter) + ", mips "
+                                      + std::to_string(settings.mipLevels);
+            std::cout << std::left << std::setw(24) << label << std::right << std::setw(8) << layout.pages << std::setw(12)
+                      << std::to_string(layout.width) + "x" + std::to_string(layout.height) << std::fixed << std::setprecision(1)
+                      << std::setw(11) << layout.Occupancy() * 100.0 << "%" << std::setprecision(3) << std::setw(12) << ms
+                      << std::endl;
+        }
+
+        // Cook and load the default settings; separate textures hold the same images with the same mip count
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / "glcore_atlas_bench.gatlas";
+        auto start = std::chrono::steady_clock::now();
+        CookAtlas(names, images, path.string());
+        const double cookMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        start = std::chrono::steady_clock::now();
+        atlas = std::make_unique<Atlas>(path.string());
+        const double loadMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::filesystem::remove(path);
+
+        for (const std::string& name : names) ids.push_back(atlas->Find(name));
+        for (const Image& image : images) {
+            Texture2DArray& texture = separate.emplace_back(image.width, image.height, 1, GL_SRGB8_ALPHA8, 1);
+            texture.SetSubImage(0, 0, 0, 0, image.width, image.height, 1, GL_RGBA, GL_UNSIGNED_BYTE, image.pixels.data());
+        }
+        std::cout << "\nCookAtlas (pack + mips + write) " << std::fixed << std::setprecision(2) << cookMs << " ms, Atlas load "
+                  << loadMs << " ms, " << atlas->Header().pages << " page(s), "
+                  << static_cast<double>(atlas->Texture().EstimatedBytes()) / (1024.0 * 1024.0) << " MB\n";
+
+        batch = std::make_unique<SpriteBatch>(kSprites);
+        std::uniform_real_distribution<float> x(0.0f, 800.0f), y(0.0f, 600.0f), scale(0.1f, 0.4f);
+        std::uniform_int_distribution<int> image(0, kImages - 1);
+        sprites.resize(kSprites);
+        choices.resize(kSprites);
+        for (std::size_t i = 0; i < kSprites; ++i) {
+            choices[i] = image(rng);
+            const Image& source = images[static_cast<std::size_t>(choices[i])];
+            sprites[i].position = {x(rng), y(rng)};
+            sprites[i].size = glm::vec2(source.width, source.height) * scale(rng);
+        }
+
+        std::cout << "\nDrawing " << kSprites << " sprites/frame over " << kImages << " images, " << kMeasuredFrames
+                  << " frames per scenario\n\n" << std::left << std::setw(12) << "scenario" << std::right << std::setw(16)
+                  << "Msprites/s" << std::setw(14) << "End() ms" << std::setw(12) << "draws" << std::setw(12) << "binds"
+                  << std::endl;
+    }
+
+    void OnShutdown() override {
+        batch.reset();
+        separate.clear();
+        atlas.reset();
+    }
+
+    void OnUpdate() override { }
+
+    void OnRender() override {
+        glClearColor(0.05f, 0.05f, 0.08f, 1.0f);
+        if (scenario >= 2) return;
+
+        const bool useAtlas = scenario == 1;
+        const auto start = std::chrono::steady_clock::now();
+        batch->Begin(glm::ortho(0.0f, 800.0f, 0.0f, 600.0f));
+        for (std::size_t i = 0; i < kSprites; ++i) {
+            const auto image = static_cast<std::size_t>(choices[i]);
+            if (useAtlas) {
+                batch->Draw(*atlas, ids[image], sprites[i]);
+            } else {
+                Sprite s = sprites[i];
+                s.texture = separate[image].ID();
+                batch->Draw(s);
+            }
+        }
+        batch->End();
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        if (++frame <= kWarmupFrames) return;
+        submitMs += ms;
+        endMs += batch->GetStats().cpuMs;
+        if (frame == kWarmupFrames + kMeasuredFrames) {
+            const SpriteBatch::Stats& stats = batch->GetStats();
+            std::cout << std::left << std::setw(12) << (useAtlas ? "atlas" : "separate") << std::right << std::fixed
+                      << std::setprecision(2) << std::setw(16) << kSprites * kMeasuredFrames / (submitMs * 1000.0)
+                      << std::setprecision(3) << std::setw(14) << endMs / kMeasuredFrames
+                      << std::setw(12) << stats.drawCalls << std::setw(12) << stats.textureBinds << std::endl;
+            frame = 0;
+            submitMs = endMs = 0.0;
+            if (++scenario >= 2) GetWindow().RequestClose();
+        }
+    }
+
+private:
+    static constexpr int kImages = 256;
+    static constexpr int kPackRuns = 10;
+    static constexpr std::size_t kSprites = 100000;
+    static constexpr int kWarmupFrames = 20;
+    static constexpr int kMeasuredFrames = 200;
+
+    static Image MakeImage(const int index, const int width, const int height) {
+        Image image{width, height, 4, std::vector<std::uint8_t>(static_cast<std::size_t>(width) * height * 4)};
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                std::uint8_t* p = image.pixels.data() + (static_cast<std::size_t>(y) * width + x) * 4;
+                const bool checker = (x / 4 + y / 4) % 2 == 0;
+                p[0] = static_cast<std::uint8_t>(index * 37);
+                p[1] = static_cast<std::uint8_t>(index * 91);
+                p[2] = checker ? 255 : 64;
+                p[3] = 255;
+            }
+        }
+        return image;
+    }
+
+    std::vector<std::string> names;
+    std::vector<Image> images;
+    std::unique_ptr<Atlas> atlas;
+    std::vector<std::uint32_t> ids;
+    std::vector<Texture2DArray> separate;
+    std::unique_ptr<SpriteBatch> batch;
+    std::vector<Sprite> sprites;
+    std::vector<int> choices;
+
+    int scenario = 0;
+    int frame = 0;
+    double submitMs = 0.0;
+    double endMs = 0.0;
+};
+
+int main() {
+    constexpr AppProperties props{ "Atlas Benchmark", 800, 600, VSyncMode::Off };
+    const std::unique_ptr<AtlasBench> bench = std::make_unique<AtlasBench>(props);
+    bench->Run();
+
+    return 0;
+}
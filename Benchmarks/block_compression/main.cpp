@@ -0,0 +1,166 @@
+//
+// Created by niek on 11/24/2025.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <GLCore/App.h>
+#include <GLCore/BlockCompression.h>
+#include <GLCore/Caps.h>
+#include <GLCore/Texture.h>
+using namespace GLCore;
+
+/**
+ * Block-compresses a procedural kSize x kSize RGBA image (soft photo-like gradients, hard edges, mild noise and an
+ * alpha ramp) in every format and quality on one worker, then BC7 Normal on the shared pool. Reports best-of-kRuns
+ * milliseconds, megapixels per second, PSNR against the source (RGB only for BC1, the channels it keeps for BC4 /
+ * BC5) and the size ratio against RGBA8. Finally uploads the RGBA8 image and every format the driver supports
+ * (timed with glFinish) to show what the smaller footprint buys at upload time.
+ */
+class BlockCompressionBench final : public App {
+public:
+    using App::App;
+
+protected:
+    void OnInit() override {
+        const Image source = MakeImage(kSize);
+        singleWorker = std::make_unique<ThreadPool>(1);
+
+        std::cout << "GL " << Caps::Get().version << " (" << Caps::Get().renderer << ")\n"
+                  << "shared pool: " << ThreadPool::Shared().ThreadCount() << " workers, " << kSize << "x" << kSize
+                  << " RGBA, best of " << kRuns << "\n\n"
+                  << std::left << std::setw(8) << "format" << std::setw(9) << "quality" << std::right << std::setw(9)
+                  << "workers" << std::setw(10) << "ms" << std::setw(10) << "MP/s" << std::setw(10) << "PSNR dB"
+                  << std::setw(8) << "ratio" << std::endl;
+
+        static constexpr BlockFormat kFormats[] = {BlockFormat::BC1, BlockFormat::BC3, BlockFormat::BC4, BlockFormat::BC5, BlockFormat::BC7};
+        static constexpr BlockQuality kQualities[] = {BlockQuality::Fast, BlockQuality::Normal, BlockQuality::High};
+        static constexpr const char* kQualityNames[] = {"fast", "normal", "high"};
+        for (const BlockFormat format : kFormats) {
+            for (int q = 0; q < 3; ++q) {
+                std::vector<std::uint8_t> blocks;
+                const double ms = Time([&] { blocks = CompressImage(source, format, kQualities[q], *singleWorker); });
+                Row(source, format, kQualityNames[q], 1, ms, blocks);
+                if (format == BlockFormat::BC7 && kQualities[q] == BlockQuality::Normal) bc7 = blocks;
+            }
+        }
+
+        std::vector<std::uint8_t> blocks;
+        const double sharedMs = Time([&] { blocks = CompressImage(source, BlockFormat::BC7, BlockQuality::Normal); });
+        Row(source, BlockFormat::BC7, "normal", ThreadPool::Shared().ThreadCount(), sharedMs, blocks);
+
+        // GPU upload of level 0: RGBA8 against each supported compressed format
+        std::cout << "\n" << std::left << std::setw(8) << "upload" << std::right << std::setw(12) << "MB" << std::setw(10)
+                  << "ms" << std::endl;
+        const Texture2D rgba(kSize, kSize, GL_SRGB8_ALPHA8, 1, "BC bench RGBA8");
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        Upload("RGBA8", source.pixels.size(), [&] {
+            rgba.SetSubImage(0, 0, 0, kSize, kSize, GL_RGBA, GL_UNSIGNED_BYTE, source.pixels.data());
+        });
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        for (const BlockFormat format : kFormats) {
+            if (!BlockFormatSupported(format)) {
+                std::cout << std::left << std::setw(8) << ToString(format) << std::right << std::setw(22) << "unsupported" << std::endl;
+                continue;
+            }
+            const std::vector<std::uint8_t> data = format == BlockFormat::BC7 ? bc7 : CompressImage(source, format, BlockQuality::Fast);
+            const Texture2D texture(kSize, kSize, BlockInternalFormat(format, true), 1, "BC bench texture");
+            Upload(ToString(format), data.size(), [&] {
+                texture.SetCompressedSubImage(0, 0, 0, kSize, kSize, data.size(), data.data());
+            });
+        }
+    }
+
+    void OnShutdown() override { }
+    void OnUpdate() override { }
+
+    void OnRender() override {
+        GetWindow().RequestClose();
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr int kSize = 1024;
+    static constexpr int kRuns = 3;
+
+    template<class F>
+    static double Time(F&& run) {
+        double best = 1e30;
+        for (int i = 0; i < kRuns; ++i) {
+            const auto start = Clock::now();
+            run();
+            best = std::min(best, std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+        }
+        return best;
+    }
+
+    static void Row(const Image& source, const BlockFormat format, const char* quality, const unsigned int workers,
+                    const double ms, const std::vector<std::uint8_t>& blocks) {
+        const Image decoded = DecompressImage(blocks, format, source.width, source.height);
+        const double psnr = Psnr(source, decoded, format == BlockFormat::BC1 ? 3 : 0);
+        std::cout << std::left << std::setw(8) << ToString(format) << std::setw(9) << quality << std::right << std::setw(9)
+                  << workers << std::fixed << std::setprecision(2) << std::setw(10) << ms << std::setprecision(1)
+                  << std::setw(10) << static_cast<double>(source.width) * source.height / 1.0e6 / (ms / 1000.0)
+                  << std::setprecision(2) << std::setw(10) << psnr << std::setprecision(1) << std::setw(7)
+                  << static_cast<double>(source.pixels.size()) / static_cast<double>(blocks.size()) << "x" << std::endl;
+    }
+
+    template<class F>
+    static void Upload(const char* name, const std::size_t bytes, F&& upload) {
+        glFinish();
+        const double ms = Time([&] {
+            upload();
+            glFinish();
+        });
+        std::cout << std::left << std::setw(8) << name << std::right << std::fixed << std::setprecision(2) << std::setw(12)
+                  << static_cast<double>(bytes) / (1024.0 * 1024.0) << std::setw(10) << ms << std::endl;
+    }
+
+    // Photo-like content: correlated color gradients, soft blobs, a few hard edges, mild noise and an alpha ramp
+    static Image MakeImage(const int size) {
+        Image image;
+        image.width = image.height = size;
+        image.channels = 4;
+        image.pixels.resize(static_cast<std::size_t>(size) * size * 4);
+        std::uint32_t state = 0x9E3779B9u;
+        for (int y = 0; y < size; ++y) {
+            for (int x = 0; x < size; ++x) {
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                const float u = static_cast<float>(x) / size, v = static_cast<float>(y) / size;
+                const float blob = 0.5f + 0.5f * std::sin(u * 9.0f) * std::cos(v * 7.0f);
+                const float edge = ((x / 96 + y / 128) % 5 == 0) ? 0.35f : 0.0f;
+                const float noise = static_cast<float>(state & 0xF) - 7.5f;
+                const auto channel = [&](const float value) {
+                    return static_cast<std::uint8_t>(std::clamp(value * 255.0f + noise, 0.0f, 255.0f));
+                };
+                std::uint8_t* p = &image.pixels[(static_cast<std::size_t>(y) * size + x) * 4];
+                p[0] = channel(0.2f + 0.6f * blob * u + edge);
+                p[1] = channel(0.15f + 0.5f * blob + 0.2f * v);
+                p[2] = channel(0.1f + 0.4f * (1.0f - blob) * v + edge * 0.5f);
+                p[3] = static_cast<std::uint8_t>(255.0f * std::clamp(1.2f - u, 0.0f, 1.0f));
+            }
+        }
+        return image;
+    }
+
+    std::unique_ptr<ThreadPool> singleWorker;
+    std::vector<std::uint8_t> bc7;
+};
+
+int main() {
+    constexpr AppProperties props{ "Block Compression Benchmark", 800, 600, VSyncMode::Off };
+    const std::unique_ptr<BlockCompressionBench> bench = std::make_unique<BlockCompressionBench>(props);
+    bench->Run();
+
+    return 0;
+}
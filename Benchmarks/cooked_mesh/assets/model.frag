@@ -0,0 +1,8 @@
+#version 330 core
+in vec3 vNormal;
+out vec4 FragColor;
+
+void main() {
+    float light = max(dot(normalize(vNormal), normalize(vec3(0.4, 0.8, 0.5))), 0.0) * 0.8 + 0.2;
+    FragColor = vec4(vec3(light), 1.0);
+}
@@ -0,0 +1,234 @@
+//
+// Created by niek on 11/20/2025.
+//
+
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <GLCore/App.h>
+#include <GLCore/Caps.h>
+#include <GLCore/CookedMesh.h>
+#include <GLCore/GltfLoader.h>
+#include <GLCore/ObjLoader.h>
+#include <GLCore/Shader.h>
+#include <GLCore/VertexArray.h>
+#include <gtc/matrix_transform.hpp>
+using namespace GLCore;
+
+/**
+ * Writes one kSegments x kRings bumpy sphere (~525k vertices) as .obj, .glb and cooked .gmesh (full and packed
+ * vertices, 4 LODs, meshlets), then measures what it costs to get each onto the GPU:
+ * - load: file -> CPU arrays ready to upload (for "+ build", also the LOD chain and meshlets the cooked file carries)
+ * - upload: VertexBuffer + IndexBuffer creation and glFinish
+ * Files are freshly written, so reads hit a warm page cache. Best of kRuns per row; afterwards the cooked mesh is drawn.
+ */
+class CookedMeshBench final : public App {
+public:
+    using App::App;
+
+protected:
+    void OnInit() override {
+        {
+            const MeshData source = BuildBumpySphere(kSegments, kRings);
+            SaveObj(source, "bench_mesh.obj");
+            WriteGlb(source, "bench_mesh.glb");
+            CookMesh(source, "bench_mesh.gmesh", CookSettings{.maxLods = 4});
+            CookMesh(source, "bench_packed.gmesh", CookSettings{.packVertices = true, .maxLods = 4});
+        }
+
+        std::cout << "GL " << Caps::Get().version << " (" << Caps::Get().renderer << ")\n"
+                  << "Best of " << kRuns << " runs per row\n\n"
+                  << std::left << std::setw(20) << "format" << std::right << std::setw(10) << "MB"
+                  << std::setw(11) << "load ms" << std::setw(12) << "upload ms" << std::setw(11) << "total ms" << std::endl;
+
+        Report("obj", "bench_mesh.obj", [](const char* path, Upload& upload) {
+            const MeshData mesh = LoadObj(path);
+            upload.Time([&] { upload.Buffers(mesh.vertices, mesh.indices); });
+        });
+        Report("obj + build", "bench_mesh.obj", [](const char* path, Upload& upload) {
+            MeshData mesh = LoadObj(path);
+            const std::vector<MeshLod> lods = GenerateLods(mesh, LodSettings{.maxLods = 4});
+            const MeshletMesh meshlets = BuildMeshlets(std::span<const std::uint32_t>(mesh.indices.data(), lods[0].indexCount),
+                                                       mesh.vertices.data(), static_cast<std::uint32_t>(mesh.vertices.size()),
+                                                       sizeof(MeshVertex));
+            upload.Time([&] { upload.Buffers(mesh.vertices, mesh.indices); });
+        });
+        Report("glb", "bench_mesh.glb", [](const char* path, Upload& upload) {
+            const GltfModel model = LoadGltf(path);
+            upload.Time([&] { upload.Buffers(model.geometry.vertices, model.geometry.indices); });
+        });
+        Report("gmesh", "bench_mesh.gmesh", [](const char* path, Upload& upload) {
+            const CookedMesh mesh(path);
+            upload.Time([&] { upload.Buffers(mesh.Vertices<MeshVertex>(), mesh.Indices()); });
+        });
+        Report("gmesh (packed)", "bench_packed.gmesh", [](const char* path, Upload& upload) {
+            const CookedMesh mesh(path);
+            upload.Time([&] { upload.Buffers(mesh.Vertices<PackedMeshVertex>(), mesh.Indices()); });
+        });
+
+        cooked = std::make_unique<CookedMesh>("bench_mesh.gmesh");
+        vertices = std::make_unique<VertexBuffer>(cooked->Vertices<MeshVertex>(), BufferUsage::Static, "Cooked vertices");
+        indices = std::make_unique<IndexBuffer>(cooked->Indices(), BufferUsage::Static, "Cooked indices");
+        vao = std::make_unique<VertexArray>("Cooked VAO");
+        vao->SetVertexBuffer(0, *vertices);
+        vao->SetIndexBuffer(*indices);
+        shader = std::make_unique<Shader>("assets/model.vert", "assets/model.frag");
+        glEnable(GL_DEPTH_TEST);
+    }
+
+    void OnShutdown() override {
+        vao.reset();
+        indices.reset();
+        vertices.reset();
+        shader.reset();
+        cooked.reset();
+    }
+
+    void OnUpdate() override { }
+
+    void OnRender() override {
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+        // Cycle through the cooked LOD chain, one level per 15 frames
+        const std::span<const MeshLod> lods = cooked->Lods();
+        const MeshLod& lod = lods[static_cast<std::size_t>(frame / 15) % lods.size()];
+        shader->Bind();
+        shader->SetMat4("uViewProjection", glm::perspective(glm::radians(60.0f), 800.0f / 600.0f, 0.1f, 100.0f)
+                                           * glm::lookAt(glm::vec3(0.0f, 0.5f, 3.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f)));
+        shader->SetMat4("uModel", glm::mat4(1.0f));
+        vao->Bind();
+        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(lod.indexCount), GL_UNSIGNED_INT,
+                       reinterpret_cast<const void*>(static_cast<std::uintptr_t>(lod.firstIndex) * sizeof(std::uint32_t)));
+
+        if (++frame >= kDrawFrames) GetWindow().RequestClose();
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::uint32_t kSegments = 1024;
+    static constexpr std::uint32_t kRings = 512;
+    static constexpr int kRuns = 3;
+    static constexpr int kDrawFrames = 60;
+
+    static double Milliseconds(const Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    /** @brief Times the GPU upload part of a run, so the rest of the run counts as load time. */
+    struct Upload {
+        double ms = 0.0;
+
+        void Time(const std::function<void()>& body) {
+            const auto start = Clock::now();
+            body();
+            glFinish();
+            ms = Milliseconds(start);
+        }
+
+        template<class V, class I>
+        static void Buffers(const V& vertexData, const I& indexData) {
+            const VertexBuffer vbo(vertexData);
+            const IndexBuffer ibo(indexData);
+        }
+    };
+
+    static void Report(const char* name, const char* path, const std::function<void(const char*, Upload&)>& run) {
+        double bestLoad = 0.0, bestUpload = 0.0;
+        for (int r = 0; r < kRuns; ++r) {
+            Upload upload;
+            const auto start = Clock::now();
+            run(path, upload);
+            const double loadMs = Milliseconds(start) - upload.ms;
+            if (r == 0 || loadMs + upload.ms < bestLoad + bestUpload) {
+                bestLoad = loadMs;
+                bestUpload = upload.ms;
+            }
+        }
+
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        std::cout << std::left << std::setw(20) << name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(10) << static_cast<double>(file.tellg()) / (1024.0 * 1024.0) << std::setprecision(2)
+                  << std::setw(11) << bestLoad << std::setw(12) << bestUpload << std::setw(11) << bestLoad + bestUpload << std::endl;
+    }
+
+    static MeshData BuildBumpySphere(const std::uint32_t segments, const std::uint32_t rings) {
+        MeshData mesh;
+        for (std::uint32_t r = 0; r <= rings; ++r) {
+            const float phi = 3.14159265f * static_cast<float>(r) / static_cast<float>(rings);
+            for (std::uint32_t s = 0; s <= segments; ++s) {
+                const float theta = 6.2831853f * static_cast<float>(s) / static_cast<float>(segments);
+                MeshVertex& v = mesh.vertices.emplace_back();
+                v.normal = {std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta)};
+                v.position = v.normal * (1.0f + 0.06f * std::sin(theta * 9.0f) * std::sin(phi * 7.0f));
+                v.uv = {static_cast<float>(s) / static_cast<float>(segments), static_cast<float>(r) / static_cast<float>(rings)};
+            }
+        }
+        for (std::uint32_t r = 0; r < rings; ++r) {
+            for (std::uint32_t s = 0; s < segments; ++s) {
+                const std::uint32_t a = r * (segments + 1) + s, b = a + segments + 1;
+                mesh.indices.insert(mesh.indices.end(), {a, a + 1, b, a + 1, b + 1, b});
+            }
+        }
+        return mesh;
+    }
+
+    // Single-primitive GLB: interleaved MeshVertex view (byteStride 32) + index view
+    static void WriteGlb(const MeshData& mesh, const char* path) {
+        const std::size_t vertexBytes = mesh.vertices.size() * sizeof(MeshVertex);
+        const std::size_t indexBytes = mesh.indices.size() * sizeof(std::uint32_t);
+        std::ostringstream json;
+        json << R"({"asset":{"version":"2.0"},"scene":0,"scenes":[{"nodes":[0]}],"nodes":[{"mesh":0}],)"
+             << R"("meshes":[{"primitives":[{"attributes":{"POSITION":0,"NORMAL":1,"TEXCOORD_0":2},"indices":3}]}],)"
+             << R"("accessors":[)"
+             << R"({"bufferView":0,"byteOffset":0,"componentType":5126,"count":)" << mesh.vertices.size()
+             << R"(,"type":"VEC3","min":[-1.06,-1.06,-1.06],"max":[1.06,1.06,1.06]},)"
+             << R"({"bufferView":0,"byteOffset":12,"componentType":5126,"count":)" << mesh.vertices.size() << R"(,"type":"VEC3"},)"
+             << R"({"bufferView":0,"byteOffset":24,"componentType":5126,"count":)" << mesh.vertices.size() << R"(,"type":"VEC2"},)"
+             << R"({"bufferView":1,"componentType":5125,"count":)" << mesh.indices.size() << R"(,"type":"SCALAR"}],)"
+             << R"("bufferViews":[{"buffer":0,"byteOffset":0,"byteLength":)" << vertexBytes << R"(,"byteStride":32},)"
+             << R"({"buffer":0,"byteOffset":)" << vertexBytes << R"(,"byteLength":)" << indexBytes << "}],"
+             << R"("buffers":[{"byteLength":)" << vertexBytes + indexBytes << "}]}";
+
+        std::string text = json.str();
+        text.resize((text.size() + 3) & ~std::size_t{3}, ' ');
+        const auto u32 = [](std::ofstream& out, const std::uint32_t value) {
+            out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        };
+        std::ofstream glb(path, std::ios::binary);
+        u32(glb, 0x46546C67);
+        u32(glb, 2);
+        u32(glb, static_cast<std::uint32_t>(12 + 8 + text.size() + 8 + vertexBytes + indexBytes));
+        u32(glb, static_cast<std::uint32_t>(text.size()));
+        u32(glb, 0x4E4F534A);
+        glb.write(text.data(), static_cast<std::streamsize>(text.size()));
+        u32(glb, static_cast<std::uint32_t>(vertexBytes + indexBytes));
+        u32(glb, 0x004E4942);
+        glb.write(reinterpret_cast<const char*>(mesh.vertices.data()), static_cast<std::streamsize>(vertexBytes));
+        glb.write(reinterpret_cast<const char*>(mesh.indices.data()), static_cast<std::streamsize>(indexBytes));
+    }
+
+    std::unique_ptr<CookedMesh> cooked;
+    int frame = 0;
+
+    std::unique_ptr<VertexBuffer> vertices;
+    std::unique_ptr<IndexBuffer> indices;
+    std::unique_ptr<VertexArray> vao;
+    std::unique_ptr<Shader> shader;
+};
+
+int main() {
+    constexpr AppProperties props{ "Cooked Mesh Benchmark", 800, 600, VSyncMode::Off };
+    const std::unique_ptr<CookedMeshBench> bench = std::make_unique<CookedMeshBench>(props);
+    bench->Run();
+
+    return 0;
+}
@@ -0,0 +1,217 @@
+//
+// Created by niek on 11/18/2025.
+//
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <GLCore/App.h>
+#include <GLCore/Caps.h>
+#include <GLCore/GltfLoader.h>
+#include <GLCore/Shader.h>
+#include <GLCore/VertexArray.h>
+#include <gtc/matrix_transform.hpp>
+using namespace GLCore;
+
+/**
+ * Writes a kMeshes-mesh test scene (~56 MB of vertex + index data) as .glb and as .gltf + .bin, then loads both
+ * with a single-threaded pool and with the shared pool. Files are freshly written, so reads hit a warm page cache:
+ * the numbers measure parsing and decoding, not the disk.
+ * Reports parse / decode / total ms and MB/s per run, then uploads the model and draws it for a few frames.
+ */
+class GltfLoadBench final : public App {
+public:
+    using App::App;
+
+protected:
+    void OnInit() override {
+        WriteScene();
+
+        std::cout << "GL " << Caps::Get().version << " (" << Caps::Get().renderer << ")\n"
+                  << "Best of " << kRuns << " loads per row\n\n"
+                  << std::left << std::setw(10) << "file" << std::right << std::setw(9) << "threads"
+                  << std::setw(10) << "MB" << std::setw(11) << "parse ms" << std::setw(11) << "decode ms"
+                  << std::setw(11) << "total ms" << std::setw(10) << "MB/s" << std::endl;
+
+        ThreadPool serial(1);
+        for (const char* file : {"bench_scene.glb", "bench_scene.gltf"}) {
+            Report(file, serial, true);
+            Report(file, ThreadPool::Shared(), false);
+        }
+
+        const auto uploadStart = Clock::now();
+        vertices = std::make_unique<VertexBuffer>(model.geometry.vertices, BufferUsage::Static, "glTF vertices");
+        indices = std::make_unique<IndexBuffer>(model.geometry.indices, BufferUsage::Static, "glTF indices");
+        vao = std::make_unique<VertexArray>("glTF VAO");
+        vao->SetVertexBuffer(0, *vertices);
+        vao->SetIndexBuffer(*indices);
+        glFinish();
+        std::cout << "\nGPU upload: " << std::fixed << std::setprecision(2)
+                  << std::chrono::duration<double, std::milli>(Clock::now() - uploadStart).count() << " ms for "
+                  << model.geometry.vertices.size() << " vertices, " << model.geometry.indices.size() << " indices" << std::endl;
+
+        shader = std::make_unique<Shader>("assets/model.vert", "assets/model.frag");
+        glEnable(GL_DEPTH_TEST);
+    }
+
+    void OnShutdown() override {
+        vao.reset();
+        indices.reset();
+        vertices.reset();
+        shader.reset();
+    }
+
+    void OnUpdate() override { }
+
+    void OnRender() override {
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+        const glm::mat4 viewProjection = glm::perspective(glm::radians(60.0f), 800.0f / 600.0f, 0.1f, 200.0f)
+                                         * glm::lookAt(glm::vec3(0.0f, 12.0f, 22.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        shader->Bind();
+        shader->SetMat4("uViewProjection", viewProjection);
+        vao->Bind();
+        for (const GltfNode& node : model.nodes) {
+            if (node.mesh < 0) continue;
+            shader->SetMat4("uModel", node.world);
+            const GltfMesh& mesh = model.meshes[static_cast<std::size_t>(node.mesh)];
+            for (std::uint32_t p = mesh.firstPrimitive; p < mesh.firstPrimitive + mesh.primitiveCount; ++p) {
+                const GltfPrimitive& primitive = model.primitives[p];
+                glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(primitive.indexCount), GL_UNSIGNED_INT,
+                               reinterpret_cast<const void*>(static_cast<std::uintptr_t>(primitive.firstIndex) * sizeof(std::uint32_t)));
+            }
+        }
+
+        if (++frame >= kDrawFrames) GetWindow().RequestClose();
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::uint32_t kMeshes = 32;
+    static constexpr std::uint32_t kSegments = 256;
+    static constexpr std::uint32_t kRings = 128;
+    static constexpr int kRuns = 5;
+    static constexpr int kDrawFrames = 60;
+
+    // Separate position / normal / uv / index views per mesh, like most exporters write them
+    static void WriteScene() {
+        std::vector<float> positions, normals, uvs;
+        std::vector<std::uint32_t> indices;
+        for (std::uint32_t r = 0; r <= kRings; ++r) {
+            const float phi = 3.14159265f * static_cast<float>(r) / static_cast<float>(kRings);
+            for (std::uint32_t s = 0; s <= kSegments; ++s) {
+                const float theta = 6.2831853f * static_cast<float>(s) / static_cast<float>(kSegments);
+                const glm::vec3 normal(std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta));
+                const glm::vec3 position = normal * (1.0f + 0.06f * std::sin(theta * 9.0f) * std::sin(phi * 7.0f));
+                positions.insert(positions.end(), {position.x, position.y, position.z});
+                normals.insert(normals.end(), {normal.x, normal.y, normal.z});
+                uvs.insert(uvs.end(), {static_cast<float>(s) / kSegments, static_cast<float>(r) / kRings});
+            }
+        }
+        for (std::uint32_t r = 0; r < kRings; ++r) {
+            for (std::uint32_t s = 0; s < kSegments; ++s) {
+                const std::uint32_t a = r * (kSegments + 1) + s, b = a + kSegments + 1;
+                indices.insert(indices.end(), {a, a + 1, b, a + 1, b + 1, b});
+            }
+        }
+
+        const std::size_t vertexCount = positions.size() / 3;
+        const std::size_t sizes[4] = {positions.size() * 4, normals.size() * 4, uvs.size() * 4, indices.size() * 4};
+        const void* sources[4] = {positions.data(), normals.data(), uvs.data(), indices.data()};
+        const std::size_t meshBytes = sizes[0] + sizes[1] + sizes[2] + sizes[3];
+
+        std::string binary(meshBytes * kMeshes, '\0');
+        std::ostringstream views, accessors, meshes, nodes;
+        for (std::uint32_t m = 0; m < kMeshes; ++m) {
+            std::size_t offset = m * meshBytes;
+            for (int v = 0; v < 4; ++v) {
+                std::memcpy(binary.data() + offset, sources[v], sizes[v]);
+                views << (m + v ? "," : "") << R"({"buffer":0,"byteOffset":)" << offset << R"(,"byteLength":)" << sizes[v] << "}";
+                offset += sizes[v];
+            }
+            const std::uint32_t first = m * 4;
+            accessors << (m ? "," : "")
+                      << R"({"bufferView":)" << first << R"(,"componentType":5126,"count":)" << vertexCount
+                      << R"(,"type":"VEC3","min":[-1.06,-1.06,-1.06],"max":[1.06,1.06,1.06]},)"
+                      << R"({"bufferView":)" << first + 1 << R"(,"componentType":5126,"count":)" << vertexCount << R"(,"type":"VEC3"},)"
+                      << R"({"bufferView":)" << first + 2 << R"(,"componentType":5126,"count":)" << vertexCount << R"(,"type":"VEC2"},)"
+                      << R"({"bufferView":)" << first + 3 << R"(,"componentType":5125,"count":)" << indices.size() << R"(,"type":"SCALAR"})";
+            meshes << (m ? "," : "") << R"({"name":"sphere)" << m << R"(","primitives":[{"attributes":{"POSITION":)" << first
+                   << R"(,"NORMAL":)" << first + 1 << R"(,"TEXCOORD_0":)" << first + 2 << R"(},"indices":)" << first + 3 << "}]}";
+            nodes << (m ? "," : "") << R"({"mesh":)" << m << R"(,"translation":[)" << (static_cast<float>(m % 8) - 3.5f) * 2.5f
+                  << ",0," << (static_cast<float>(m / 8) - 1.5f) * 2.5f << "]}";
+        }
+
+        const auto document = [&](const std::string& buffer) {
+            std::ostringstream scene;
+            scene << R"({"asset":{"version":"2.0"},"scene":0,"scenes":[{"nodes":[)";
+            for (std::uint32_t m = 0; m < kMeshes; ++m) scene << (m ? "," : "") << m;
+            scene << R"(]}],"nodes":[)" << nodes.str() << R"(],"meshes":[)" << meshes.str() << R"(],"accessors":[)"
+                  << accessors.str() << R"(],"bufferViews":[)" << views.str() << R"(],"buffers":[{"byteLength":)"
+                  << binary.size() << buffer << "}]}";
+            return scene.str();
+        };
+
+        std::ofstream(kBinName, std::ios::binary).write(binary.data(), static_cast<std::streamsize>(binary.size()));
+        std::ofstream("bench_scene.gltf") << document(std::string(R"(,"uri":")") + kBinName + "\"");
+
+        std::string json = document("");
+        json.resize((json.size() + 3) & ~std::size_t{3}, ' ');
+        const auto u32 = [](std::ofstream& out, const std::uint32_t value) {
+            out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        };
+        std::ofstream glb("bench_scene.glb", std::ios::binary);
+        u32(glb, 0x46546C67);
+        u32(glb, 2);
+        u32(glb, static_cast<std::uint32_t>(12 + 8 + json.size() + 8 + binary.size()));
+        u32(glb, static_cast<std::uint32_t>(json.size()));
+        u32(glb, 0x4E4F534A);
+        glb.write(json.data(), static_cast<std::streamsize>(json.size()));
+        u32(glb, static_cast<std::uint32_t>(binary.size()));
+        u32(glb, 0x004E4942);
+        glb.write(binary.data(), static_cast<std::streamsize>(binary.size()));
+    }
+
+    void Report(const char* file, ThreadPool& pool, const bool serial) {
+        GltfModel::Stats best{};
+        for (int run = 0; run < kRuns; ++run) {
+            GltfModel loaded = LoadGltf(file, pool);
+            if (run == 0 || loaded.stats.totalMs < best.totalMs) best = loaded.stats;
+            if (!serial) model = std::move(loaded);
+        }
+
+        std::cout << std::left << std::setw(10) << (std::strstr(file, ".glb") ? "glb" : "gltf+bin") << std::right
+                  << std::setw(9) << best.threads << std::fixed << std::setprecision(1)
+                  << std::setw(10) << static_cast<double>(best.bytes) / (1024.0 * 1024.0)
+                  << std::setprecision(2)
+                  << std::setw(11) << best.parseMs << std::setw(11) << best.decodeMs << std::setw(11) << best.totalMs
+                  << std::setprecision(0) << std::setw(10) << best.megabytesPerSecond << std::endl;
+    }
+
+    static constexpr const char* kBinName = "bench_scene.bin";
+
+    GltfModel model;
+    int frame = 0;
+
+    std::unique_ptr<VertexBuffer> vertices;
+    std::unique_ptr<IndexBuffer> indices;
+    std::unique_ptr<VertexArray> vao;
+    std::unique_ptr<Shader> shader;
+};
+
+int main() {
+    constexpr AppProperties props{ "glTF Load Benchmark", 800, 600, VSyncMode::Off };
+    const std::unique_ptr<GltfLoadBench> bench = std::make_unique<GltfLoadBench>(props);
+    bench->Run();
+
+    return 0;
+}
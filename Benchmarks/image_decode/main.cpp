@@ -0,0 +1,390 @@
+//
+// Created by niek on 11/28/2025.
+//
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+#include <GLCore/App.h>
+#include <GLCore/CookedTexture.h>
+#include <GLCore/Image.h>
+#include <GLCore/Qoi.h>
+using namespace GLCore;
+
+/**
+ * Generates a corpus of RGBA images (UI-like flat panels with alpha and text runs, smooth photo-like gradients with
+ * grain, and pure noise, each at kSizes) and writes every image three ways into a temporary directory:
+ * - png: compressed with per-row filter selection and fixed-Huffman deflate, decoded by LoadImageFile (stb_image)
+ * - qoi: EncodeQoi, decoded by LoadImageFile (DecodeQoi)
+ * - raw: an uncompressed single-level .gtex, mapped by CookedTexture and copied into an Image
+ * Then decodes the corpus kPasses times (after a warm-up pass that checks every format against the source pixels)
+ * and reports file size, compression ratio against raw RGBA, decoded MB/s and per-image latency percentiles, per
+ * content type and overall. The files are hot in the page cache, so this is decode cost, not disk bandwidth.
+ */
+class ImageDecodeBench final : public App {
+public:
+    using App::App;
+
+protected:
+    void OnInit() override {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "glcore_image_decode";
+        std::filesystem::create_directories(directory);
+
+        std::vector<Entry> corpus;
+        std::uint64_t rawBytes = 0;
+        for (int content = 0; content < kContents; ++content) {
+            for (const int size : kSizes) {
+                Entry& entry = corpus.emplace_back();
+                entry.content = content;
+                entry.source = MakeImage(content, size, static_cast<int>(corpus.size()));
+                rawBytes += entry.source.pixels.size();
+
+                const std::filesystem::path base = directory / (std::string(kContentNames[content]) + "_" + std::to_string(size));
+                entry.paths[0] = base.string() + ".png";
+                entry.paths[1] = base.string() + ".qoi";
+                entry.paths[2] = base.string() + ".gtex";
+                WritePng(entry.paths[0], entry.source);
+                WriteFile(entry.paths[1], EncodeQoi(entry.source));
+                CookTexture(std::span(&entry.source, 1), entry.paths[2]);
+                for (int format = 0; format < kFormats; ++format)
+                    entry.fileBytes[format] = std::filesystem::file_size(entry.paths[format]);
+            }
+        }
+
+        std::cout << "Corpus: " << corpus.size() << " images (" << kSizes.front() << " to " << kSizes.back() << " px), "
+                  << std::fixed << std::setprecision(1) << static_cast<double>(rawBytes) / (1024.0 * 1024.0)
+                  << " MB of RGBA, " << kPasses << " passes, files in " << directory.string() << "\n";
+
+        // Warm-up pass: every format has to give back the source pixels exactly
+        for (const Entry& entry : corpus) {
+            for (int format = 0; format < kFormats; ++format) {
+                const Image decoded = Decode(format, entry.paths[format]);
+                if (decoded.width != entry.source.width || decoded.height != entry.source.height
+                    || decoded.channels != entry.source.channels || decoded.pixels != entry.source.pixels)
+                    std::cout << "  " << kFormatNames[format] << " mismatch: " << entry.paths[format] << "\n";
+            }
+        }
+
+        // Interleaved so that no format benefits from running while the caches are warm from its own previous image
+        std::array<std::array<std::vector<double>, kContents>, kFormats> ms{};
+        for (int pass = 0; pass < kPasses; ++pass) {
+            for (const Entry& entry : corpus) {
+                for (int format = 0; format < kFormats; ++format) {
+                    const auto start = Clock::now();
+                    const Image decoded = Decode(format, entry.paths[format]);
+                    ms[format][entry.content].push_back(std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+                }
+            }
+        }
+
+        std::cout << "\n" << std::left << std::setw(8) << "format" << std::setw(9) << "content" << std::right
+                  << std::setw(9) << "file MB" << std::setw(8) << "ratio" << std::setw(9) << "MB/s" << std::setw(9)
+                  << "p50 ms" << std::setw(9) << "p90 ms" << std::setw(9) << "p99 ms" << std::setw(9) << "max ms" << std::endl;
+        for (int format = 0; format < kFormats; ++format) {
+            std::vector<double> all;
+            std::uint64_t allFile = 0, allRaw = 0;
+            for (int content = 0; content < kContents; ++content) {
+                std::uint64_t file = 0, raw = 0;
+                for (const Entry& entry : corpus) {
+                    if (entry.content != content) continue;
+                    file += entry.fileBytes[format];
+                    raw += entry.source.pixels.size();
+                }
+                Row(kFormatNames[format], kContentNames[content], file, raw, ms[format][content]);
+                all.insert(all.end(), ms[format][content].begin(), ms[format][content].end());
+                allFile += file;
+                allRaw += raw;
+            }
+            Row(kFormatNames[format], "all", allFile, allRaw, all);
+        }
+
+        std::error_code error;
+        std::filesystem::remove_all(directory, error);
+    }
+
+    void OnShutdown() override { }
+    void OnUpdate() override { }
+
+    void OnRender() override {
+        GetWindow().RequestClose();
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr int kContents = 3;
+    static constexpr int kFormats = 3;
+    static constexpr int kPasses = 5;
+    static constexpr std::array kSizes{256, 512, 1024, 2048};
+    static constexpr const char* kContentNames[] = {"ui", "photo", "noise"};
+    static constexpr const char* kFormatNames[] = {"png", "qoi", "raw"};
+
+    struct Entry {
+        int content = 0;
+        Image source;
+        std::array<std::string, kFormats> paths;
+        std::array<std::uint64_t, kFormats> fileBytes{};
+    };
+
+    static Image Decode(const int format, const std::string& path) {
+        if (format != 2) return LoadImageFile(path, false);
+
+        const CookedTexture cooked(path);
+        const std::span<const std::byte> level = cooked.Level(0);
+        Image image;
+        image.width = cooked.Width();
+        image.height = cooked.Height();
+        image.channels = cooked.Channels();
+        image.pixels.resize(level.size());
+        std::memcpy(image.pixels.data(), level.data(), level.size());
+        return image;
+    }
+
+    // One table row; the percentiles are per decoded image, over every image of the row and every pass
+    static void Row(const char* format, const char* content, const std::uint64_t fileBytes, const std::uint64_t rawBytes,
+                    std::vector<double> ms) {
+        std::sort(ms.begin(), ms.end());
+        double totalMs = 0.0;
+        for (const double sample : ms) totalMs += sample;
+        const auto percentile = [&ms](const double p) {
+            return ms[std::min(ms.size() - 1, static_cast<std::size_t>(std::ceil(p * static_cast<double>(ms.size()))) - 1)];
+        };
+        const double decodedMB = static_cast<double>(rawBytes) * kPasses / (1024.0 * 1024.0);
+        std::cout << std::left << std::setw(8) << format << std::setw(9) << content << std::right << std::fixed
+                  << std::setprecision(2) << std::setw(9) << static_cast<double>(fileBytes) / (1024.0 * 1024.0)
+                  << std::setw(8) << static_cast<double>(rawBytes) / static_cast<double>(fileBytes) << std::setprecision(0)
+                  << std::setw(9) << decodedMB / (totalMs / 1000.0) << std::setprecision(2) << std::setw(9) << percentile(0.5)
+                  << std::setw(9) << percentile(0.9) << std::setw(9) << percentile(0.99) << std::setw(9) << ms.back() << std::endl;
+    }
+
+    static std::uint32_t Hash(std::uint32_t a, const std::uint32_t b, const std::uint32_t c) {
+        a = a * 0x9E3779B1u ^ b * 0x85EBCA77u ^ c * 0xC2B2AE3Du;
+        a ^= a >> 15;
+        a *= 0x2C1B3C6Du;
+        return a ^ a >> 12;
+    }
+
+    static Image MakeImage(const int content, const int size, const int seed) {
+        static constexpr std::uint8_t kPalette[8][3] = {{38, 50, 56}, {69, 90, 100}, {33, 150, 243}, {76, 175, 80},
+                                                        {255, 193, 7}, {244, 67, 54}, {156, 39, 176}, {236, 239, 241}};
+        Image image;
+        image.width = image.height = size;
+        image.channels = 4;
+        image.pixels.resize(static_cast<std::size_t>(size) * size * 4);
+        std::uint32_t state = 0x9E3779B9u * static_cast<std::uint32_t>(seed + 1);
+        for (int y = 0; y < size; ++y) {
+            for (int x = 0; x < size; ++x) {
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                std::uint8_t* p = &image.pixels[(static_cast<std::size_t>(y) * size + x) * 4];
+                if (content == 0) {
+                    // UI atlas: 64 px cells, a quarter empty, the rest a flat panel with a border and lines of "glyphs"
+                    const int cx = x & 63, cy = y & 63;
+                    const std::uint32_t cell = Hash(static_cast<std::uint32_t>(x >> 6), static_cast<std::uint32_t>(y >> 6),
+                                                    static_cast<std::uint32_t>(seed));
+                    if (cell % 4 == 0 || cx < 4 || cy < 4 || cx >= 60 || cy >= 60) {
+                        p[0] = p[1] = p[2] = p[3] = 0;
+                        continue;
+                    }
+                    const std::uint8_t* color = kPalette[cell / 4 % 8];
+                    const bool border = cx == 4 || cy == 4 || cx == 59 || cy == 59;
+                    const bool glyph = cx >= 10 && cx < 54 && cy >= 12 && cy < 52 && cy % 10 < 6
+                                       && Hash(static_cast<std::uint32_t>(x / 3), static_cast<std::uint32_t>(y / 10), cell) % 3 != 0;
+                    for (int c = 0; c < 3; ++c)
+                        p[c] = glyph ? 255 : border ? static_cast<std::uint8_t>(color[c] / 2) : color[c];
+                    p[3] = border ? 255 : 230;
+                } else if (content == 1) {
+                    // Photo-like: smooth gradients plus a little grain
+                    const int grain = static_cast<int>(state & 7) - 3;
+                    const float u = static_cast<float>(x) / static_cast<float>(size), v = static_cast<float>(y) / static_cast<float>(size);
+                    p[0] = static_cast<std::uint8_t>(std::clamp(static_cast<int>(200.0f * u + 30.0f) + grain, 0, 255));
+                    p[1] = static_cast<std::uint8_t>(std::clamp(static_cast<int>(160.0f * v + 40.0f) + grain, 0, 255));
+                    p[2] = static_cast<std::uint8_t>(std::clamp(static_cast<int>(128.0f + 100.0f * std::sin((u + v) * 6.0f)) + grain, 0, 255));
+                    p[3] = 255;
+                } else {
+                    p[0] = static_cast<std::uint8_t>(state);
+                    p[1] = static_cast<std::uint8_t>(state >> 8);
+                    p[2] = static_cast<std::uint8_t>(state >> 16);
+                    p[3] = 255;
+                }
+            }
+        }
+        return image;
+    }
+
+    static void WriteFile(const std::string& path, const std::vector<std::uint8_t>& bytes) {
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    // 8-bit RGBA PNG: per-row filter with the smallest sum of absolute residuals (libpng's heuristic), then one
+    // fixed-Huffman deflate block with greedy LZ77 matches. Larger than zlib's output, but stb_image decodes it with
+    // the same inflate, Huffman and unfiltering work as any other PNG.
+    static void WritePng(const std::string& path, const Image& image) {
+        const std::size_t stride = static_cast<std::size_t>(image.width) * 4;
+        std::vector<std::uint8_t> filtered;
+        filtered.reserve((stride + 1) * image.height);
+        std::vector<std::uint8_t> zero(stride, 0), candidate(stride), best(stride);
+        for (int y = 0; y < image.height; ++y) {
+            const std::uint8_t* row = &image.pixels[y * stride];
+            const std::uint8_t* up = y > 0 ? row - stride : zero.data();
+            long bestCost = -1;
+            int bestFilter = 0;
+            for (int filter = 0; filter < 5; ++filter) {
+                long cost = 0;
+                for (std::size_t i = 0; i < stride; ++i) {
+                    const int a = i >= 4 ? row[i - 4] : 0, b = up[i], c = i >= 4 ? up[i - 4] : 0;
+                    int predicted = 0;
+                    switch (filter) {
+                        case 1: predicted = a; break;
+                        case 2: predicted = b; break;
+                        case 3: predicted = (a + b) / 2; break;
+                        case 4: {
+                            const int pa = std::abs(b - c), pb = std::abs(a - c), pc = std::abs(a + b - 2 * c);
+                            predicted = pa <= pb && pa <= pc ? a : pb <= pc ? b : c;
+                            break;
+                        }
+                        default: break;
+                    }
+                    candidate[i] = static_cast<std::uint8_t>(row[i] - predicted);
+                    cost += std::abs(static_cast<int>(static_cast<std::int8_t>(candidate[i])));
+                }
+                if (bestCost < 0 || cost < bestCost) {
+                    bestCost = cost;
+                    bestFilter = filter;
+                    std::swap(best, candidate);
+                }
+            }
+            filtered.push_back(static_cast<std::uint8_t>(bestFilter));
+            filtered.insert(filtered.end(), best.begin(), best.end());
+        }
+
+        std::vector<std::uint8_t> header;
+        AppendBigEndian(header, static_cast<std::uint32_t>(image.width));
+        AppendBigEndian(header, static_cast<std::uint32_t>(image.height));
+        header.insert(header.end(), {8, 6, 0, 0, 0});   // 8-bit RGBA, deflate, adaptive filtering, no interlace
+
+        std::ofstream file(path, std::ios::binary);
+        file.write("\x89PNG\r\n\x1a\n", 8);
+        WriteChunk(file, "IHDR", header);
+        WriteChunk(file, "IDAT", Deflate(filtered));
+        WriteChunk(file, "IEND", {});
+    }
+
+    static std::vector<std::uint8_t> Deflate(const std::vector<std::uint8_t>& data) {
+        static constexpr int kLengthBase[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59,
+                                                67, 83, 99, 115, 131, 163, 195, 227, 258};
+        static constexpr int kLengthExtra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+        static constexpr int kDistanceBase[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769,
+                                                  1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+        static constexpr int kDistanceExtra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10,
+                                                   11, 11, 12, 12, 13, 13};
+
+        std::vector<std::uint8_t> out{0x78, 0x01};
+        std::uint64_t bits = 0;
+        int count = 0;
+        const auto put = [&](const std::uint32_t value, const int length) {
+            bits |= static_cast<std::uint64_t>(value) << count;
+            count += length;
+            for (; count >= 8; count -= 8, bits >>= 8) out.push_back(static_cast<std::uint8_t>(bits));
+        };
+        // Huffman codes are stored most significant bit first, everything else least significant bit first
+        const auto code = [&](const std::uint32_t value, const int length) {
+            std::uint32_t reversed = 0;
+            for (int i = 0; i < length; ++i) reversed |= ((value >> i) & 1u) << (length - 1 - i);
+            put(reversed, length);
+        };
+        const auto symbol = [&](const int value) {
+            if (value < 144) code(0x30 + value, 8);
+            else if (value < 256) code(0x190 + value - 144, 9);
+            else if (value < 280) code(value - 256, 7);
+            else code(0xC0 + value - 280, 8);
+        };
+        const auto key = [&data](const std::size_t i) {
+            return (static_cast<std::uint32_t>(data[i]) << 16 | static_cast<std::uint32_t>(data[i + 1]) << 8 | data[i + 2])
+                   * 2654435761u >> 17;
+        };
+
+        put(1, 1);   // final block
+        put(1, 2);   // fixed Huffman codes
+        std::vector<std::int64_t> head(1 << 15, -1);
+        for (std::size_t i = 0; i < data.size();) {
+            std::size_t length = 0, distance = 0;
+            if (i + 3 <= data.size()) {
+                const std::uint32_t hash = key(i);
+                const std::int64_t match = head[hash];
+                head[hash] = static_cast<std::int64_t>(i);
+                if (match >= 0 && i - static_cast<std::size_t>(match) <= 32768) {
+                    const std::size_t limit = std::min<std::size_t>(258, data.size() - i);
+                    while (length < limit && data[static_cast<std::size_t>(match) + length] == data[i + length]) ++length;
+                    distance = i - static_cast<std::size_t>(match);
+                }
+            }
+            if (length < 3) {
+                symbol(data[i++]);
+                continue;
+            }
+            int l = 28, d = 29;
+            while (static_cast<std::size_t>(kLengthBase[l]) > length) --l;
+            while (static_cast<std::size_t>(kDistanceBase[d]) > distance) --d;
+            symbol(257 + l);
+            put(static_cast<std::uint32_t>(length) - kLengthBase[l], kLengthExtra[l]);
+            code(static_cast<std::uint32_t>(d), 5);
+            put(static_cast<std::uint32_t>(distance) - kDistanceBase[d], kDistanceExtra[d]);
+            for (std::size_t j = i + 1; j < i + length && j + 3 <= data.size(); ++j) head[key(j)] = static_cast<std::int64_t>(j);
+            i += length;
+        }
+        symbol(256);
+        if (count > 0) put(0, 8 - count);
+
+        std::uint32_t a = 1, b = 0;
+        for (const std::uint8_t byte : data) {
+            a = (a + byte) % 65521;
+            b = (b + a) % 65521;
+        }
+        AppendBigEndian(out, (b << 16) | a);
+        return out;
+    }
+
+    static void AppendBigEndian(std::vector<std::uint8_t>& out, const std::uint32_t value) {
+        out.insert(out.end(), {static_cast<std::uint8_t>(value >> 24), static_cast<std::uint8_t>(value >> 16),
+                               static_cast<std::uint8_t>(value >> 8), static_cast<std::uint8_t>(value)});
+    }
+
+    static void WriteChunk(std::ofstream& file, const char* type, const std::vector<std::uint8_t>& data) {
+        std::vector<std::uint8_t> chunk;
+        AppendBigEndian(chunk, static_cast<std::uint32_t>(data.size()));
+        chunk.insert(chunk.end(), type, type + 4);
+        chunk.insert(chunk.end(), data.begin(), data.end());
+
+        std::uint32_t crc = 0xFFFFFFFFu;
+        for (std::size_t i = 4; i < chunk.size(); ++i) {
+            crc ^= chunk[i];
+            for (int bit = 0; bit < 8; ++bit) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+        AppendBigEndian(chunk, ~crc);
+        file.write(reinterpret_cast<const char*>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+    }
+};
+
+int main() {
+    constexpr AppProperties props{ "Image Decode Benchmark", 800, 600, VSyncMode::Off };
+    const std::unique_ptr<ImageDecodeBench> bench = std::make_unique<ImageDecodeBench>(props);
+    bench->Run();
+
+    return 0;
+}
@@ -0,0 +1,22 @@
+#version 430 core
+layout (location = 0) in vec3 aPos;
+layout (location = 3) in uint aDrawID;   // instanced, offset by each command's baseInstance
+
+struct DrawData {
+    mat4 model;
+    vec4 color;
+};
+
+layout (std430, binding = 0) readonly buffer Draws {
+    DrawData draws[];
+};
+
+uniform mat4 uViewProjection;
+
+out vec4 vColor;
+
+void main() {
+    DrawData draw = draws[aDrawID];
+    vColor = draw.color;
+    gl_Position = uViewProjection * draw.model * vec4(aPos, 1.0);
+}
@@ -0,0 +1,229 @@
+//
+// Created by niek on 11/14/2025.
+//
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+#include <GLCore/App.h>
+#include <GLCore/Caps.h>
+#include <GLCore/IndirectDrawList.h>
+#include <GLCore/Shader.h>
+#include <gtc/matrix_transform.hpp>
+using namespace GLCore;
+
+struct MeshVertex {
+    glm::vec3 position;
+    using Layout = VertexLayout<Attrib<glm::vec3>>;
+};
+
+// Matches DrawData in mesh_indirect.vert (std430 stride 80)
+struct DrawData {
+    glm::mat4 model;
+    glm::vec4 color;
+};
+
+struct Object {
+    MeshHandle mesh;
+    std::uint32_t material = 0;
+    BoundingSphere bounds;
+    DrawData data;
+};
+
+/**
+ * Draws kObjects meshes from one GeometryPool with 4 materials while the camera orbits, so roughly half of them are
+ * frustum-culled each frame. Compares a plain cull + glDrawElementsBaseVertex loop with IndirectDrawList.
+ * Reports CPU time for cull + submit, frame time and GL draw calls per frame.
+ */
+class IndirectDrawBench final : public App {
+public:
+    using App::App;
+
+protected:
+    void OnInit() override {
+        pool = std::make_unique<GeometryPool>(VertexFormat::Of<MeshVertex>(), 4096, 16384, "Bench pool");
+        std::vector<MeshHandle> meshes;
+        for (std::uint32_t segments = 3; segments <= 10; ++segments) meshes.push_back(AddSpindle(segments));
+
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> position(-150.0f, 150.0f);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        objects.resize(kObjects);
+        for (std::uint32_t i = 0; i < kObjects; ++i) {
+            Object& object = objects[i];
+            const glm::vec3 center{position(rng), position(rng) * 0.3f, position(rng)};
+            object.mesh = meshes[i % meshes.size()];
+            object.material = i % kMaterials;
+            object.bounds = {center, 1.0f};
+            object.data.model = glm::rotate(glm::translate(glm::mat4(1.0f), center), unit(rng) * 6.28f, glm::vec3(0.0f, 1.0f, 0.0f));
+            object.data.color = {unit(rng), unit(rng), unit(rng), 1.0f};
+        }
+
+        drawList = std::make_unique<IndirectDrawList>(sizeof(DrawData), kObjects, 0, "Bench draws");
+        drawList->AttachDrawID(pool->GetVertexArray(), 3);
+
+        loopShader = std::make_unique<Shader>("assets/mesh_loop.vert", "assets/mesh.frag");
+        if (drawList->IsIndirect()) indirectShader = std::make_unique<Shader>("assets/mesh_indirect.vert", "assets/mesh.frag");
+
+        std::cout << "GL " << Caps::Get().version << " (" << Caps::Get().renderer << ")\n"
+                  << "Drawing up to " << kObjects << " objects/frame in " << kMaterials << " materials, "
+                  << kMeasuredFrames << " frames per scenario"
+                  << (drawList->IsIndirect() ? " (multi-draw indirect)" : " (3.3 fallback loop)") << "\n\n"
+                  << std::left << std::setw(12) << "scenario" << std::right
+                  << std::setw(12) << "cpu ms" << std::setw(12) << "frame ms" << std::setw(10) << "visible"
+                  << std::setw(10) << "draws" << std::endl;
+        glEnable(GL_DEPTH_TEST);
+    }
+
+    void OnShutdown() override {
+        drawList.reset();
+        pool.reset();
+        indirectShader.reset();
+        loopShader.reset();
+    }
+
+    void OnUpdate() override { }
+
+    void OnRender() override {
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        if (scenario >= 2) return;
+
+        const float angle = static_cast<float>(frame) * 0.01f;
+        const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 800.0f / 600.0f, 0.1f, 500.0f);
+        const glm::mat4 view = glm::lookAt(glm::vec3(std::cos(angle) * 40.0f, 10.0f, std::sin(angle) * 40.0f),
+                                           glm::vec3(std::cos(angle) * 200.0f, 0.0f, std::sin(angle) * 200.0f),
+                                           glm::vec3(0.0f, 1.0f, 0.0f));
+        const glm::mat4 viewProjection = projection * view;
+
+        const auto cpuStart = Clock::now();
+        std::uint32_t visible = 0, draws = 0;
+        if (scenario == 0) RenderLoop(viewProjection, visible, draws);
+        else RenderIndirect(viewProjection, visible, draws);
+        const auto cpuEnd = Clock::now();
+
+        ++frame;
+        if (frame <= kWarmupFrames) {
+            if (frame == kWarmupFrames) {
+                glFinish();
+                measureStart = Clock::now();
+            }
+            return;
+        }
+
+        cpuSeconds += std::chrono::duration<double>(cpuEnd - cpuStart).count();
+        visibleTotal += visible;
+        drawsTotal += draws;
+        if (frame == kWarmupFrames + kMeasuredFrames) FinishScenario();
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::uint32_t kObjects = 40000;
+    static constexpr std::uint32_t kMaterials = 4;
+    static constexpr int kWarmupFrames = 30;
+    static constexpr int kMeasuredFrames = 200;
+    static constexpr std::array<glm::vec4, kMaterials> kTints{{
+        {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 0.6f, 0.6f, 1.0f}, {0.6f, 1.0f, 0.6f, 1.0f}, {0.6f, 0.6f, 1.0f, 1.0f},
+    }};
+
+    // A double cone with `segments` sides, unit radius
+    MeshHandle AddSpindle(const std::uint32_t segments) const {
+        std::vector<MeshVertex> vertices{{{0.0f, 1.0f, 0.0f}}, {{0.0f, -1.0f, 0.0f}}};
+        std::vector<std::uint32_t> indices;
+        for (std::uint32_t s = 0; s < segments; ++s) {
+            const float a = 6.2831853f * static_cast<float>(s) / static_cast<float>(segments);
+            vertices.push_back({{std::cos(a) * 0.7f, 0.0f, std::sin(a) * 0.7f}});
+            const std::uint32_t current = 2 + s, next = 2 + (s + 1) % segments;
+            indices.insert(indices.end(), {0, next, current, 1, current, next});
+        }
+        return pool->Add(vertices, indices);
+    }
+
+    void RenderLoop(const glm::mat4& viewProjection, std::uint32_t& visible, std::uint32_t& draws) {
+        const Frustum frustum(viewProjection);
+        loopShader->Bind();
+        loopShader->SetMat4("uViewProjection", viewProjection);
+        pool->Bind();
+        for (std::uint32_t material = 0; material < kMaterials; ++material) {
+            loopShader->SetVec4("uTint", kTints[material]);
+            for (const Object& object : objects) {
+                if (object.material != material || !frustum.Intersects(object.bounds)) continue;
+                loopShader->SetMat4("uModel", object.data.model);
+                loopShader->SetVec4("uColor", object.data.color);
+                pool->Draw(object.mesh);
+                ++visible;
+                ++draws;
+            }
+        }
+    }
+
+    void RenderIndirect(const glm::mat4& viewProjection, std::uint32_t& visible, std::uint32_t& draws) {
+        drawList->Begin(Frustum(viewProjection));
+        for (const Object& object : objects)
+            drawList->Add(object.material, pool->GetRange(object.mesh), object.bounds, object.data);
+        drawList->Upload();
+
+        const Shader& shader = indirectShader ? *indirectShader : *loopShader;
+        shader.Bind();
+        shader.SetMat4("uViewProjection", viewProjection);
+        pool->Bind();
+        for (std::uint32_t material = 0; material < kMaterials; ++material) {
+            shader.SetVec4("uTint", kTints[material]);
+            drawList->Submit(material, GL_TRIANGLES, [&shader](std::uint32_t, const void* data) {
+                const auto* draw = static_cast<const DrawData*>(data);
+                shader.SetMat4("uModel", draw->model);
+                shader.SetVec4("uColor", draw->color);
+            });
+        }
+        drawList->End();
+
+        visible = drawList->GetStats().draws;
+        draws = drawList->GetStats().submitCalls;
+    }
+
+    void FinishScenario() {
+        glFinish();
+        const double seconds = std::chrono::duration<double>(Clock::now() - measureStart).count();
+
+        std::cout << std::left << std::setw(12) << (scenario == 0 ? "loop" : "indirect") << std::right
+                  << std::fixed << std::setprecision(3)
+                  << std::setw(12) << cpuSeconds * 1000.0 / kMeasuredFrames
+                  << std::setw(12) << seconds * 1000.0 / kMeasuredFrames
+                  << std::setw(10) << visibleTotal / kMeasuredFrames
+                  << std::setw(10) << drawsTotal / kMeasuredFrames << std::endl;
+
+        frame = 0;
+        cpuSeconds = 0.0;
+        visibleTotal = 0;
+        drawsTotal = 0;
+        if (++scenario >= 2) GetWindow().RequestClose();
+    }
+
+    std::vector<Object> objects;
+    int scenario = 0;
+    int frame = 0;
+    Clock::time_point measureStart{};
+    double cpuSeconds = 0.0;
+    std::uint64_t visibleTotal = 0;
+    std::uint64_t drawsTotal = 0;
+
+    std::unique_ptr<GeometryPool> pool;
+    std::unique_ptr<IndirectDrawList> drawList;
+    std::unique_ptr<Shader> loopShader;
+    std::unique_ptr<Shader> indirectShader;
+};
+
+int main() {
+    constexpr AppProperties props{ "Indirect Draw Benchmark", 800, 600, VSyncMode::Off };
+    const std::unique_ptr<IndirectDrawBench> bench = std::make_unique<IndirectDrawBench>(props);
+    bench->Run();
+
+    return 0;
+}
@@ -0,0 +1,13 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in mat4 aModel;   // locations 1..4, divisor 1
+layout (location = 5) in vec4 aColor;   // divisor 1
+
+uniform mat4 uViewProjection;
+
+out vec4 vColor;
+
+void main() {
+    vColor = aColor;
+    gl_Position = uViewProjection * aModel * vec4(aPos, 1.0);
+}
@@ -0,0 +1,13 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+
+uniform mat4 uViewProjection;
+uniform mat4 uModel;
+uniform vec4 uColor;
+
+out vec4 vColor;
+
+void main() {
+    vColor = uColor;
+    gl_Position = uViewProjection * uModel * vec4(aPos, 1.0);
+}
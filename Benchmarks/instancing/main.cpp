@@ -0,0 +1,188 @@
+//
+// Created by niek on 11/14/2025.
+//
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <GLCore/App.h>
+#include <GLCore/Caps.h>
+#include <GLCore/InstancedMesh.h>
+#include <GLCore/Shader.h>
+#include <gtc/matrix_transform.hpp>
+using namespace GLCore;
+
+struct CubeVertex {
+    glm::vec3 position;
+    using Layout = VertexLayout<Attrib<glm::vec3>>;
+};
+
+/**
+ * Draws kInstances small cubes per frame three ways:
+ * - naive: one glDrawElements per cube with its transform and color set as uniforms
+ * - instanced: all cubes in one InstancedMesh draw
+ * - instanced x64: the cubes split over 64 instanced draws (exercises baseInstance / stream rebinding)
+ * Reports CPU submission time and total frame time per scenario.
+ */
+class InstancingBench final : public App {
+public:
+    using App::App;
+
+protected:
+    void OnInit() override {
+        constexpr std::array<CubeVertex, 8> vertices{{
+            {{-0.5f, -0.5f, -0.5f}}, {{0.5f, -0.5f, -0.5f}}, {{0.5f, 0.5f, -0.5f}}, {{-0.5f, 0.5f, -0.5f}},
+            {{-0.5f, -0.5f, 0.5f}}, {{0.5f, -0.5f, 0.5f}}, {{0.5f, 0.5f, 0.5f}}, {{-0.5f, 0.5f, 0.5f}},
+        }};
+        constexpr std::array<std::uint32_t, 36> indices{
+            0, 2, 1, 0, 3, 2,  4, 5, 6, 4, 6, 7,  0, 1, 5, 0, 5, 4,
+            3, 6, 2, 3, 7, 6,  0, 4, 7, 0, 7, 3,  1, 2, 6, 1, 6, 5,
+        };
+
+        naiveVertices = std::make_unique<VertexBuffer>(vertices, BufferUsage::Static, "Naive cube vertices");
+        naiveIndices = std::make_unique<IndexBuffer>(indices, BufferUsage::Static, "Naive cube indices");
+        naiveVao = std::make_unique<VertexArray>("Naive cube VAO");
+        naiveVao->SetVertexBuffer(0, *naiveVertices);
+        naiveVao->SetIndexBuffer(*naiveIndices);
+
+        mesh = std::make_unique<InstancedMesh>(vertices, indices, kInstances, "Instanced cubes");
+        naiveShader = std::make_unique<Shader>("assets/cube_naive.vert", "assets/cube.frag");
+        instancedShader = std::make_unique<Shader>("assets/cube_instanced.vert", "assets/cube.frag");
+
+        // A kGridX x kGridY wall of cubes in front of the camera
+        transforms.reserve(kInstances);
+        colors.reserve(kInstances);
+        for (std::uint32_t i = 0; i < kInstances; ++i) {
+            const float x = static_cast<float>(i % kGridX) - kGridX * 0.5f;
+            const float y = static_cast<float>(i / kGridX) - kGridY * 0.5f;
+            transforms.push_back(glm::scale(glm::translate(glm::mat4(1.0f), {x, y, 0.0f}), glm::vec3(0.8f)));
+            colors.emplace_back(i * 37 % 256, i * 91 % 256, 200, 255);
+        }
+        const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 800.0f / 600.0f, 0.1f, 1000.0f);
+        viewProjection = projection * glm::lookAt(glm::vec3(0.0f, 0.0f, 220.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+        std::cout << "GL " << Caps::Get().version << " (" << Caps::Get().renderer << ")\n"
+                  << "Drawing " << kInstances << " cubes/frame, " << kMeasuredFrames << " frames per scenario"
+                  << (Caps::Get().baseInstance ? " (baseInstance)" : " (stream rebinding)") << "\n\n"
+                  << std::left << std::setw(16) << "scenario" << std::right
+                  << std::setw(14) << "submit ms" << std::setw(14) << "frame ms" << std::setw(10) << "draws" << std::endl;
+        glEnable(GL_DEPTH_TEST);
+    }
+
+    void OnShutdown() override {
+        mesh.reset();
+        naiveVao.reset();
+        naiveIndices.reset();
+        naiveVertices.reset();
+        instancedShader.reset();
+        naiveShader.reset();
+    }
+
+    void OnUpdate() override { }
+
+    void OnRender() override {
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        if (scenario >= kScenarioCount) return;
+
+        const auto submitStart = Clock::now();
+        const std::uint32_t draws = scenario == 0 ? SubmitNaive() : SubmitInstanced(scenario == 1 ? 1 : 64);
+        const auto submitEnd = Clock::now();
+
+        ++frame;
+        if (frame <= kWarmupFrames) {
+            if (frame == kWarmupFrames) {
+                glFinish();
+                measureStart = Clock::now();
+            }
+            return;
+        }
+
+        submitSeconds += std::chrono::duration<double>(submitEnd - submitStart).count();
+        if (frame == kWarmupFrames + kMeasuredFrames) FinishScenario(draws);
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::uint32_t kGridX = 250;
+    static constexpr std::uint32_t kGridY = 200;
+    static constexpr std::uint32_t kInstances = kGridX * kGridY;
+    static constexpr int kScenarioCount = 3;
+    static constexpr int kWarmupFrames = 30;
+    static constexpr int kMeasuredFrames = 200;
+
+    std::uint32_t SubmitNaive() const {
+        naiveShader->Bind();
+        naiveShader->SetMat4("uViewProjection", viewProjection);
+        naiveVao->Bind();
+        for (std::uint32_t i = 0; i < kInstances; ++i) {
+            naiveShader->SetMat4("uModel", transforms[i]);
+            naiveShader->SetVec4("uColor", glm::vec4(colors[i]) / 255.0f);
+            glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, nullptr);
+        }
+        return kInstances;
+    }
+
+    std::uint32_t SubmitInstanced(const std::uint32_t chunks) {
+        instancedShader->Bind();
+        instancedShader->SetMat4("uViewProjection", viewProjection);
+
+        mesh->BeginFrame();
+        const std::uint32_t perChunk = kInstances / chunks;
+        for (std::uint32_t c = 0; c < chunks; ++c) {
+            const std::uint32_t first = c * perChunk;
+            const std::uint32_t count = c + 1 == chunks ? kInstances - first : perChunk;
+            const InstancedMesh::InstanceRange range = mesh->Allocate(count);
+            std::copy_n(transforms.begin() + first, count, range.transforms.begin());
+            std::copy_n(colors.begin() + first, count, range.colors.begin());
+            mesh->Draw(range);
+        }
+        mesh->EndFrame();
+        return mesh->GetStats().drawCalls;
+    }
+
+    void FinishScenario(const std::uint32_t draws) {
+        glFinish();
+        const double seconds = std::chrono::duration<double>(Clock::now() - measureStart).count();
+        static constexpr std::array<const char*, kScenarioCount> kNames{"naive", "instanced", "instanced x64"};
+
+        std::cout << std::left << std::setw(16) << kNames[scenario] << std::right
+                  << std::fixed << std::setprecision(3)
+                  << std::setw(14) << submitSeconds * 1000.0 / kMeasuredFrames
+                  << std::setw(14) << seconds * 1000.0 / kMeasuredFrames
+                  << std::setw(10) << draws << std::endl;
+
+        frame = 0;
+        submitSeconds = 0.0;
+        if (++scenario >= kScenarioCount) GetWindow().RequestClose();
+    }
+
+    std::vector<glm::mat4> transforms;
+    std::vector<glm::u8vec4> colors;
+    glm::mat4 viewProjection{1.0f};
+    int scenario = 0;
+    int frame = 0;
+    Clock::time_point measureStart{};
+    double submitSeconds = 0.0;
+
+    std::unique_ptr<VertexBuffer> naiveVertices;
+    std::unique_ptr<IndexBuffer> naiveIndices;
+    std::unique_ptr<VertexArray> naiveVao;
+    std::unique_ptr<InstancedMesh> mesh;
+    std::unique_ptr<Shader> naiveShader;
+    std::unique_ptr<Shader> instancedShader;
+};
+
+int main() {
+    constexpr AppProperties props{ "Instancing Benchmark", 800, 600, VSyncMode::Off };
+    const std::unique_ptr<InstancingBench> bench = std::make_unique<InstancingBench>(props);
+    bench->Run();
+
+    return 0;
+}
@@ -0,0 +1,14 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec2 aUV;
+
+uniform mat4 uViewProjection;
+uniform vec4 uTranslationScale;
+
+out vec3 vNormal;
+
+void main() {
+    vNormal = aNormal;
+    gl_Position = uViewProjection * vec4(aPos * uTranslationScale.w + uTranslationScale.xyz, 1.0);
+}
@@ -0,0 +1,184 @@
+//
+// Created by niek on 11/16/2025.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <GLCore/App.h>
+#include <GLCore/Caps.h>
+#include <GLCore/MeshLod.h>
+#include <GLCore/Shader.h>
+#include <GLCore/VertexArray.h>
+#include <gtc/matrix_transform.hpp>
+using namespace GLCore;
+
+/**
+ * Flies a camera over a kGrid x kGrid field of bumpy spheres (65k triangles each) with a generated LOD chain.
+ * Scenarios: LOD 0 everywhere, screen-space LOD selection without hysteresis, and with hysteresis.
+ * Reports triangles per frame before/after selection, LOD switches per frame and frame time.
+ */
+class MeshLodBench final : public App {
+public:
+    using App::App;
+
+protected:
+    void OnInit() override {
+        MeshData mesh = BuildBumpySphere(256, 128);
+        const auto lodStart = Clock::now();
+        lods = GenerateLods(mesh, LodSettings{.maxLods = 8, .maxError = 0.1f});
+        const double lodMs = std::chrono::duration<double, std::milli>(Clock::now() - lodStart).count();
+
+        vertices = std::make_unique<VertexBuffer>(mesh.vertices, BufferUsage::Static, "LOD vertices");
+        indices = std::make_unique<IndexBuffer>(mesh.indices, BufferUsage::Static, "LOD indices");
+        vao = std::make_unique<VertexArray>("LOD VAO");
+        vao->SetVertexBuffer(0, *vertices);
+        vao->SetIndexBuffer(*indices);
+        shader = std::make_unique<Shader>("assets/lod.vert", "assets/lod.frag");
+        currentLods.assign(kGrid * kGrid, 0);
+
+        std::cout << "GL " << Caps::Get().version << " (" << Caps::Get().renderer << ")\n"
+                  << "GenerateLods: " << std::fixed << std::setprecision(1) << lodMs << " ms for " << lods.size() << " levels\n";
+        for (std::size_t i = 0; i < lods.size(); ++i)
+            std::cout << "  LOD " << i << ": " << std::setw(7) << lods[i].indexCount / 3 << " triangles, error "
+                      << std::setprecision(5) << lods[i].error << '\n';
+        std::cout << '\n' << std::left << std::setw(18) << "scenario" << std::right
+                  << std::setw(14) << "tris full" << std::setw(14) << "tris drawn" << std::setw(12) << "switches"
+                  << std::setw(12) << "frame ms" << std::endl;
+        glEnable(GL_DEPTH_TEST);
+        glEnable(GL_CULL_FACE);
+    }
+
+    void OnShutdown() override {
+        vao.reset();
+        indices.reset();
+        vertices.reset();
+        shader.reset();
+    }
+
+    void OnUpdate() override { }
+
+    void OnRender() override {
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        if (scenario >= 3) return;
+
+        // Same camera path in every scenario
+        constexpr float fovY = glm::radians(60.0f);
+        const float t = static_cast<float>(frame) / static_cast<float>(kWarmupFrames + kMeasuredFrames);
+        const glm::vec3 eye(0.0f, 6.0f, 10.0f - t * kSpacing * kGrid);
+        const glm::mat4 viewProjection = glm::perspective(fovY, 800.0f / 600.0f, 0.1f, 1000.0f)
+                                         * glm::lookAt(eye, eye + glm::vec3(0.0f, -0.3f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+        LodSelector selector(1.0f, scenario == 2 ? 0.25f : 0.0f);
+        selector.SetProjection(fovY, 600.0f);
+        selector.BeginFrame();
+
+        shader->Bind();
+        shader->SetMat4("uViewProjection", viewProjection);
+        vao->Bind();
+        const GLint translationScale = glGetUniformLocation(shader->ID(), "uTranslationScale");
+        for (std::uint32_t i = 0; i < kGrid * kGrid; ++i) {
+            const glm::vec3 position(static_cast<float>(i % kGrid) * kSpacing - kGrid * kSpacing * 0.5f, 0.0f,
+                                     -static_cast<float>(i / kGrid) * kSpacing);
+            const float distance = std::max(glm::length(position - eye) - kScale, 0.0f);
+            std::uint32_t lod = selector.Select(lods, distance, kScale, currentLods[i]);
+            if (scenario == 0) lod = 0;
+            currentLods[i] = lod;
+
+            glUniform4f(translationScale, position.x, position.y, position.z, kScale);
+            glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(lods[lod].indexCount), GL_UNSIGNED_INT,
+                           reinterpret_cast<const void*>(static_cast<std::uintptr_t>(lods[lod].firstIndex) * sizeof(std::uint32_t)));
+        }
+
+        ++frame;
+        if (frame <= kWarmupFrames) {
+            if (frame == kWarmupFrames) {
+                glFinish();
+                measureStart = Clock::now();
+            }
+            return;
+        }
+
+        const LodSelector::Stats& stats = selector.GetStats();
+        trianglesFull += stats.trianglesFull;
+        trianglesDrawn += scenario == 0 ? stats.trianglesFull : stats.trianglesSelected;
+        switches += scenario == 0 ? 0 : stats.switches;
+        if (frame == kWarmupFrames + kMeasuredFrames) FinishScenario();
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::uint32_t kGrid = 24;
+    static constexpr float kSpacing = 3.0f;
+    static constexpr float kScale = 1.0f;
+    static constexpr int kWarmupFrames = 20;
+    static constexpr int kMeasuredFrames = 300;
+
+    static MeshData BuildBumpySphere(const std::uint32_t segments, const std::uint32_t rings) {
+        MeshData mesh;
+        for (std::uint32_t r = 0; r <= rings; ++r) {
+            const float phi = 3.14159265f * static_cast<float>(r) / static_cast<float>(rings);
+            for (std::uint32_t s = 0; s <= segments; ++s) {
+                const float theta = 6.2831853f * static_cast<float>(s) / static_cast<float>(segments);
+                MeshVertex& v = mesh.vertices.emplace_back();
+                v.normal = {std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta)};
+                v.position = v.normal * (1.0f + 0.06f * std::sin(theta * 9.0f) * std::sin(phi * 7.0f));
+                v.uv = {static_cast<float>(s) / static_cast<float>(segments), static_cast<float>(r) / static_cast<float>(rings)};
+            }
+        }
+        for (std::uint32_t r = 0; r < rings; ++r) {
+            for (std::uint32_t s = 0; s < segments; ++s) {
+                const std::uint32_t a = r * (segments + 1) + s, b = a + segments + 1;
+                mesh.indices.insert(mesh.indices.end(), {a, a + 1, b, a + 1, b + 1, b});
+            }
+        }
+        return mesh;
+    }
+
+    void FinishScenario() {
+        glFinish();
+        const double seconds = std::chrono::duration<double>(Clock::now() - measureStart).count();
+        static constexpr const char* kNames[] = {"LOD 0", "LOD", "LOD + hysteresis"};
+
+        std::cout << std::left << std::setw(18) << kNames[scenario] << std::right
+                  << std::setw(14) << trianglesFull / kMeasuredFrames
+                  << std::setw(14) << trianglesDrawn / kMeasuredFrames
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(12) << static_cast<double>(switches) / kMeasuredFrames
+                  << std::setprecision(3)
+                  << std::setw(12) << seconds * 1000.0 / kMeasuredFrames << std::endl;
+
+        frame = 0;
+        trianglesFull = trianglesDrawn = switches = 0;
+        currentLods.assign(kGrid * kGrid, 0);
+        if (++scenario >= 3) GetWindow().RequestClose();
+    }
+
+    std::vector<MeshLod> lods;
+    std::vector<std::uint32_t> currentLods;
+    int scenario = 0;
+    int frame = 0;
+    Clock::time_point measureStart{};
+    std::uint64_t trianglesFull = 0;
+    std::uint64_t trianglesDrawn = 0;
+    std::uint64_t switches = 0;
+
+    std::unique_ptr<VertexBuffer> vertices;
+    std::unique_ptr<IndexBuffer> indices;
+    std::unique_ptr<VertexArray> vao;
+    std::unique_ptr<Shader> shader;
+};
+
+int main() {
+    constexpr AppProperties props{ "Mesh LOD Benchmark", 800, 600, VSyncMode::Off };
+    const std::unique_ptr<MeshLodBench> bench = std::make_unique<MeshLodBench>(props);
+    bench->Run();
+
+    return 0;
+}
@@ -0,0 +1,16 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+
+uniform mat4 uViewProjection;
+uniform mat4 uModel;
+uniform vec4 uColor;
+
+out vec3 vNormal;
+out vec4 vColor;
+
+void main() {
+    vNormal = mat3(uModel) * aNormal;
+    vColor = uColor;
+    gl_Position = uViewProjection * uModel * vec4(aPos, 1.0);
+}
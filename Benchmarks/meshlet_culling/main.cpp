@@ -0,0 +1,210 @@
+//
+// Created by niek on 11/17/2025.
+//
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+#include <GLCore/App.h>
+#include <GLCore/Caps.h>
+#include <GLCore/Meshlet.h>
+#include <GLCore/Shader.h>
+#include <gtc/matrix_transform.hpp>
+using namespace GLCore;
+
+// Matches DrawData in mesh_indirect.vert (std430 stride 80)
+struct DrawData {
+    glm::mat4 model;
+    glm::vec4 color;
+};
+
+/**
+ * Walks a camera through a kGrid x kGrid field of bumpy spheres (16k triangles, ~180 meshlets each), all drawn
+ * through IndirectDrawList from one GeometryPool. Compares per-object frustum culling of whole meshes with
+ * MeshletCuller (per-meshlet frustum + backface cone culling, adjacent survivors merged into one command).
+ * Reports CPU cull + submit time, frame time, triangles submitted and draw commands per frame.
+ */
+class MeshletCullingBench final : public App {
+public:
+    using App::App;
+
+protected:
+    void OnInit() override {
+        const MeshData sphere = BuildBumpySphere(128, 64);
+        const auto buildStart = Clock::now();
+        meshlets = BuildMeshlets(sphere);
+        const double buildMs = std::chrono::duration<double, std::milli>(Clock::now() - buildStart).count();
+
+        pool = std::make_unique<GeometryPool>(VertexFormat::Of<MeshVertex>(), static_cast<std::uint32_t>(sphere.vertices.size()),
+                                              static_cast<std::uint32_t>(meshlets.indices.size()), "Meshlet pool");
+        mesh = pool->Add(sphere.vertices, meshlets.indices);
+
+        std::mt19937 rng(11);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        for (std::uint32_t i = 0; i < kGrid * kGrid; ++i) {
+            const glm::vec3 position((static_cast<float>(i % kGrid) - kGrid * 0.5f) * kSpacing, 0.0f,
+                                     (static_cast<float>(i / kGrid) - kGrid * 0.5f) * kSpacing);
+            DrawData& draw = draws.emplace_back();
+            draw.model = glm::rotate(glm::translate(glm::mat4(1.0f), position), unit(rng) * 6.28f, glm::vec3(0.0f, 1.0f, 0.0f));
+            draw.color = {0.4f + 0.6f * unit(rng), 0.4f + 0.6f * unit(rng), 0.4f + 0.6f * unit(rng), 1.0f};
+        }
+
+        drawList = std::make_unique<IndirectDrawList>(sizeof(DrawData), kMaxDraws, 0, "Meshlet draws");
+        drawList->AttachDrawID(pool->GetVertexArray(), 3);
+        loopShader = std::make_unique<Shader>("assets/mesh_loop.vert", "assets/mesh.frag");
+        if (drawList->IsIndirect()) indirectShader = std::make_unique<Shader>("assets/mesh_indirect.vert", "assets/mesh.frag");
+
+        std::cout << "GL " << Caps::Get().version << " (" << Caps::Get().renderer << ")\n"
+                  << "BuildMeshlets: " << std::fixed << std::setprecision(1) << buildMs << " ms, "
+                  << meshlets.meshlets.size() << " meshlets for " << meshlets.indices.size() / 3 << " triangles\n"
+                  << kGrid * kGrid << " instances, " << kMeasuredFrames << " frames per scenario"
+                  << (drawList->IsIndirect() ? " (multi-draw indirect)" : " (3.3 fallback loop)") << "\n\n"
+                  << std::left << std::setw(14) << "scenario" << std::right
+                  << std::setw(10) << "cpu ms" << std::setw(10) << "frame ms" << std::setw(12) << "tris"
+                  << std::setw(10) << "draws" << std::endl;
+        glEnable(GL_DEPTH_TEST);
+        glEnable(GL_CULL_FACE);
+    }
+
+    void OnShutdown() override {
+        drawList.reset();
+        pool.reset();
+        indirectShader.reset();
+        loopShader.reset();
+    }
+
+    void OnUpdate() override { }
+
+    void OnRender() override {
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        if (scenario >= 2) return;
+
+        // Same path in both scenarios: a slow turn at eye level inside the field
+        const float angle = static_cast<float>(frame) * 0.01f;
+        const glm::vec3 eye(std::cos(angle * 0.5f) * 8.0f, 1.5f, std::sin(angle * 0.5f) * 8.0f);
+        const glm::mat4 viewProjection = glm::perspective(glm::radians(60.0f), 800.0f / 600.0f, 0.1f, 500.0f)
+                                         * glm::lookAt(eye, eye + glm::vec3(std::cos(angle), -0.1f, std::sin(angle)),
+                                                       glm::vec3(0.0f, 1.0f, 0.0f));
+        const Frustum frustum(viewProjection);
+
+        const auto cpuStart = Clock::now();
+        std::uint64_t triangles = 0;
+        if (scenario == 0) {
+            const MeshRange& range = pool->GetRange(mesh);
+            drawList->Begin(frustum);
+            for (const DrawData& draw : draws) {
+                const BoundingSphere bounds{glm::vec3(draw.model * glm::vec4(meshlets.bounds.center, 1.0f)), meshlets.bounds.radius};
+                if (drawList->Add(0, range, bounds, draw)) triangles += range.indexCount / 3;
+            }
+        } else {
+            drawList->Begin();
+            culler.Begin(frustum, eye);
+            for (const DrawData& draw : draws) culler.Cull(meshlets, pool->GetRange(mesh), draw.model, *drawList, 0, draw);
+            triangles = culler.GetStats().trianglesSubmitted;
+        }
+        drawList->Upload();
+
+        const Shader& shader = indirectShader ? *indirectShader : *loopShader;
+        shader.Bind();
+        shader.SetMat4("uViewProjection", viewProjection);
+        pool->Bind();
+        drawList->Submit(0, GL_TRIANGLES, [&shader](std::uint32_t, const void* data) {
+            const auto* draw = static_cast<const DrawData*>(data);
+            shader.SetMat4("uModel", draw->model);
+            shader.SetVec4("uColor", draw->color);
+        });
+        drawList->End();
+        const auto cpuEnd = Clock::now();
+
+        ++frame;
+        if (frame <= kWarmupFrames) {
+            if (frame == kWarmupFrames) {
+                glFinish();
+                measureStart = Clock::now();
+            }
+            return;
+        }
+
+        cpuSeconds += std::chrono::duration<double>(cpuEnd - cpuStart).count();
+        trianglesTotal += triangles;
+        drawsTotal += drawList->GetStats().draws;
+        if (frame == kWarmupFrames + kMeasuredFrames) FinishScenario();
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::uint32_t kGrid = 32;
+    static constexpr float kSpacing = 3.0f;
+    static constexpr std::uint32_t kMaxDraws = 128 * 1024;
+    static constexpr int kWarmupFrames = 30;
+    static constexpr int kMeasuredFrames = 300;
+
+    static MeshData BuildBumpySphere(const std::uint32_t segments, const std::uint32_t rings) {
+        MeshData sphere;
+        for (std::uint32_t r = 0; r <= rings; ++r) {
+            const float phi = 3.14159265f * static_cast<float>(r) / static_cast<float>(rings);
+            for (std::uint32_t s = 0; s <= segments; ++s) {
+                const float theta = 6.2831853f * static_cast<float>(s) / static_cast<float>(segments);
+                MeshVertex& v = sphere.vertices.emplace_back();
+                v.normal = {std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta)};
+                v.position = v.normal * (1.0f + 0.06f * std::sin(theta * 9.0f) * std::sin(phi * 7.0f));
+                v.uv = {static_cast<float>(s) / static_cast<float>(segments), static_cast<float>(r) / static_cast<float>(rings)};
+            }
+        }
+        for (std::uint32_t r = 0; r < rings; ++r) {
+            for (std::uint32_t s = 0; s < segments; ++s) {
+                const std::uint32_t a = r * (segments + 1) + s, b = a + segments + 1;
+                sphere.indices.insert(sphere.indices.end(), {a, a + 1, b, a + 1, b + 1, b});
+            }
+        }
+        return sphere;
+    }
+
+    void FinishScenario() {
+        glFinish();
+        const double seconds = std::chrono::duration<double>(Clock::now() - measureStart).count();
+
+        std::cout << std::left << std::setw(14) << (scenario == 0 ? "mesh cull" : "meshlet cull") << std::right
+                  << std::fixed << std::setprecision(3)
+                  << std::setw(10) << cpuSeconds * 1000.0 / kMeasuredFrames
+                  << std::setw(10) << seconds * 1000.0 / kMeasuredFrames
+                  << std::setw(12) << trianglesTotal / kMeasuredFrames
+                  << std::setw(10) << drawsTotal / kMeasuredFrames << std::endl;
+
+        frame = 0;
+        cpuSeconds = 0.0;
+        trianglesTotal = 0;
+        drawsTotal = 0;
+        if (++scenario >= 2) GetWindow().RequestClose();
+    }
+
+    MeshletMesh meshlets;
+    MeshHandle mesh;
+    std::vector<DrawData> draws;
+    MeshletCuller culler;
+    int scenario = 0;
+    int frame = 0;
+    Clock::time_point measureStart{};
+    double cpuSeconds = 0.0;
+    std::uint64_t trianglesTotal = 0;
+    std::uint64_t drawsTotal = 0;
+
+    std::unique_ptr<GeometryPool> pool;
+    std::unique_ptr<IndirectDrawList> drawList;
+    std::unique_ptr<Shader> loopShader;
+    std::unique_ptr<Shader> indirectShader;
+};
+
+int main() {
+    constexpr AppProperties props{ "Meshlet Culling Benchmark", 800, 600, VSyncMode::Off };
+    const std::unique_ptr<MeshletCullingBench> bench = std::make_unique<MeshletCullingBench>(props);
+    bench->Run();
+
+    return 0;
+}
@@ -0,0 +1,224 @@
+//
+// Created by niek on 11/19/2025.
+//
+
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <GLCore/App.h>
+#include <GLCore/Caps.h>
+#include <GLCore/ObjLoader.h>
+#include <GLCore/Shader.h>
+#include <GLCore/VertexArray.h>
+#include <gtc/matrix_transform.hpp>
+using namespace GLCore;
+
+/**
+ * Writes a kGrid x kGrid terrain (~80 MB of v / vt / vn / f text, one group per band of rows) and loads it three ways:
+ * a textbook ifstream + istringstream + unordered_map loader, LoadObj on a one-worker pool and LoadObj on the shared
+ * pool. The file is freshly written, so reads hit a warm page cache: the numbers measure parsing, not the disk.
+ * Reports best-of-kRuns ms and MB/s per loader, then uploads the mesh and draws it for a few frames.
+ */
+class ObjLoadBench final : public App {
+public:
+    using App::App;
+
+protected:
+    void OnInit() override {
+        const std::size_t bytes = WriteTerrain();
+
+        std::cout << "GL " << Caps::Get().version << " (" << Caps::Get().renderer << ")\n"
+                  << std::fixed << std::setprecision(1) << static_cast<double>(bytes) / (1024.0 * 1024.0) << " MB OBJ, best of "
+                  << kRuns << " loads per row\n\n"
+                  << std::left << std::setw(18) << "loader" << std::right << std::setw(9) << "threads"
+                  << std::setw(11) << "parse ms" << std::setw(11) << "merge ms" << std::setw(11) << "dedup ms"
+                  << std::setw(11) << "total ms" << std::setw(10) << "MB/s" << std::endl;
+
+        double naiveMs = 0.0;
+        for (int run = 0; run < kRuns; ++run) {
+            const auto start = Clock::now();
+            const MeshData naive = NaiveLoad(kFileName);
+            const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            if (run == 0 || ms < naiveMs) naiveMs = ms;
+        }
+        std::cout << std::left << std::setw(18) << "istream" << std::right << std::setw(9) << 1
+                  << std::setw(11) << "-" << std::setw(11) << "-" << std::setw(11) << "-" << std::setprecision(2)
+                  << std::setw(11) << naiveMs << std::setprecision(0) << std::setw(10)
+                  << static_cast<double>(bytes) / (1024.0 * 1024.0) / (naiveMs / 1000.0) << std::endl;
+
+        ThreadPool single(1);
+        Report("LoadObj", single);
+        Report("LoadObj (shared)", ThreadPool::Shared());
+
+        vertices = std::make_unique<VertexBuffer>(mesh.vertices, BufferUsage::Static, "OBJ vertices");
+        indices = std::make_unique<IndexBuffer>(mesh.indices, BufferUsage::Static, "OBJ indices");
+        vao = std::make_unique<VertexArray>("OBJ VAO");
+        vao->SetVertexBuffer(0, *vertices);
+        vao->SetIndexBuffer(*indices);
+        std::cout << '\n' << mesh.vertices.size() << " vertices, " << mesh.indices.size() / 3 << " triangles, "
+                  << mesh.groups.size() << " groups" << std::endl;
+
+        shader = std::make_unique<Shader>("assets/model.vert", "assets/model.frag");
+        glEnable(GL_DEPTH_TEST);
+    }
+
+    void OnShutdown() override {
+        vao.reset();
+        indices.reset();
+        vertices.reset();
+        shader.reset();
+    }
+
+    void OnUpdate() override { }
+
+    void OnRender() override {
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+        shader->Bind();
+        shader->SetMat4("uViewProjection", glm::perspective(glm::radians(60.0f), 800.0f / 600.0f, 0.1f, 100.0f)
+                                           * glm::lookAt(glm::vec3(0.0f, 6.0f, 9.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f)));
+        shader->SetMat4("uModel", glm::mat4(1.0f));
+        vao->Bind();
+        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(mesh.indices.size()), GL_UNSIGNED_INT, nullptr);
+
+        if (++frame >= kDrawFrames) GetWindow().RequestClose();
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr int kGrid = 720;
+    static constexpr int kGroupRows = 90;
+    static constexpr int kRuns = 3;
+    static constexpr int kDrawFrames = 60;
+    static constexpr const char* kFileName = "bench_terrain.obj";
+
+    // Quads with separate v / vt / vn streams, the way DCC exporters write them
+    static std::size_t WriteTerrain() {
+        std::string text;
+        char number[32];
+        const auto append = [&](const float value) {
+            text += ' ';
+            text.append(number, std::to_chars(number, number + sizeof(number), value, std::chars_format::fixed, 6).ptr);
+        };
+        const auto height = [](const float x, const float z) {
+            return 0.4f * std::sin(x * 1.7f) * std::cos(z * 1.3f) + 0.1f * std::sin(x * 7.0f + z * 5.0f);
+        };
+
+        for (int z = 0; z < kGrid; ++z) {
+            for (int x = 0; x < kGrid; ++x) {
+                const float px = (static_cast<float>(x) / (kGrid - 1) - 0.5f) * 10.0f;
+                const float pz = (static_cast<float>(z) / (kGrid - 1) - 0.5f) * 10.0f;
+                const glm::vec3 normal = glm::normalize(glm::vec3(height(px - 0.01f, pz) - height(px + 0.01f, pz), 0.02f,
+                                                                  height(px, pz - 0.01f) - height(px, pz + 0.01f)));
+                text += 'v';
+                append(px);
+                append(height(px, pz));
+                append(pz);
+                text += "\nvt";
+                append(static_cast<float>(x) / (kGrid - 1));
+                append(static_cast<float>(z) / (kGrid - 1));
+                text += "\nvn";
+                append(normal.x);
+                append(normal.y);
+                append(normal.z);
+                text += '\n';
+            }
+        }
+        for (int z = 0; z + 1 < kGrid; ++z) {
+            if (z % kGroupRows == 0) text += "g rows_" + std::to_string(z) + '\n';
+            for (int x = 0; x + 1 < kGrid; ++x) {
+                const int a = z * kGrid + x + 1, b = a + kGrid;
+                text += 'f';
+                for (const int corner : {a, a + 1, b + 1, b}) {
+                    const std::string index = std::to_string(corner);
+                    text += ' ' + index + '/' + index + '/' + index;
+                }
+                text += '\n';
+            }
+        }
+
+        std::ofstream(kFileName, std::ios::binary).write(text.data(), static_cast<std::streamsize>(text.size()));
+        return text.size();
+    }
+
+    // The usual tutorial loader, as the baseline: getline + istringstream per line, std::unordered_map dedup
+    static MeshData NaiveLoad(const char* path) {
+        std::ifstream file(path);
+        std::vector<glm::vec3> positions, normals;
+        std::vector<glm::vec2> uvs;
+        std::unordered_map<std::string, std::uint32_t> corners;
+        MeshData result;
+
+        std::string line, tag, corner;
+        while (std::getline(file, line)) {
+            std::istringstream in(line);
+            in >> tag;
+            if (tag == "v") {
+                glm::vec3& p = positions.emplace_back();
+                in >> p.x >> p.y >> p.z;
+            } else if (tag == "vt") {
+                glm::vec2& t = uvs.emplace_back();
+                in >> t.x >> t.y;
+            } else if (tag == "vn") {
+                glm::vec3& n = normals.emplace_back();
+                in >> n.x >> n.y >> n.z;
+            } else if (tag == "f") {
+                std::vector<std::uint32_t> polygon;
+                while (in >> corner) {
+                    const auto [it, inserted] = corners.try_emplace(corner, static_cast<std::uint32_t>(result.vertices.size()));
+                    if (inserted) {
+                        int p = 0, t = 0, n = 0;
+                        char slash;
+                        std::istringstream(corner) >> p >> slash >> t >> slash >> n;
+                        result.vertices.push_back({positions[p - 1], normals[n - 1], uvs[t - 1]});
+                    }
+                    polygon.push_back(it->second);
+                }
+                for (std::size_t i = 2; i < polygon.size(); ++i)
+                    result.indices.insert(result.indices.end(), {polygon[0], polygon[i - 1], polygon[i]});
+            }
+        }
+        return result;
+    }
+
+    void Report(const char* name, ThreadPool& pool) {
+        ObjLoadStats best{};
+        for (int run = 0; run < kRuns; ++run) {
+            ObjLoadStats stats;
+            MeshData loaded = LoadObj(kFileName, pool, &stats);
+            if (run == 0 || stats.totalMs < best.totalMs) best = stats;
+            mesh = std::move(loaded);
+        }
+
+        std::cout << std::left << std::setw(18) << name << std::right << std::setw(9) << best.threads
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(11) << best.parseMs << std::setw(11) << best.mergeMs << std::setw(11) << best.dedupMs
+                  << std::setw(11) << best.totalMs << std::setprecision(0) << std::setw(10) << best.megabytesPerSecond << std::endl;
+    }
+
+    MeshData mesh;
+    int frame = 0;
+
+    std::unique_ptr<VertexBuffer> vertices;
+    std::unique_ptr<IndexBuffer> indices;
+    std::unique_ptr<VertexArray> vao;
+    std::unique_ptr<Shader> shader;
+};
+
+int main() {
+    constexpr AppProperties props{ "OBJ Load Benchmark", 800, 600, VSyncMode::Off };
+    const std::unique_ptr<ObjLoadBench> bench = std::make_unique<ObjLoadBench>(props);
+    bench->Run();
+
+    return 0;
+}
@@ -0,0 +1,136 @@
+//
+// Created by niek on 11/13/2025.
+//
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+#include <GLCore/App.h>
+#include <GLCore/SpriteBatch.h>
+#include <gtc/matrix_transform.hpp>
+using namespace GLCore;
+
+/**
+ * Draws kSprites random sprites per frame over 64 distinct images, stored two ways:
+ * - packed: 4 texture arrays with 16 layers each
+ * - separate: 64 single-layer textures (one batch break per image)
+ * Reports sprites/sec of SpriteBatch::End() and draw calls per frame.
+ */
+class SpriteBatchBench final : public App {
+public:
+    using App::App;
+
+protected:
+    void OnInit() override {
+        batch = std::make_unique<SpriteBatch>(kSprites);
+
+        // Same 64 procedural images, once as 4x16 array layers and once as 64 separate arrays
+        for (int a = 0; a < 4; ++a) packedTextures.push_back(CreateArray(16, a * 16));
+        for (int i = 0; i < 64; ++i) separateTextures.push_back(CreateArray(1, i));
+
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> x(0.0f, 800.0f), y(0.0f, 600.0f), size(2.0f, 12.0f), angle(0.0f, 6.28f);
+        std::uniform_int_distribution<int> image(0, 63), channel(64, 255);
+        sprites.resize(kSprites);
+        images.resize(kSprites);
+        for (std::size_t i = 0; i < kSprites; ++i) {
+            Sprite& s = sprites[i];
+            s.position = {x(rng), y(rng)};
+            s.size = glm::vec2(size(rng));
+            s.rotation = i % 4 == 0 ? angle(rng) : 0.0f;
+            s.color = {channel(rng), channel(rng), channel(rng), 255};
+            images[i] = image(rng);
+        }
+
+        std::cout << "Drawing " << kSprites << " sprites/frame over 64 images, " << kMeasuredFrames << " frames per scenario\n\n"
+                  << std::left << std::setw(12) << "scenario" << std::right << std::setw(16) << "Msprites/s"
+                  << std::setw(14) << "End() ms" << std::setw(12) << "draws" << std::setw(12) << "binds" << std::endl;
+    }
+
+    void OnShutdown() override {
+        glDeleteTextures(static_cast<GLsizei>(packedTextures.size()), packedTextures.data());
+        glDeleteTextures(static_cast<GLsizei>(separateTextures.size()), separateTextures.data());
+        batch.reset();
+    }
+
+    void OnUpdate() override { }
+
+    void OnRender() override {
+        glClearColor(0.05f, 0.05f, 0.08f, 1.0f);
+        if (scenario >= 2) return;
+
+        const bool packed = scenario == 0;
+        const auto start = std::chrono::steady_clock::now();
+        batch->Begin(glm::ortho(0.0f, 800.0f, 0.0f, 600.0f));
+        for (std::size_t i = 0; i < kSprites; ++i) {
+            Sprite s = sprites[i];
+            s.texture = packed ? packedTextures[images[i] / 16] : separateTextures[images[i]];
+            s.layer = static_cast<std::uint16_t>(packed ? images[i] % 16 : 0);
+            batch->Draw(s);
+        }
+        batch->End();
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        if (++frame <= kWarmupFrames) return;
+        submitMs += ms;
+        endMs += batch->GetStats().cpuMs;
+        if (frame == kWarmupFrames + kMeasuredFrames) {
+            const SpriteBatch::Stats& stats = batch->GetStats();
+            std::cout << std::left << std::setw(12) << (packed ? "packed" : "separate") << std::right << std::fixed
+                      << std::setprecision(2) << std::setw(16) << kSprites * kMeasuredFrames / (submitMs * 1000.0)
+                      << std::setprecision(3) << std::setw(14) << endMs / kMeasuredFrames
+                      << std::setw(12) << stats.drawCalls << std::setw(12) << stats.textureBinds << std::endl;
+            frame = 0;
+            submitMs = endMs = 0.0;
+            if (++scenario >= 2) GetWindow().RequestClose();
+        }
+    }
+
+private:
+    static constexpr std::size_t kSprites = 100000;
+    static constexpr int kWarmupFrames = 20;
+    static constexpr int kMeasuredFrames = 200;
+
+    static unsigned int CreateArray(const int layers, const int firstImage) {
+        constexpr int size = 16;
+        std::vector<std::uint32_t> pixels(static_cast<std::size_t>(size * size * layers));
+        for (int l = 0; l < layers; ++l) {
+            const int img = firstImage + l;
+            for (int p = 0; p < size * size; ++p) {
+                const bool checker = ((p % size) / 4 + (p / size) / 4) % 2 == 0;
+                const std::uint32_t r = (img * 37) & 0xFF, g = (img * 91) & 0xFF, b = checker ? 255 : 64;
+                pixels[static_cast<std::size_t>(l * size * size + p)] = 0xFF000000u | b << 16 | g << 8 | r;
+            }
+        }
+        unsigned int texture = 0;
+        glGenTextures(1, &texture);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+        glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, size, size, layers, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+        return texture;
+    }
+
+    std::unique_ptr<SpriteBatch> batch;
+    std::vector<unsigned int> packedTextures;
+    std::vector<unsigned int> separateTextures;
+    std::vector<Sprite> sprites;
+    std::vector<int> images;
+
+    int scenario = 0;
+    int frame = 0;
+    double submitMs = 0.0;
+    double endMs = 0.0;
+};
+
+int main() {
+    constexpr AppProperties props{ "SpriteBatch Benchmark", 800, 600, VSyncMode::Off };
+    const std::unique_ptr<SpriteBatchBench> bench = std::make_unique<SpriteBatchBench>(props);
+    bench->Run();
+
+    return 0;
+}
@@ -0,0 +1,7 @@
+#version 330 core
+layout (location = 0) in vec4 aPoint;
+
+void main() {
+    gl_Position = vec4(aPoint.xyz, 1.0);
+    gl_PointSize = 1.0;
+}
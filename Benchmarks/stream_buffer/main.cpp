@@ -0,0 +1,146 @@
+//
+// Created by niek on 11/11/2025.
+//
+
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+#include <GLCore/App.h>
+#include <GLCore/Caps.h>
+#include <GLCore/Shader.h>
+#include <GLCore/StreamBuffer.h>
+#include <GLCore/VertexArray.h>
+using namespace GLCore;
+
+struct Point {
+    glm::vec4 position;
+    using Layout = VertexLayout<Attrib<glm::vec4>>;
+};
+
+/**
+ * Streams kBytesPerFrame of points every frame with each StreamBuffer strategy and draws them,
+ * so the GPU actually consumes the data. Reports sustained upload throughput per strategy.
+ */
+class StreamBufferBench final : public App {
+public:
+    using App::App;
+
+protected:
+    void OnInit() override {
+        if (Caps::Get().bufferStorage) strategies.push_back(StreamStrategy::PersistentMapped);
+        strategies.push_back(StreamStrategy::Orphaning);
+        strategies.push_back(StreamStrategy::SubData);
+
+        // Source payload, copied into the stream each frame as a real producer would
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+        source.resize(kPointsPerFrame);
+        for (Point& p : source) p.position = {dist(rng), dist(rng), 0.0f, 1.0f};
+
+        shader = std::make_unique<Shader>("assets/points.vert", "assets/points.frag");
+        vao = std::make_unique<VertexArray>("StreamBuffer bench VAO");
+        StartStrategy();
+
+        std::cout << "GL " << Caps::Get().version << " (" << Caps::Get().renderer << ")\n"
+                  << "Streaming " << kBytesPerFrame / (1024 * 1024) << " MB/frame, " << kMeasuredFrames << " frames per strategy\n\n"
+                  << std::left << std::setw(18) << "strategy" << std::right
+                  << std::setw(12) << "MB/s" << std::setw(16) << "upload ms/frm" << std::setw(14) << "wait ms/frm"
+                  << std::setw(8) << "stalls" << std::endl;
+    }
+
+    void OnShutdown() override {
+        stream.reset();
+        vao.reset();
+        shader.reset();
+    }
+
+    void OnUpdate() override { }
+
+    void OnRender() override {
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        if (current >= strategies.size()) return;
+
+        const auto uploadStart = Clock::now();
+        stream->BeginFrame();
+        const StreamAllocation allocation = stream->Allocate(kBytesPerFrame, sizeof(Point));
+        std::memcpy(allocation.data, source.data(), kBytesPerFrame);
+        stream->Flush();
+        const auto uploadEnd = Clock::now();
+
+        vao->RebindVertexBuffer(0, stream->ID(), allocation.offset);
+        shader->Bind();
+        vao->Bind();
+        glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(kPointsPerFrame));
+        stream->EndFrame();
+
+        ++frame;
+        if (frame <= kWarmupFrames) {
+            if (frame == kWarmupFrames) {
+                glFinish();
+                measureStart = Clock::now();
+            }
+            return;
+        }
+
+        uploadSeconds += std::chrono::duration<double>(uploadEnd - uploadStart).count();
+        waitMs += stream->GetStats().waitMs;
+        if (frame == kWarmupFrames + kMeasuredFrames) FinishStrategy();
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::size_t kBytesPerFrame = 8 * 1024 * 1024;
+    static constexpr std::size_t kPointsPerFrame = kBytesPerFrame / sizeof(Point);
+    static constexpr int kWarmupFrames = 30;
+    static constexpr int kMeasuredFrames = 300;
+
+    void StartStrategy() {
+        stream = std::make_unique<StreamBuffer>(kBytesPerFrame, 3, strategies[current]);
+        vao->SetVertexFormat(0, VertexFormat::Of<Point>());
+        frame = 0;
+        uploadSeconds = 0.0;
+        waitMs = 0.0;
+    }
+
+    void FinishStrategy() {
+        glFinish();
+        const double seconds = std::chrono::duration<double>(Clock::now() - measureStart).count();
+        const double megabytes = static_cast<double>(kBytesPerFrame) * kMeasuredFrames / (1024.0 * 1024.0);
+
+        std::cout << std::left << std::setw(18) << StreamBuffer::StrategyName(strategies[current]) << std::right
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(12) << megabytes / seconds
+                  << std::setprecision(3)
+                  << std::setw(16) << uploadSeconds * 1000.0 / kMeasuredFrames
+                  << std::setw(14) << waitMs / kMeasuredFrames
+                  << std::setw(8) << stream->GetStats().stalls << std::endl;
+
+        if (++current < strategies.size()) StartStrategy();
+        else GetWindow().RequestClose();
+    }
+
+    std::vector<StreamStrategy> strategies;
+    std::vector<Point> source;
+    std::size_t current = 0;
+    int frame = 0;
+    Clock::time_point measureStart{};
+    double uploadSeconds = 0.0;
+    double waitMs = 0.0;
+
+    std::unique_ptr<StreamBuffer> stream;
+    std::unique_ptr<VertexArray> vao;
+    std::unique_ptr<Shader> shader;
+};
+
+int main() {
+    constexpr AppProperties props{ "StreamBuffer Benchmark", 800, 600, VSyncMode::Off };
+    const std::unique_ptr<StreamBufferBench> bench = std::make_unique<StreamBufferBench>(props);
+    bench->Run();
+
+    return 0;
+}
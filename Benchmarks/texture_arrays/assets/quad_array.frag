@@ -0,0 +1,10 @@
+#version 330 core
+in vec2 vUV;
+flat in uint vLayer;
+out vec4 FragColor;
+
+uniform sampler2DArray uTextures;
+
+void main() {
+    FragColor = texture(uTextures, vec3(vUV, float(vLayer)));
+}
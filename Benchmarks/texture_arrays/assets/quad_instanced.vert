@@ -0,0 +1,13 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec2 aUV;
+layout (location = 2) in mat4 aModel;   // locations 2..5, divisor 1
+
+uniform mat4 uViewProjection;
+
+out vec2 vUV;
+
+void main() {
+    vUV = aUV;
+    gl_Position = uViewProjection * aModel * vec4(aPos, 1.0);
+}
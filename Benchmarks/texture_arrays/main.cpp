@@ -0,0 +1,286 @@
+//
+// Created by niek on 11/27/2025.
+//
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+#include <GLCore/App.h>
+#include <GLCore/Caps.h>
+#include <GLCore/InstancedMesh.h>
+#include <GLCore/MipGenerator.h>
+#include <GLCore/Shader.h>
+#include <GLCore/TextureArrayPool.h>
+#include <gtc/matrix_transform.hpp>
+using namespace GLCore;
+
+struct QuadVertex {
+    glm::vec3 position;
+    glm::vec2 uv;
+    using Layout = VertexLayout<Attrib<glm::vec3>, Attrib<glm::vec2>>;
+};
+
+/**
+ * Draws kObjects textured quads per frame, each with one of kMaterials kSize x kSize textures (random assignment):
+ * - separate: one glDrawElements per quad, its Texture2D bound whenever it differs from the previous quad's
+ * - sorted: quads grouped by material, one bind + one InstancedMesh draw per material
+ * - arrays: the same textures in a TextureArrayPool; quads grouped by array, the layer as per-instance data,
+ *   one bind + one draw per array
+ * Reports CPU submission time, total frame time, draws and texture binds per frame.
+ */
+class TextureArraysBench final : public App {
+public:
+    using App::App;
+
+protected:
+    void OnInit() override {
+        constexpr std::array<QuadVertex, 4> vertices{{
+            {{-0.5f, -0.5f, 0.0f}, {0.0f, 0.0f}}, {{0.5f, -0.5f, 0.0f}, {1.0f, 0.0f}},
+            {{0.5f, 0.5f, 0.0f}, {1.0f, 1.0f}}, {{-0.5f, 0.5f, 0.0f}, {0.0f, 1.0f}},
+        }};
+        constexpr std::array<std::uint32_t, 6> indices{0, 1, 2, 0, 2, 3};
+
+        naiveVertices = std::make_unique<VertexBuffer>(vertices, BufferUsage::Static, "Naive quad vertices");
+        naiveIndices = std::make_unique<IndexBuffer>(indices, BufferUsage::Static, "Naive quad indices");
+        naiveVao = std::make_unique<VertexArray>("Naive quad VAO");
+        naiveVao->SetVertexBuffer(0, *naiveVertices);
+        naiveVao->SetIndexBuffer(*naiveIndices);
+        mesh = std::make_unique<InstancedMesh>(vertices, indices, kObjects, "Instanced quads");
+
+        naiveShader = std::make_unique<Shader>("assets/quad_naive.vert", "assets/quad.frag");
+        instancedShader = std::make_unique<Shader>("assets/quad_instanced.vert", "assets/quad.frag");
+        arrayShader = std::make_unique<Shader>("assets/quad_array.vert", "assets/quad_array.frag");
+
+        // The same mip chains as separate textures and as pool layers
+        pool = std::make_unique<TextureArrayPool>(TextureArrayPoolSettings{kLayersPerArray});
+        const auto uploadStart = Clock::now();
+        for (int m = 0; m < kMaterials; ++m) {
+            const std::vector<Image> chain = GenerateMips(MakeImage(m));
+            Texture2D& texture = textures.emplace_back(kSize, kSize, GL_SRGB8_ALPHA8, static_cast<int>(chain.size()));
+            for (int level = 0; level < texture.Levels(); ++level) {
+                const Image& image = chain[static_cast<std::size_t>(level)];
+                texture.SetSubImage(level, 0, 0, image.width, image.height, GL_RGBA, GL_UNSIGNED_BYTE, image.pixels.data());
+            }
+            slots.push_back(pool->Add(chain));
+        }
+        glFinish();
+        const double uploadMs = std::chrono::duration<double, std::milli>(Clock::now() - uploadStart).count();
+
+        // A kGrid x kGrid wall of quads with random materials
+        std::mt19937 rng(5);
+        std::uniform_int_distribution<int> material(0, kMaterials - 1);
+        for (std::uint32_t i = 0; i < kObjects; ++i) {
+            const float x = static_cast<float>(i % kGrid) - kGrid * 0.5f;
+            const float y = static_cast<float>(i / kGrid) - kGrid * 0.5f;
+            transforms.push_back(glm::scale(glm::translate(glm::mat4(1.0f), {x, y, 0.0f}), glm::vec3(0.9f)));
+            materials.push_back(material(rng));
+        }
+        byMaterial.resize(kObjects);
+        std::iota(byMaterial.begin(), byMaterial.end(), 0u);
+        std::stable_sort(byMaterial.begin(), byMaterial.end(), [this](const std::uint32_t a, const std::uint32_t b) {
+            return materials[a] < materials[b];
+        });
+        byArray = byMaterial;
+        std::stable_sort(byArray.begin(), byArray.end(), [this](const std::uint32_t a, const std::uint32_t b) {
+            return slots[static_cast<std::size_t>(materials[a])].array < slots[static_cast<std::size_t>(materials[b])].array;
+        });
+
+        const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 800.0f / 600.0f, 0.1f, 1000.0f);
+        viewProjection = projection * glm::lookAt(glm::vec3(0.0f, 0.0f, 120.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+        const TextureArrayPool::Stats& stats = pool->GetStats();
+        std::cout << "GL " << Caps::Get().version << " (" << Caps::Get().renderer << ")\n"
+                  << kMaterials << " textures of " << kSize << "x" << kSize << " in " << stats.arrays << " arrays of "
+                  << kLayersPerArray << " layers (" << std::fixed << std::setprecision(2)
+                  << static_cast<double>(stats.bytes) / (1024.0 * 1024.0) << " MB), uploaded twice in " << uploadMs << " ms\n"
+                  << "Drawing " << kObjects << " quads/frame, " << kMeasuredFrames << " frames per scenario\n\n"
+                  << std::left << std::setw(12) << "scenario" << std::right << std::setw(14) << "submit ms" << std::setw(14)
+                  << "frame ms" << std::setw(10) << "draws" << std::setw(10) << "binds" << std::endl;
+    }
+
+    void OnShutdown() override {
+        pool.reset();
+        textures.clear();
+        mesh.reset();
+        naiveVao.reset();
+        naiveIndices.reset();
+        naiveVertices.reset();
+        arrayShader.reset();
+        instancedShader.reset();
+        naiveShader.reset();
+    }
+
+    void OnUpdate() override { }
+
+    void OnRender() override {
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        if (scenario >= kScenarioCount) return;
+
+        const auto submitStart = Clock::now();
+        const Counts counts = scenario == 0 ? SubmitSeparate() : scenario == 1 ? SubmitSorted() : SubmitArrays();
+        const auto submitEnd = Clock::now();
+
+        ++frame;
+        if (frame <= kWarmupFrames) {
+            if (frame == kWarmupFrames) {
+                glFinish();
+                measureStart = Clock::now();
+            }
+            return;
+        }
+
+        submitSeconds += std::chrono::duration<double>(submitEnd - submitStart).count();
+        if (frame == kWarmupFrames + kMeasuredFrames) FinishScenario(counts);
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Counts {
+        std::uint32_t draws = 0;
+        std::uint32_t binds = 0;
+    };
+
+    static constexpr int kSize = 64;
+    static constexpr int kMaterials = 256;
+    static constexpr int kLayersPerArray = 64;
+    static constexpr std::uint32_t kGrid = 128;
+    static constexpr std::uint32_t kObjects = kGrid * kGrid;
+    static constexpr int kScenarioCount = 3;
+    static constexpr int kWarmupFrames = 30;
+    static constexpr int kMeasuredFrames = 200;
+
+    static Image MakeImage(const int index) {
+        Image image{kSize, kSize, 4, std::vector<std::uint8_t>(static_cast<std::size_t>(kSize) * kSize * 4)};
+        for (int y = 0; y < kSize; ++y) {
+            for (int x = 0; x < kSize; ++x) {
+                std::uint8_t* p = image.pixels.data() + (static_cast<std::size_t>(y) * kSize + x) * 4;
+                const bool checker = (x / 8 + y / 8) % 2 == 0;
+                p[0] = static_cast<std::uint8_t>(index * 37);
+                p[1] = static_cast<std::uint8_t>(index * 91);
+                p[2] = checker ? 255 : 64;
+                p[3] = 255;
+            }
+        }
+        return image;
+    }
+
+    Counts SubmitSeparate() const {
+        naiveShader->Bind();
+        naiveShader->SetMat4("uViewProjection", viewProjection);
+        naiveShader->SetInt("uTexture", 0);
+        naiveVao->Bind();
+        Counts counts;
+        int bound = -1;
+        for (std::uint32_t i = 0; i < kObjects; ++i) {
+            if (materials[i] != bound) {
+                bound = materials[i];
+                textures[static_cast<std::size_t>(bound)].Bind(0);
+                ++counts.binds;
+            }
+            naiveShader->SetMat4("uModel", transforms[i]);
+            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+            ++counts.draws;
+        }
+        return counts;
+    }
+
+    Counts SubmitSorted() {
+        instancedShader->Bind();
+        instancedShader->SetMat4("uViewProjection", viewProjection);
+        instancedShader->SetInt("uTexture", 0);
+        Counts counts;
+        mesh->BeginFrame();
+        for (std::uint32_t first = 0; first < kObjects;) {
+            const int material = materials[byMaterial[first]];
+            std::uint32_t last = first;
+            while (last < kObjects && materials[byMaterial[last]] == material) ++last;
+
+            const InstancedMesh::InstanceRange range = mesh->Allocate(last - first);
+            for (std::uint32_t i = first; i < last; ++i) range.transforms[i - first] = transforms[byMaterial[i]];
+            textures[static_cast<std::size_t>(material)].Bind(0);
+            ++counts.binds;
+            mesh->Draw(range);
+            first = last;
+        }
+        mesh->EndFrame();
+        counts.draws = mesh->GetStats().drawCalls;
+        return counts;
+    }
+
+    Counts SubmitArrays() {
+        arrayShader->Bind();
+        arrayShader->SetMat4("uViewProjection", viewProjection);
+        arrayShader->SetInt("uTextures", 0);
+        pool->BeginFrame();
+        mesh->BeginFrame();
+        for (std::uint32_t first = 0; first < kObjects;) {
+            const std::uint16_t array = slots[static_cast<std::size_t>(materials[byArray[first]])].array;
+            std::uint32_t last = first;
+            while (last < kObjects && slots[static_cast<std::size_t>(materials[byArray[last]])].array == array) ++last;
+
+            const InstancedMesh::InstanceRange range = mesh->Allocate(last - first);
+            for (std::uint32_t i = first; i < last; ++i) {
+                const std::uint32_t object = byArray[i];
+                range.transforms[i - first] = transforms[object];
+                range.layers[i - first] = slots[static_cast<std::size_t>(materials[object])].layer;
+            }
+            pool->Bind(array, 0);
+            mesh->Draw(range);
+            first = last;
+        }
+        mesh->EndFrame();
+        return {mesh->GetStats().drawCalls, pool->GetStats().binds};
+    }
+
+    void FinishScenario(const Counts counts) {
+        glFinish();
+        const double seconds = std::chrono::duration<double>(Clock::now() - measureStart).count();
+        static constexpr std::array<const char*, kScenarioCount> kNames{"separate", "sorted", "arrays"};
+
+        std::cout << std::left << std::setw(12) << kNames[scenario] << std::right << std::fixed << std::setprecision(3)
+                  << std::setw(14) << submitSeconds * 1000.0 / kMeasuredFrames
+                  << std::setw(14) << seconds * 1000.0 / kMeasuredFrames
+                  << std::setw(10) << counts.draws << std::setw(10) << counts.binds << std::endl;
+
+        frame = 0;
+        submitSeconds = 0.0;
+        if (++scenario >= kScenarioCount) GetWindow().RequestClose();
+    }
+
+    std::vector<glm::mat4> transforms;
+    std::vector<int> materials;
+    std::vector<std::uint32_t> byMaterial;
+    std::vector<std::uint32_t> byArray;
+    std::vector<TextureSlot> slots;
+    glm::mat4 viewProjection{1.0f};
+    int scenario = 0;
+    int frame = 0;
+    Clock::time_point measureStart{};
+    double submitSeconds = 0.0;
+
+    std::vector<Texture2D> textures;
+    std::unique_ptr<TextureArrayPool> pool;
+    std::unique_ptr<VertexBuffer> naiveVertices;
+    std::unique_ptr<IndexBuffer> naiveIndices;
+    std::unique_ptr<VertexArray> naiveVao;
+    std::unique_ptr<InstancedMesh> mesh;
+    std::unique_ptr<Shader> naiveShader;
+    std::unique_ptr<Shader> instancedShader;
+    std::unique_ptr<Shader> arrayShader;
+};
+
+int main() {
+    constexpr AppProperties props{ "Texture Arrays Benchmark", 800, 600, VSyncMode::Off };
+    const std::unique_ptr<TextureArraysBench> bench = std::make_unique<TextureArraysBench>(props);
+    bench->Run();
+
+    return 0;
+}
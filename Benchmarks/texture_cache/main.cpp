@@ -0,0 +1,258 @@
+//
+// Created by niek on 11/22/2025.
+//
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <GLCore/App.h>
+#include <GLCore/Caps.h>
+#include <GLCore/MeshData.h>
+#include <GLCore/Shader.h>
+#include <GLCore/TextureCache.h>
+#include <GLCore/VertexArray.h>
+using namespace GLCore;
+
+/**
+ * Two "levels" of materials that reference textures by path:
+ * - level A: 96 materials over 32 paths, where every image also exists as a byte-identical copy (16 unique images)
+ * - level B: 32 materials over 8 further images, loaded after all of level A is released
+ * Loads them with a plain TextureLoader (every material decodes and uploads its own texture), with a TextureCache
+ * and an unlimited budget, and with a TextureCache under a budget smaller than level A, then prints decodes, hit
+ * rate, uploaded and resident MB, evictions and mip drops. Level B from the budgeted cache is drawn afterwards.
+ */
+class TextureCacheBench final : public App {
+public:
+    using App::App;
+
+protected:
+    void OnInit() override {
+        for (int i = 0; i < kUnique; ++i) {
+            WriteImage(ImagePath(i, false), i);
+            if (i < kLevelAUnique) std::filesystem::copy_file(ImagePath(i, false), ImagePath(i, true),
+                                                              std::filesystem::copy_options::overwrite_existing);
+        }
+        for (int m = 0; m < 96; ++m) levelA.push_back(ImagePath(m % 32 / 2, m % 2 == 1));
+        for (int m = 0; m < 32; ++m) levelB.push_back(ImagePath(kLevelAUnique + m % 8, false));
+
+        std::cout << "GL " << Caps::Get().version << " (" << Caps::Get().renderer << ")"
+                  << (Caps::Get().copyImage ? "" : " - no ARB_copy_image, mip drops disabled") << "\n"
+                  << kSize << "x" << kSize << " RGBA PNGs, level A: " << levelA.size() << " materials / "
+                  << kLevelAUnique << " unique images, level B: " << levelB.size() << " materials / "
+                  << kUnique - kLevelAUnique << " unique images\n\n"
+                  << std::left << std::setw(16) << "scenario" << std::right << std::setw(10) << "requests"
+                  << std::setw(9) << "decodes" << std::setw(8) << "hit %" << std::setw(13) << "uploaded MB"
+                  << std::setw(13) << "resident MB" << std::setw(11) << "evictions" << std::setw(11) << "mip drops"
+                  << std::setw(10) << "ms" << std::endl;
+
+        // Baseline: one texture per material, all alive at once
+        {
+            const auto start = Clock::now();
+            std::uint64_t residentBytes = 0, uploadedBytes = 0;
+            std::uint32_t decodes = 0;
+            for (const std::vector<std::string>* level : {&levelA, &levelB}) {
+                TextureLoader loader;
+                for (const std::string& path : *level) loader.Load(path);
+                loader.WaitIdle();
+                std::uint64_t levelBytes = 0;
+                for (TextureId id = 0; id < level->size(); ++id) levelBytes += loader.Get(id)->EstimatedBytes();
+                residentBytes = std::max(residentBytes, levelBytes);
+                uploadedBytes += loader.GetStats().uploadedBytes;
+                decodes += loader.GetStats().requested;
+            }
+            glFinish();
+            PrintRow("loader", static_cast<std::uint32_t>(levelA.size() + levelB.size()), decodes, 0.0, uploadedBytes,
+                     residentBytes, 0, 0, Milliseconds(start));
+        }
+
+        RunCache("cache", 1ull << 30);
+        cache = RunCache("cache, 16 MB", 16u << 20);
+
+        MeshData quad;
+        for (const auto [x, y] : {std::array{0, 0}, std::array{1, 0}, std::array{1, 1}, std::array{0, 1}}) {
+            MeshVertex& v = quad.vertices.emplace_back();
+            v.position = {static_cast<float>(x), static_cast<float>(y), 0.0f};
+            v.uv = {static_cast<float>(x), static_cast<float>(y)};
+        }
+        quad.indices = {0, 1, 2, 0, 2, 3};
+        vertices = std::make_unique<VertexBuffer>(quad.vertices, BufferUsage::Static, "Quad vertices");
+        indices = std::make_unique<IndexBuffer>(quad.indices, BufferUsage::Static, "Quad indices");
+        vao = std::make_unique<VertexArray>("Quad VAO");
+        vao->SetVertexBuffer(0, *vertices);
+        vao->SetIndexBuffer(*indices);
+        shader = std::make_unique<Shader>("assets/quad.vert", "assets/quad.frag");
+    }
+
+    void OnShutdown() override {
+        cache.reset();
+        vao.reset();
+        indices.reset();
+        vertices.reset();
+        shader.reset();
+    }
+
+    void OnUpdate() override { }
+
+    void OnRender() override {
+        glClearColor(0.05f, 0.05f, 0.05f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        // Level B materials as an 8 x 4 grid
+        cache->Update();
+        shader->Bind();
+        shader->SetInt("uTexture", 0);
+        vao->Bind();
+        for (std::size_t m = 0; m < materials.size(); ++m) {
+            const Texture2D* texture = cache->Get(materials[m]);
+            if (!texture) continue;
+            texture->Bind(0);
+            shader->SetVec4("uRect", glm::vec4(-1.0f + static_cast<float>(m % 8) / 4.0f, -1.0f + static_cast<float>(m / 8) / 2.0f,
+                                               0.24f, 0.48f));
+            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+        }
+
+        if (++frame >= kDrawFrames) GetWindow().RequestClose();
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr int kSize = 512;
+    static constexpr int kUnique = 24;
+    static constexpr int kLevelAUnique = 16;
+    static constexpr int kDrawFrames = 60;
+
+    static double Milliseconds(const Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    static std::string ImagePath(const int i, const bool copy) {
+        return "bench_cache_" + std::to_string(i) + (copy ? "_copy.png" : ".png");
+    }
+
+    // Loads level A, releases it, loads level B; the returned cache still holds level B in `materials`
+    std::unique_ptr<TextureCache> RunCache(const char* name, const std::size_t budget) {
+        const auto start = Clock::now();
+        auto textureCache = std::make_unique<TextureCache>(TextureCacheSettings{.budgetBytes = budget});
+        std::uint64_t peakResident = 0;
+
+        materials.clear();
+        for (const std::string& path : levelA) materials.push_back(textureCache->Acquire(path));
+        textureCache->WaitIdle();
+        peakResident = std::max(peakResident, textureCache->GetStats().residentBytes);
+        for (const TextureHandle material : materials) textureCache->Release(material);
+
+        materials.clear();
+        for (const std::string& path : levelB) materials.push_back(textureCache->Acquire(path));
+        textureCache->WaitIdle();
+        peakResident = std::max(peakResident, textureCache->GetStats().residentBytes);
+        glFinish();
+
+        const TextureCache::Stats& stats = textureCache->GetStats();
+        PrintRow(name, static_cast<std::uint32_t>(stats.lookups), textureCache->Loader().GetStats().requested,
+                 stats.HitRate() * 100.0, textureCache->Loader().GetStats().uploadedBytes, peakResident, stats.evictions,
+                 stats.mipDrops, Milliseconds(start));
+        return textureCache;
+    }
+
+    static void PrintRow(const char* name, const std::uint32_t requests, const std::uint32_t decodes, const double hitPercent,
+                         const std::uint64_t uploadedBytes, const std::uint64_t residentBytes, const std::uint64_t evictions,
+                         const std::uint64_t mipDrops, const double ms) {
+        const auto mb = [](const std::uint64_t bytes) { return static_cast<double>(bytes) / (1024.0 * 1024.0); };
+        std::cout << std::left << std::setw(16) << name << std::right << std::setw(10) << requests << std::setw(9) << decodes
+                  << std::fixed << std::setprecision(1) << std::setw(8) << hitPercent << std::setw(13) << mb(uploadedBytes)
+                  << std::setw(13) << mb(residentBytes) << std::setw(11) << evictions << std::setw(11) << mipDrops
+                  << std::setw(10) << ms << std::endl;
+    }
+
+    // RGBA rows with PNG filter 1 (Sub) in stored (uncompressed) deflate blocks: a valid PNG without a deflate encoder
+    static void WriteImage(const std::string& path, const int seed) {
+        std::vector<std::uint8_t> raw;
+        raw.reserve(static_cast<std::size_t>(kSize * 4 + 1) * kSize);
+        for (int y = 0; y < kSize; ++y) {
+            raw.push_back(1);
+            std::array<std::uint8_t, 4> previous{};
+            for (int x = 0; x < kSize; ++x) {
+                const std::array<std::uint8_t, 4> pixel{static_cast<std::uint8_t>(x * 255 / kSize), static_cast<std::uint8_t>(y * 255 / kSize),
+                                                        static_cast<std::uint8_t>(seed * 10), 255};
+                for (int c = 0; c < 4; ++c) raw.push_back(static_cast<std::uint8_t>(pixel[c] - previous[c]));
+                previous = pixel;
+            }
+        }
+
+        std::vector<std::uint8_t> zlib{0x78, 0x01};
+        for (std::size_t position = 0; position < raw.size();) {
+            const auto length = static_cast<std::uint16_t>(std::min<std::size_t>(raw.size() - position, 65535));
+            zlib.push_back(position + length == raw.size() ? 1 : 0);
+            for (const std::uint16_t value : {length, static_cast<std::uint16_t>(~length)}) {
+                zlib.push_back(static_cast<std::uint8_t>(value));
+                zlib.push_back(static_cast<std::uint8_t>(value >> 8));
+            }
+            zlib.insert(zlib.end(), raw.begin() + static_cast<std::ptrdiff_t>(position), raw.begin() + static_cast<std::ptrdiff_t>(position + length));
+            position += length;
+        }
+        std::uint32_t a = 1, b = 0;
+        for (const std::uint8_t byte : raw) {
+            a = (a + byte) % 65521;
+            b = (b + a) % 65521;
+        }
+        AppendBigEndian(zlib, (b << 16) | a);
+
+        std::vector<std::uint8_t> header;
+        AppendBigEndian(header, kSize);
+        AppendBigEndian(header, kSize);
+        header.insert(header.end(), {8, 6, 0, 0, 0});   // 8-bit RGBA, deflate, adaptive filtering, no interlace
+
+        std::ofstream file(path, std::ios::binary);
+        file.write("\x89PNG\r\n\x1a\n", 8);
+        WriteChunk(file, "IHDR", header);
+        WriteChunk(file, "IDAT", zlib);
+        WriteChunk(file, "IEND", {});
+    }
+
+    static void AppendBigEndian(std::vector<std::uint8_t>& out, const std::uint32_t value) {
+        out.insert(out.end(), {static_cast<std::uint8_t>(value >> 24), static_cast<std::uint8_t>(value >> 16),
+                               static_cast<std::uint8_t>(value >> 8), static_cast<std::uint8_t>(value)});
+    }
+
+    static void WriteChunk(std::ofstream& file, const char* type, const std::vector<std::uint8_t>& data) {
+        std::vector<std::uint8_t> chunk;
+        AppendBigEndian(chunk, static_cast<std::uint32_t>(data.size()));
+        chunk.insert(chunk.end(), type, type + 4);
+        chunk.insert(chunk.end(), data.begin(), data.end());
+
+        std::uint32_t crc = 0xFFFFFFFFu;
+        for (std::size_t i = 4; i < chunk.size(); ++i) {
+            crc ^= chunk[i];
+            for (int bit = 0; bit < 8; ++bit) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+        AppendBigEndian(chunk, ~crc);
+        file.write(reinterpret_cast<const char*>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+    }
+
+    std::vector<std::string> levelA, levelB;
+    std::vector<TextureHandle> materials;
+    std::unique_ptr<TextureCache> cache;
+    int frame = 0;
+
+    std::unique_ptr<VertexBuffer> vertices;
+    std::unique_ptr<IndexBuffer> indices;
+    std::unique_ptr<VertexArray> vao;
+    std::unique_ptr<Shader> shader;
+};
+
+int main() {
+    constexpr AppProperties props{ "Texture Cache Benchmark", 800, 600, VSyncMode::Off };
+    const std::unique_ptr<TextureCacheBench> bench = std::make_unique<TextureCacheBench>(props);
+    bench->Run();
+
+    return 0;
+}
@@ -0,0 +1,13 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec2 aUV;
+
+uniform vec4 uRect;    // xy = offset, zw = scale in NDC
+
+out vec2 vUV;
+
+void main() {
+    vUV = aUV;
+    gl_Position = vec4(aPos.xy * uRect.zw + uRect.xy, 0.0, 1.0);
+}
@@ -0,0 +1,223 @@
+//
+// Created by niek on 11/21/2025.
+//
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <GLCore/App.h>
+#include <GLCore/Caps.h>
+#include <GLCore/MeshData.h>
+#include <GLCore/Shader.h>
+#include <GLCore/TextureLoader.h>
+#include <GLCore/VertexArray.h>
+using namespace GLCore;
+
+/**
+ * Writes kTextures kSize x kSize RGBA PNGs, then loads all of them three ways while rendering:
+ * - blocking: Load() everything and WaitIdle() inside one frame (what loading in OnInit amounts to), one worker
+ * - async: Update() once per frame with the default 8 MB upload budget, one worker, then the shared pool
+ * Reports total time until every texture is ready, frames taken, the worst per-frame loader cost, the loader's
+ * per-thread decode MB/s and the wall-clock decoded MB/s. Ready textures are drawn as a grid every frame.
+ */
+class TextureLoadBench final : public App {
+public:
+    using App::App;
+
+protected:
+    void OnInit() override {
+        std::uint64_t fileBytes = 0;
+        for (int i = 0; i < kTextures; ++i) fileBytes += WriteImage(ImagePath(i), i);
+
+        MeshData quad;
+        for (const auto [x, y] : {std::array{0, 0}, std::array{1, 0}, std::array{1, 1}, std::array{0, 1}}) {
+            MeshVertex& v = quad.vertices.emplace_back();
+            v.position = {static_cast<float>(x), static_cast<float>(y), 0.0f};
+            v.uv = {static_cast<float>(x), static_cast<float>(y)};
+        }
+        quad.indices = {0, 1, 2, 0, 2, 3};
+        vertices = std::make_unique<VertexBuffer>(quad.vertices, BufferUsage::Static, "Quad vertices");
+        indices = std::make_unique<IndexBuffer>(quad.indices, BufferUsage::Static, "Quad indices");
+        vao = std::make_unique<VertexArray>("Quad VAO");
+        vao->SetVertexBuffer(0, *vertices);
+        vao->SetIndexBuffer(*indices);
+        shader = std::make_unique<Shader>("assets/quad.vert", "assets/quad.frag");
+        singleWorker = std::make_unique<ThreadPool>(1);
+
+        std::cout << "GL " << Caps::Get().version << " (" << Caps::Get().renderer << ")\n"
+                  << kTextures << " PNGs of " << kSize << "x" << kSize << ", " << std::fixed << std::setprecision(1)
+                  << static_cast<double>(fileBytes) / (1024.0 * 1024.0) << " MB on disk\n\n"
+                  << std::left << std::setw(12) << "scenario" << std::right << std::setw(9) << "workers"
+                  << std::setw(11) << "total ms" << std::setw(9) << "frames" << std::setw(12) << "worst ms"
+                  << std::setw(13) << "decode MB/s" << std::setw(11) << "wall MB/s" << std::endl;
+        StartScenario();
+    }
+
+    void OnShutdown() override {
+        loader.reset();
+        vao.reset();
+        indices.reset();
+        vertices.reset();
+        shader.reset();
+    }
+
+    void OnUpdate() override { }
+
+    void OnRender() override {
+        glClearColor(0.05f, 0.05f, 0.05f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        if (scenario >= kScenarios) return;
+
+        const auto start = Clock::now();
+        if (scenario == 0) loader->WaitIdle();
+        else loader->Update();
+        worstMs = std::max(worstMs, std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+        ++frames;
+
+        // 6 x 4 grid of whatever is ready
+        shader->Bind();
+        shader->SetInt("uTexture", 0);
+        vao->Bind();
+        for (int i = 0; i < kTextures; ++i) {
+            const Texture2D* texture = loader->Get(ids[i]);
+            if (!texture) continue;
+            texture->Bind(0);
+            shader->SetVec4("uRect", glm::vec4(-1.0f + static_cast<float>(i % 6) / 3.0f, -1.0f + static_cast<float>(i / 6) / 2.0f,
+                                               0.32f, 0.48f));
+            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+        }
+
+        if (loader->Idle()) FinishScenario();
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr int kTextures = 24;
+    static constexpr int kSize = 1024;
+    static constexpr int kScenarios = 3;
+
+    static std::string ImagePath(const int i) { return "bench_texture_" + std::to_string(i) + ".png"; }
+
+    void StartScenario() {
+        loader = std::make_unique<TextureLoader>(scenario == 2 ? ThreadPool::Shared() : *singleWorker);
+        workers = scenario == 2 ? ThreadPool::Shared().ThreadCount() : 1;
+        frames = 0;
+        worstMs = 0.0;
+        scenarioStart = Clock::now();
+        for (int i = 0; i < kTextures; ++i) ids[i] = loader->Load(ImagePath(i));
+    }
+
+    void FinishScenario() {
+        glFinish();
+        static constexpr const char* kNames[] = {"blocking", "async", "async"};
+        const double totalMs = std::chrono::duration<double, std::milli>(Clock::now() - scenarioStart).count();
+        const TextureLoader::Stats& stats = loader->GetStats();
+
+        std::cout << std::left << std::setw(12) << kNames[scenario] << std::right << std::setw(9) << workers
+                  << std::fixed << std::setprecision(1) << std::setw(11) << totalMs << std::setw(9) << frames
+                  << std::setw(12) << worstMs << std::setprecision(0) << std::setw(13) << stats.DecodeMegabytesPerSecond()
+                  << std::setw(11) << static_cast<double>(stats.decodedBytes) / (1024.0 * 1024.0) / (totalMs / 1000.0)
+                  << std::endl;
+        if (stats.failed) std::cout << "  " << stats.failed << " textures failed to load" << std::endl;
+
+        if (++scenario < kScenarios) StartScenario();
+        else GetWindow().RequestClose();
+    }
+
+    // RGBA rows with PNG filter 1 (Sub) in stored (uncompressed) deflate blocks: a valid PNG without a deflate encoder,
+    // so decoding exercises inflate, unfiltering and the RGBA path but not Huffman decoding
+    static std::uint64_t WriteImage(const std::string& path, const int seed) {
+        std::vector<std::uint8_t> raw;
+        raw.reserve(static_cast<std::size_t>(kSize * 4 + 1) * kSize);
+        for (int y = 0; y < kSize; ++y) {
+            raw.push_back(1);
+            std::array<std::uint8_t, 4> previous{};
+            for (int x = 0; x < kSize; ++x) {
+                const std::array<std::uint8_t, 4> pixel{static_cast<std::uint8_t>(x * 255 / kSize), static_cast<std::uint8_t>(y * 255 / kSize),
+                                                        static_cast<std::uint8_t>(((x >> 5) ^ (y >> 5) ^ seed) & 1 ? 220 : 40), 255};
+                for (int c = 0; c < 4; ++c) raw.push_back(static_cast<std::uint8_t>(pixel[c] - previous[c]));
+                previous = pixel;
+            }
+        }
+
+        std::vector<std::uint8_t> zlib{0x78, 0x01};
+        for (std::size_t position = 0; position < raw.size();) {
+            const auto length = static_cast<std::uint16_t>(std::min<std::size_t>(raw.size() - position, 65535));
+            zlib.push_back(position + length == raw.size() ? 1 : 0);
+            for (const std::uint16_t value : {length, static_cast<std::uint16_t>(~length)}) {
+                zlib.push_back(static_cast<std::uint8_t>(value));
+                zlib.push_back(static_cast<std::uint8_t>(value >> 8));
+            }
+            zlib.insert(zlib.end(), raw.begin() + static_cast<std::ptrdiff_t>(position), raw.begin() + static_cast<std::ptrdiff_t>(position + length));
+            position += length;
+        }
+        std::uint32_t a = 1, b = 0;
+        for (const std::uint8_t byte : raw) {
+            a = (a + byte) % 65521;
+            b = (b + a) % 65521;
+        }
+        AppendBigEndian(zlib, (b << 16) | a);
+
+        std::vector<std::uint8_t> header;
+        AppendBigEndian(header, kSize);
+        AppendBigEndian(header, kSize);
+        header.insert(header.end(), {8, 6, 0, 0, 0});   // 8-bit RGBA, deflate, adaptive filtering, no interlace
+
+        std::ofstream file(path, std::ios::binary);
+        file.write("\x89PNG\r\n\x1a\n", 8);
+        WriteChunk(file, "IHDR", header);
+        WriteChunk(file, "IDAT", zlib);
+        WriteChunk(file, "IEND", {});
+        return static_cast<std::uint64_t>(file.tellp());
+    }
+
+    static void AppendBigEndian(std::vector<std::uint8_t>& out, const std::uint32_t value) {
+        out.insert(out.end(), {static_cast<std::uint8_t>(value >> 24), static_cast<std::uint8_t>(value >> 16),
+                               static_cast<std::uint8_t>(value >> 8), static_cast<std::uint8_t>(value)});
+    }
+
+    static void WriteChunk(std::ofstream& file, const char* type, const std::vector<std::uint8_t>& data) {
+        std::vector<std::uint8_t> chunk;
+        AppendBigEndian(chunk, static_cast<std::uint32_t>(data.size()));
+        chunk.insert(chunk.end(), type, type + 4);
+        chunk.insert(chunk.end(), data.begin(), data.end());
+
+        std::uint32_t crc = 0xFFFFFFFFu;
+        for (std::size_t i = 4; i < chunk.size(); ++i) {
+            crc ^= chunk[i];
+            for (int bit = 0; bit < 8; ++bit) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+        AppendBigEndian(chunk, ~crc);
+        file.write(reinterpret_cast<const char*>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+    }
+
+    std::unique_ptr<ThreadPool> singleWorker;
+    std::unique_ptr<TextureLoader> loader;
+    std::array<TextureId, kTextures> ids{};
+    int scenario = 0;
+    unsigned int workers = 1;
+    int frames = 0;
+    double worstMs = 0.0;
+    Clock::time_point scenarioStart{};
+
+    std::unique_ptr<VertexBuffer> vertices;
+    std::unique_ptr<IndexBuffer> indices;
+    std::unique_ptr<VertexArray> vao;
+    std::unique_ptr<Shader> shader;
+};
+
+int main() {
+    constexpr AppProperties props{ "Texture Load Benchmark", 800, 600, VSyncMode::Off };
+    const std::unique_ptr<TextureLoadBench> bench = std::make_unique<TextureLoadBench>(props);
+    bench->Run();
+
+    return 0;
+}
@@ -0,0 +1,154 @@
+//
+// Created by niek on 11/25/2025.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <GLCore/App.h>
+#include <GLCore/Caps.h>
+#include <GLCore/CookedTexture.h>
+#include <GLCore/MipGenerator.h>
+#include <GLCore/TextureStreamer.h>
+using namespace GLCore;
+
+/**
+ * Cooks kTextures procedural kSize x kSize textures to .gtex, then flies a camera along a row of textured quads
+ * (one texture each, kSpacing apart) for kFrames frames, requesting levels from distance and UV density, with an
+ * unlimited and a tight budget. Reports resident / allocated / pending / evicted MB over the flight, worst
+ * Update() ms, and the start-up cost of Add() (mip tails only) against uploading every level up front.
+ */
+class TextureStreamingBench final : public App {
+public:
+    using App::App;
+
+protected:
+    void OnInit() override {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "glcore_texture_streaming";
+        std::filesystem::create_directories(directory);
+        std::vector<std::string> paths;
+        for (int i = 0; i < kTextures; ++i) {
+            paths.push_back((directory / ("texture" + std::to_string(i) + ".gtex")).string());
+            CookTexture(GenerateMips(MakeImage(i)), paths.back());
+        }
+
+        MeshData quad;
+        quad.vertices = {{{-0.5f, -0.5f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f}}, {{0.5f, -0.5f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f}},
+                         {{0.5f, 0.5f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 1.0f}}, {{-0.5f, 0.5f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 1.0f}}};
+        quad.indices = {0, 1, 2, 0, 2, 3};
+        const float uvDensity = TextureStreamer::UvDensity(quad);
+
+        std::cout << "GL " << Caps::Get().version << " (" << Caps::Get().renderer << ")\n"
+                  << kTextures << " textures of " << kSize << "x" << kSize << " RGBA (sRGB), " << kFrames << " frames, quads of "
+                  << kQuadSize << " units every " << kSpacing << ", 1080p, 60 degree fov\n";
+
+        // Start-up: every level of every texture vs. the mip tails only
+        const auto fullStart = Clock::now();
+        {
+            std::vector<Texture2D> textures;
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+            for (const std::string& path : paths) {
+                const CookedTexture cooked(path);
+                Texture2D& texture = textures.emplace_back(cooked.Width(), cooked.Height(), cooked.InternalFormat(), cooked.Levels());
+                for (int level = 0; level < cooked.Levels(); ++level)
+                    texture.SetSubImage(level, 0, 0, std::max(cooked.Width() >> level, 1), std::max(cooked.Height() >> level, 1),
+                                        cooked.ClientFormat(), GL_UNSIGNED_BYTE, cooked.Level(level).data());
+            }
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+            glFinish();
+        }
+        const double fullMs = std::chrono::duration<double, std::milli>(Clock::now() - fullStart).count();
+
+        for (const std::size_t budget : {std::size_t(1) << 30, kTightBudget}) {
+            TextureStreamer streamer(ThreadPool::Shared(), {.budgetBytes = budget});
+            streamer.SetProjection(60.0f * 3.14159265f / 180.0f, 1080.0f);
+            const auto addStart = Clock::now();
+            for (const std::string& path : paths) streamer.Add(path);
+            glFinish();
+            const double addMs = std::chrono::duration<double, std::milli>(Clock::now() - addStart).count();
+
+            std::cout << "\nbudget " << (budget >= (std::size_t(1) << 30) ? std::string("unlimited") : Megabytes(budget) + " MB")
+                      << ": load all levels " << std::fixed << std::setprecision(2) << fullMs << " ms, Add() tails " << addMs
+                      << " ms\n" << std::right << std::setw(6) << "frame" << std::setw(10) << "resident" << std::setw(11)
+                      << "allocated" << std::setw(9) << "pending" << std::setw(9) << "evicted" << std::setw(10) << "streamed"
+                      << std::setw(8) << "full" << std::setw(12) << "update ms" << std::endl;
+
+            double worstMs = 0.0;
+            for (int frame = 0; frame < kFrames; ++frame) {
+                // The camera flies past the row, 2 units to the side, from before the first quad to after the last
+                const float camera = -10.0f + (kTextures * kSpacing + 20.0f) * static_cast<float>(frame) / kFrames;
+                for (int i = 0; i < kTextures; ++i) {
+                    const float along = static_cast<float>(i) * kSpacing - camera;
+                    if (along < -kQuadSize) continue;   // behind the camera
+                    streamer.Request(static_cast<StreamedTextureId>(i), std::sqrt(along * along + 4.0f), uvDensity, kQuadSize);
+                }
+                streamer.Update();
+                worstMs = std::max(worstMs, streamer.GetStats().updateMs);
+                if (frame % (kFrames / 8) == 0 || frame == kFrames - 1) Row(frame, streamer.GetStats(), worstMs);
+            }
+        }
+        std::filesystem::remove_all(directory);
+    }
+
+    void OnShutdown() override { }
+    void OnUpdate() override { }
+
+    void OnRender() override {
+        GetWindow().RequestClose();
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr int kTextures = 24;
+    static constexpr int kSize = 1024;
+    static constexpr int kFrames = 480;
+    static constexpr float kSpacing = 6.0f;
+    static constexpr float kQuadSize = 4.0f;
+    static constexpr std::size_t kTightBudget = 24u << 20;
+
+    static std::string Megabytes(const std::uint64_t bytes) {
+        const double megabytes = static_cast<double>(bytes) / (1024.0 * 1024.0);
+        return std::to_string(static_cast<int>(std::lround(megabytes)));
+    }
+
+    static void Row(const int frame, const TextureStreamer::Stats& stats, const double worstMs) {
+        const auto mb = [](const std::uint64_t bytes) { return static_cast<double>(bytes) / (1024.0 * 1024.0); };
+        std::cout << std::setw(6) << frame << std::fixed << std::setprecision(1) << std::setw(10) << mb(stats.residentBytes)
+                  << std::setw(11) << mb(stats.allocatedBytes) << std::setw(9) << mb(stats.pendingBytes) << std::setw(9)
+                  << mb(stats.evictedBytes) << std::setw(10) << mb(stats.streamedBytes) << std::setw(8) << mb(stats.fullBytes)
+                  << std::setprecision(3) << std::setw(12) << worstMs << std::endl;
+    }
+
+    static Image MakeImage(const int seed) {
+        Image image;
+        image.width = image.height = kSize;
+        image.channels = 4;
+        image.pixels.resize(static_cast<std::size_t>(kSize) * kSize * 4);
+        for (int y = 0; y < kSize; ++y) {
+            for (int x = 0; x < kSize; ++x) {
+                std::uint8_t* p = &image.pixels[(static_cast<std::size_t>(y) * kSize + x) * 4];
+                p[0] = static_cast<std::uint8_t>((x + seed * 37) & 0xFF);
+                p[1] = static_cast<std::uint8_t>((y * 3 + seed * 11) & 0xFF);
+                p[2] = static_cast<std::uint8_t>(((x >> 5) ^ (y >> 5)) & 1 ? 200 : 40);
+                p[3] = 255;
+            }
+        }
+        return image;
+    }
+};
+
+int main() {
+    constexpr AppProperties props{ "Texture Streaming Benchmark", 800, 600, VSyncMode::Off };
+    const std::unique_ptr<TextureStreamingBench> bench = std::make_unique<TextureStreamingBench>(props);
+    bench->Run();
+
+    return 0;
+}
@@ -0,0 +1,16 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec2 aUV;
+
+uniform mat4 uViewProjection;
+uniform vec3 uTranslation;
+
+out vec3 vNormal;
+out vec2 vUV;
+
+void main() {
+    vNormal = aNormal;
+    vUV = aUV;
+    gl_Position = uViewProjection * vec4(aPos + uTranslation, 1.0);
+}
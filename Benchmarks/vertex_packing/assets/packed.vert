@@ -0,0 +1,28 @@
+#version 330 core
+layout (location = 0) in vec4 aPos;      // half, [-1, 1] of the mesh bounds
+layout (location = 1) in vec4 aNormal;   // octahedral xy, snorm 10
+layout (location = 2) in vec2 aUV;       // unorm16 in the mesh UV bounds
+
+uniform mat4 uViewProjection;
+uniform vec3 uTranslation;
+uniform vec3 uPositionScale;
+uniform vec3 uPositionOffset;
+uniform vec2 uUVScale;
+uniform vec2 uUVOffset;
+
+out vec3 vNormal;
+out vec2 vUV;
+
+vec3 OctahedralDecode(vec2 e) {
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-n.z, 0.0);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
+
+void main() {
+    vNormal = OctahedralDecode(aNormal.xy);
+    vUV = aUV * uUVScale + uUVOffset;
+    gl_Position = uViewProjection * vec4(aPos.xyz * uPositionScale + uPositionOffset + uTranslation, 1.0);
+}
@@ -0,0 +1,9 @@
+#version 330 core
+in vec3 vNormal;
+in vec2 vUV;
+out vec4 FragColor;
+
+void main() {
+    float light = max(dot(normalize(vNormal), normalize(vec3(0.4, 0.8, 0.5))), 0.0) * 0.8 + 0.2;
+    FragColor = vec4(vec3(fract(vUV * 8.0), 1.0) * light, 1.0);
+}
@@ -0,0 +1,190 @@
+//
+// Created by niek on 11/15/2025.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <GLCore/App.h>
+#include <GLCore/Caps.h>
+#include <GLCore/Shader.h>
+#include <GLCore/VertexArray.h>
+#include <GLCore/VertexPacking.h>
+#include <gtc/matrix_transform.hpp>
+using namespace GLCore;
+
+/**
+ * Draws a dense UV sphere kDraws times per frame from full-precision MeshVertex data and from PackedMeshVertex data.
+ * Reports bytes/vertex, vertex buffer size, the CPU cost of quantizing the mesh and the GPU frame time of each format,
+ * plus the worst position and normal error introduced by packing.
+ */
+class VertexPackingBench final : public App {
+public:
+    using App::App;
+
+protected:
+    void OnInit() override {
+        const MeshData mesh = BuildSphere(kSegments, kSegments / 2);
+
+        const auto packStart = Clock::now();
+        packed = VertexPacking::PackMesh(mesh);
+        packMs = std::chrono::duration<double, std::milli>(Clock::now() - packStart).count();
+        MeasureError(mesh);
+
+        indexCount = static_cast<GLsizei>(mesh.indices.size());
+        indices = std::make_unique<IndexBuffer>(mesh.indices, BufferUsage::Static, "Sphere indices");
+        fullVertices = std::make_unique<VertexBuffer>(mesh.vertices, BufferUsage::Static, "Sphere full vertices");
+        packedVertices = std::make_unique<VertexBuffer>(packed.vertices, BufferUsage::Static, "Sphere packed vertices");
+
+        fullVao = std::make_unique<VertexArray>("Sphere full VAO");
+        fullVao->SetVertexBuffer(0, *fullVertices);
+        fullVao->SetIndexBuffer(*indices);
+        packedVao = std::make_unique<VertexArray>("Sphere packed VAO");
+        packedVao->SetVertexBuffer(0, *packedVertices);
+        packedVao->SetIndexBuffer(*indices);
+
+        fullShader = std::make_unique<Shader>("assets/full.vert", "assets/shade.frag");
+        packedShader = std::make_unique<Shader>("assets/packed.vert", "assets/shade.frag");
+
+        std::cout << "GL " << Caps::Get().version << " (" << Caps::Get().renderer << ")\n"
+                  << "Sphere: " << mesh.vertices.size() << " vertices, " << mesh.indices.size() / 3 << " triangles, drawn "
+                  << kDraws << "x per frame, " << kMeasuredFrames << " frames per format\n"
+                  << std::fixed << std::setprecision(3)
+                  << "PackMesh: " << packMs << " ms (" << mesh.vertices.size() / (packMs * 1000.0) << " Mvertices/s), "
+                  << "max position error " << maxPositionError << ", max normal error " << maxNormalErrorDegrees << " deg\n\n"
+                  << std::left << std::setw(10) << "format" << std::right
+                  << std::setw(14) << "bytes/vertex" << std::setw(12) << "VBO MB" << std::setw(12) << "frame ms" << std::endl;
+        glEnable(GL_DEPTH_TEST);
+        glEnable(GL_CULL_FACE);
+    }
+
+    void OnShutdown() override {
+        packedVao.reset();
+        fullVao.reset();
+        packedVertices.reset();
+        fullVertices.reset();
+        indices.reset();
+        packedShader.reset();
+        fullShader.reset();
+    }
+
+    void OnUpdate() override { }
+
+    void OnRender() override {
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        if (scenario >= 2) return;
+
+        const glm::mat4 viewProjection = glm::perspective(glm::radians(60.0f), 800.0f / 600.0f, 0.1f, 100.0f)
+                                         * glm::lookAt(glm::vec3(0.0f, 0.0f, 9.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        const Shader& shader = scenario == 0 ? *fullShader : *packedShader;
+        shader.Bind();
+        shader.SetMat4("uViewProjection", viewProjection);
+        if (scenario == 1) {
+            glUniform3fv(glGetUniformLocation(shader.ID(), "uPositionScale"), 1, &packed.position.scale.x);
+            glUniform3fv(glGetUniformLocation(shader.ID(), "uPositionOffset"), 1, &packed.position.offset.x);
+            glUniform2fv(glGetUniformLocation(shader.ID(), "uUVScale"), 1, &packed.uv.scale.x);
+            glUniform2fv(glGetUniformLocation(shader.ID(), "uUVOffset"), 1, &packed.uv.offset.x);
+        }
+        (scenario == 0 ? fullVao : packedVao)->Bind();
+
+        const GLint translation = glGetUniformLocation(shader.ID(), "uTranslation");
+        for (int i = 0; i < kDraws; ++i) {
+            glUniform3f(translation, static_cast<float>(i % 4) * 2.5f - 3.75f, static_cast<float>(i / 4) * 2.5f - 3.75f, 0.0f);
+            glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr);
+        }
+
+        ++frame;
+        if (frame == kWarmupFrames) {
+            glFinish();
+            measureStart = Clock::now();
+        } else if (frame == kWarmupFrames + kMeasuredFrames) {
+            FinishScenario();
+        }
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::uint32_t kSegments = 1024;
+    static constexpr int kDraws = 16;
+    static constexpr int kWarmupFrames = 20;
+    static constexpr int kMeasuredFrames = 200;
+
+    static MeshData BuildSphere(const std::uint32_t segments, const std::uint32_t rings) {
+        MeshData mesh;
+        for (std::uint32_t r = 0; r <= rings; ++r) {
+            const float phi = 3.14159265f * static_cast<float>(r) / static_cast<float>(rings);
+            for (std::uint32_t s = 0; s <= segments; ++s) {
+                const float theta = 6.2831853f * static_cast<float>(s) / static_cast<float>(segments);
+                MeshVertex& v = mesh.vertices.emplace_back();
+                v.normal = {std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta)};
+                v.position = v.normal;
+                v.uv = {static_cast<float>(s) / static_cast<float>(segments), static_cast<float>(r) / static_cast<float>(rings)};
+            }
+        }
+        for (std::uint32_t r = 0; r < rings; ++r) {
+            for (std::uint32_t s = 0; s < segments; ++s) {
+                const std::uint32_t a = r * (segments + 1) + s, b = a + segments + 1;
+                mesh.indices.insert(mesh.indices.end(), {a, a + 1, b, a + 1, b + 1, b});
+            }
+        }
+        return mesh;
+    }
+
+    void MeasureError(const MeshData& mesh) {
+        for (std::size_t i = 0; i < mesh.vertices.size(); ++i) {
+            const Half4& h = packed.vertices[i].position;
+            const glm::vec3 q(VertexPacking::HalfToFloat(h.x), VertexPacking::HalfToFloat(h.y), VertexPacking::HalfToFloat(h.z));
+            const glm::vec3 position = q * packed.position.scale + packed.position.offset;
+            maxPositionError = std::max(maxPositionError, glm::length(position - mesh.vertices[i].position));
+
+            const float cosine = glm::dot(VertexPacking::DecodeOctahedral(packed.vertices[i].normal), mesh.vertices[i].normal);
+            maxNormalErrorDegrees = std::max(maxNormalErrorDegrees, glm::degrees(std::acos(std::min(cosine, 1.0f))));
+        }
+    }
+
+    void FinishScenario() {
+        glFinish();
+        const double seconds = std::chrono::duration<double>(Clock::now() - measureStart).count();
+        const std::size_t stride = scenario == 0 ? sizeof(MeshVertex) : sizeof(PackedMeshVertex);
+
+        std::cout << std::left << std::setw(10) << (scenario == 0 ? "full" : "packed") << std::right
+                  << std::setw(14) << stride
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(12) << static_cast<double>(stride * packed.vertices.size()) / (1024.0 * 1024.0)
+                  << std::setprecision(3)
+                  << std::setw(12) << seconds * 1000.0 / kMeasuredFrames << std::endl;
+
+        frame = 0;
+        if (++scenario >= 2) GetWindow().RequestClose();
+    }
+
+    PackedMesh packed;
+    double packMs = 0.0;
+    float maxPositionError = 0.0f;
+    float maxNormalErrorDegrees = 0.0f;
+    GLsizei indexCount = 0;
+    int scenario = 0;
+    int frame = 0;
+    Clock::time_point measureStart{};
+
+    std::unique_ptr<IndexBuffer> indices;
+    std::unique_ptr<VertexBuffer> fullVertices;
+    std::unique_ptr<VertexBuffer> packedVertices;
+    std::unique_ptr<VertexArray> fullVao;
+    std::unique_ptr<VertexArray> packedVao;
+    std::unique_ptr<Shader> fullShader;
+    std::unique_ptr<Shader> packedShader;
+};
+
+int main() {
+    constexpr AppProperties props{ "Vertex Packing Benchmark", 800, 600, VSyncMode::Off };
+    const std::unique_ptr<VertexPackingBench> bench = std::make_unique<VertexPackingBench>(props);
+    bench->Run();
+
+    return 0;
+}
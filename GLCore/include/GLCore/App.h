@@ -7,6 +7,7 @@
 
 // Keep glad available to users of App API so they can call GL functions in overrides.
 #include "glad/glad.h"
+#include "GLCore/Window.h"
 #include <memory>
 
 namespace GLCore {
@@ -15,6 +16,9 @@ namespace GLCore {
         const char* title;
         int width;
         int height;
+        VSyncMode vsync = VSyncMode::On;
+        double maxFrameRate = 0.0; // only used with VSyncMode::Off, 0 = uncapped
+        bool debugContext = false; // see GLCore::Debug
     };
 
     /** @brief Abstract base application using RAII + Pimpl. */
@@ -38,6 +42,10 @@ namespace GLCore {
         int GetAppHeight() const;
 
     protected:
+        /** @brief The window owned by this app (presentation settings, frame timing). */
+        Window& GetWindow();
+        const Window& GetWindow() const;
+
         /** @brief Called at the start of the application */
         virtual void OnInit() = 0;
 
@@ -50,6 +58,12 @@ namespace GLCore {
         /** @brief Called every frame to render out the application's shaders. */
         virtual void OnRender() = 0;
 
+        /**
+         * @brief Called at most once per frame, before OnUpdate, when the framebuffer size changed.
+         * Resize events are coalesced, so this is the place to reallocate size-dependent render targets.
+         */
+        virtual void OnResize(int /*width*/, int /*height*/) { }
+
     private:
         struct Impl;
         std::unique_ptr<Impl> mImpl;
@@ -0,0 +1,121 @@
+//
+// Created by niek on 11/26/2025.
+//
+
+#ifndef LEARNOPENGL_ATLAS_H
+#define LEARNOPENGL_ATLAS_H
+
+#include "GLCore/AtlasPacker.h"
+#include "GLCore/CookedTexture.h"
+#include "GLCore/Image.h"
+#include "GLCore/MappedFile.h"
+#include "GLCore/Texture.h"
+#include "GLCore/ThreadPool.h"
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace GLCore {
+
+    /**
+     * Fixed 304-byte header at offset 0 of a .gatlas file, followed by the sprite table and the mip levels.
+     * - Level i holds every page (array layer) of that level back to back, bottom row first, so one
+     *   glTexSubImage3D uploads it. Levels start on a kAlignment boundary.
+     * - Like .gtex files, readers reject any other magic or version.
+     */
+    struct AtlasHeader {
+        static constexpr std::uint32_t kMagic = 0x4C544147;    // "GATL"
+        static constexpr std::uint32_t kVersion = 1;
+        static constexpr std::size_t kAlignment = 64;
+        static constexpr std::uint32_t kMaxLevels = 16;
+
+        struct Level {
+            std::uint64_t offset = 0;
+            std::uint64_t size = 0;
+        };
+
+        std::uint32_t magic = kMagic;
+        std::uint32_t version = kVersion;
+        std::uint32_t headerSize = 0;
+        CookedTextureFormat format = CookedTextureFormat::SRGB8_ALPHA8;   // RGBA8 or SRGB8_ALPHA8
+        std::uint32_t width = 0;
+        std::uint32_t height = 0;
+        std::uint32_t pages = 0;
+        std::uint32_t levelCount = 0;
+        std::uint32_t spriteCount = 0;
+        std::uint32_t reserved = 0;
+        std::uint64_t spritesOffset = 0;
+        Level levels[kMaxLevels]{};
+    };
+
+    static_assert(sizeof(AtlasHeader) == 304, "AtlasHeader layout is part of the file format");
+
+    /**
+     * @brief One entry of the UV lookup table, read in place from the mapping. Entries are sorted by nameHash; a
+     * sprite's ID is its index. UVs cover the image without its gutter, v0 at the bottom row.
+     */
+    struct AtlasSprite {
+        float u0 = 0.0f, v0 = 0.0f, u1 = 0.0f, v1 = 0.0f;
+        std::uint32_t nameHash = 0;         // Atlas::Hash of the name
+        std::uint16_t page = 0;             // array layer
+        std::uint16_t x = 0, y = 0;         // texel rectangle on the page
+        std::uint16_t width = 0, height = 0;
+        std::uint16_t reserved = 0;
+    };
+
+    static_assert(sizeof(AtlasSprite) == 32, "AtlasSprite layout is part of the file format");
+
+    /**
+     * Offline: packs `images` (see PackAtlas) and writes them as a .gatlas file.
+     * - Grey images are expanded to RGBA. Each image fills its whole cell: the gutter and the alignment slack repeat
+     *   its edge texels, so neither filtering nor mip generation sees a neighbour.
+     * - Mips use the box filter (MipSettings::srgb from `settings`): with cells on the 2^(mipLevels - 1) grid, every
+     *   texel of levels below mipLevels averages a single image.
+     * - `names` are hashed with Atlas::Hash; a collision throws std::runtime_error("ERROR::ATLAS::NAME_COLLISION").
+     * - Returns the layout; `ids`, if given, receives the sprite ID of every input image (the table is hash-sorted).
+     */
+    AtlasLayout CookAtlas(std::span<const std::string> names, std::span<const Image> images, const std::string& path,
+                          const AtlasSettings& settings = {}, std::vector<std::uint32_t>* ids = nullptr,
+                          ThreadPool& pool = ThreadPool::Shared());
+
+    /**
+     * A .gatlas file: its pages uploaded into one Texture2DArray and its sprite table used straight from the mapping.
+     * - The constructor validates the header, level sizes and page indices, then uploads every level with a single
+     *   glTexSubImage3D each; bad files throw std::runtime_error("ERROR::ATLAS::...").
+     * - Find() is a binary search over the hashes; resolve names once and keep the IDs (AtlasPacker --header emits
+     *   them as constants). SpriteBatch::Draw(atlas, id, sprite) draws by ID.
+     */
+    class Atlas {
+    public:
+        static constexpr std::uint32_t kNotFound = 0xFFFFFFFFu;
+
+        explicit Atlas(const std::string& path);
+
+        std::uint32_t Find(std::string_view name) const;
+        const AtlasSprite& Get(std::uint32_t id) const { return mSprites[id]; }
+        std::span<const AtlasSprite> Sprites() const { return {mSprites, mHeader->spriteCount}; }
+        std::uint32_t Count() const { return mHeader->spriteCount; }
+
+        const Texture2DArray& Texture() const { return mTexture; }
+        const AtlasHeader& Header() const { return *mHeader; }
+
+        // 32-bit FNV-1a
+        static constexpr std::uint32_t Hash(const std::string_view name) {
+            std::uint32_t hash = 2166136261u;
+            for (const char c : name) hash = (hash ^ static_cast<std::uint8_t>(c)) * 16777619u;
+            return hash;
+        }
+
+    private:
+        MappedFile mFile;
+        const AtlasHeader* mHeader = nullptr;
+        const AtlasSprite* mSprites = nullptr;
+        Texture2DArray mTexture;
+    };
+
+}
+
+#endif //LEARNOPENGL_ATLAS_H
@@ -0,0 +1,53 @@
+//
+// Created by niek on 11/26/2025.
+//
+
+#ifndef LEARNOPENGL_ATLASPACKER_H
+#define LEARNOPENGL_ATLASPACKER_H
+
+#include <glm.hpp>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace GLCore {
+
+    struct AtlasSettings {
+        int maxSize = 2048;         // page width / height limit, a power of two
+        int gutter = 2;             // edge texels repeated around every image, so bilinear taps never reach a neighbour
+        int mipLevels = 4;          // levels that stay free of bleeding: images own whole 2^(mipLevels - 1) texel blocks
+        bool srgb = true;           // color images (CookAtlas): sRGB-correct mips and an SRGB8_ALPHA8 texture
+    };
+
+    /** @brief Where one image landed: its page (array layer) and texel rectangle, gutter excluded. */
+    struct AtlasRect {
+        int page = 0;
+        int x = 0, y = 0;
+        int width = 0, height = 0;
+    };
+
+    struct AtlasLayout {
+        int width = 0, height = 0;              // of every page, powers of two
+        int pages = 0;
+        std::vector<AtlasRect> rects;           // in input order
+        std::uint64_t usedTexels = 0;           // image texels, gutters excluded
+
+        double Occupancy() const {
+            return pages ? static_cast<double>(usedTexels) / (static_cast<double>(width) * height * pages) : 0.0;
+        }
+    };
+
+    /**
+     * MaxRects bin packing (best short side fit) of image sizes into power-of-two pages.
+     * - Every image gets a cell of its size plus the gutter on each side, rounded up to the mip-safe block size; cells
+     *   are placed on that block grid, so no 2^(mipLevels - 1) block ever mixes two images.
+     * - Images are placed largest first. A single page grows from the smallest power of two that could hold all
+     *   cells (doubling width and height in turn) up to maxSize; beyond that, maxSize pages are added as needed.
+     * - Throws std::runtime_error("ERROR::ATLAS::IMAGE_TOO_LARGE") for an image whose cell exceeds maxSize.
+     */
+    AtlasLayout PackAtlas(std::span<const glm::ivec2> sizes, const AtlasSettings& settings = {});
+
+}
+
+#endif //LEARNOPENGL_ATLASPACKER_H
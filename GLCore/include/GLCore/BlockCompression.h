@@ -0,0 +1,62 @@
+//
+// Created by niek on 11/24/2025.
+//
+
+#ifndef LEARNOPENGL_BLOCKCOMPRESSION_H
+#define LEARNOPENGL_BLOCKCOMPRESSION_H
+
+#include "GLCore/Image.h"
+#include "GLCore/ThreadPool.h"
+
+#include "glad/glad.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace GLCore {
+
+    enum class BlockFormat {
+        BC1,    // RGB, 5:6:5 endpoints + 2-bit indices, 8 bytes per 4x4 block (alpha dropped)
+        BC3,    // BC1 color + BC4 alpha, 16 bytes
+        BC4,    // one channel (red / grey), 8 bytes
+        BC5,    // two channels (normal map XY, grey + alpha), 16 bytes
+        BC7     // RGBA, mode 6: 7-bit + p-bit endpoints, 4-bit indices, 16 bytes
+    };
+
+    enum class BlockQuality {
+        Fast,       // principal-axis endpoints, one index pass
+        Normal,     // + least-squares endpoint refinement; BC7 tries every p-bit pair
+        High        // + more refinement passes and a BC7 endpoint neighbourhood search
+    };
+
+    /**
+     * CPU block compression for the asset build (TextureCooker --bc, CookTexture), 4-8x smaller than RGBA8 in memory
+     * and bandwidth.
+     * - BC1 / BC3 / BC7 read RGBA (grey images are expanded: g, g, g, a), BC4 the first channel and BC5 the first two.
+     *   Partial edge blocks repeat the last row / column.
+     * - Blocks are encoded in the image's own space: sRGB data stays sRGB, and is decoded as such by the
+     *   GL_COMPRESSED_SRGB_* formats from BlockInternalFormat().
+     * - Block rows are spread over `pool`; throws std::runtime_error("ERROR::BLOCK_COMPRESSION::...") on bad input.
+     */
+    std::vector<std::uint8_t> CompressImage(const Image& image, BlockFormat format, BlockQuality quality = BlockQuality::Normal,
+                                            ThreadPool& pool = ThreadPool::Shared());
+
+    // Reference decoder (quality checks, tests): BC7 blocks must be mode 6, as CompressImage writes them
+    Image DecompressImage(std::span<const std::uint8_t> blocks, BlockFormat format, int width, int height);
+
+    // Peak signal-to-noise ratio in dB over the first `channels` channels of `decoded` (0: all of them; 3 for BC1,
+    // which drops alpha); infinity when identical
+    double Psnr(const Image& reference, const Image& decoded, int channels = 0);
+
+    std::size_t BlockBytes(BlockFormat format);
+    std::size_t CompressedBytes(BlockFormat format, int width, int height);
+    int BlockChannels(BlockFormat format);                  // channels DecompressImage produces: 1, 2 or 4
+    GLenum BlockInternalFormat(BlockFormat format, bool srgb);  // BC4 / BC5 ignore srgb
+    bool BlockFormatSupported(BlockFormat format);          // Caps: S3TC for BC1 / BC3, BPTC for BC7
+    const char* ToString(BlockFormat format);
+
+}
+
+#endif //LEARNOPENGL_BLOCKCOMPRESSION_H
@@ -0,0 +1,101 @@
+//
+// Created by niek on 11/10/2025.
+//
+
+#ifndef LEARNOPENGL_BUFFER_H
+#define LEARNOPENGL_BUFFER_H
+
+#include "GLCore/VertexLayout.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <string>
+
+namespace GLCore {
+
+    enum class BufferUsage {
+        Static,
+        Dynamic,
+        Stream
+    };
+
+    /**
+     * An OpenGL buffer object
+     * - Uses DSA (glNamedBuffer*) when available; otherwise uploads through GL_COPY_WRITE_BUFFER so
+     *   no vertex/index binding is disturbed.
+     * - RAII: buffer deleted in destructor.
+     */
+    class Buffer {
+    public:
+        Buffer() = default;
+        Buffer(std::size_t size, const void* data, BufferUsage usage = BufferUsage::Static, const std::string& label = {});
+        ~Buffer();
+
+        // Non-copyable (owning handle), movable
+        Buffer(const Buffer&) = delete;
+        Buffer& operator=(const Buffer&) = delete;
+        Buffer(Buffer&& other) noexcept;
+        Buffer& operator=(Buffer&& other) noexcept;
+
+        // Re-specify the whole store (orphans the previous one)
+        void SetData(std::size_t size, const void* data);
+
+        // Overwrite a sub-range of the store
+        void Update(std::size_t offset, std::size_t size, const void* data) const;
+
+        // GPU-side copy of a range into another buffer
+        void CopyTo(const Buffer& destination, std::size_t sourceOffset, std::size_t destinationOffset, std::size_t size) const;
+
+        unsigned int ID() const { return mID; }
+        std::size_t Size() const { return mSize; }
+
+    protected:
+        unsigned int mID = 0;
+        std::size_t mSize = 0;
+        BufferUsage mUsage = BufferUsage::Static;
+    };
+
+    /** @brief Buffer of vertices of a single VertexType; remembers its format for VertexArray. */
+    class VertexBuffer : public Buffer {
+    public:
+        VertexBuffer() = default;
+
+        template<std::ranges::contiguous_range R>
+            requires VertexType<std::ranges::range_value_t<R>>
+        explicit VertexBuffer(const R& vertices, const BufferUsage usage = BufferUsage::Static, const std::string& label = {})
+            : Buffer(std::ranges::size(vertices) * sizeof(std::ranges::range_value_t<R>), std::ranges::data(vertices), usage, label),
+              mFormat(VertexFormat::Of<std::ranges::range_value_t<R>>()),
+              mCount(std::ranges::size(vertices)) {}
+
+        const VertexFormat& Format() const { return mFormat; }
+        std::size_t Count() const { return mCount; }
+
+    private:
+        VertexFormat mFormat{};
+        std::size_t mCount = 0;
+    };
+
+    /** @brief Buffer of 16- or 32-bit indices. */
+    class IndexBuffer : public Buffer {
+    public:
+        IndexBuffer() = default;
+
+        template<std::ranges::contiguous_range R>
+            requires std::same_as<std::ranges::range_value_t<R>, std::uint32_t> || std::same_as<std::ranges::range_value_t<R>, std::uint16_t>
+        explicit IndexBuffer(const R& indices, const BufferUsage usage = BufferUsage::Static, const std::string& label = {})
+            : Buffer(std::ranges::size(indices) * sizeof(std::ranges::range_value_t<R>), std::ranges::data(indices), usage, label),
+              mType(sizeof(std::ranges::range_value_t<R>) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT),
+              mCount(std::ranges::size(indices)) {}
+
+        GLenum IndexType() const { return mType; }
+        std::size_t Count() const { return mCount; }
+
+    private:
+        GLenum mType = GL_UNSIGNED_INT;
+        std::size_t mCount = 0;
+    };
+
+}
+
+#endif //LEARNOPENGL_BUFFER_H
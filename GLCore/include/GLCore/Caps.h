@@ -0,0 +1,64 @@
+//
+// Created by niek on 11/9/2025.
+//
+
+#ifndef LEARNOPENGL_CAPS_H
+#define LEARNOPENGL_CAPS_H
+
+#include <string>
+
+namespace GLCore {
+
+    /**
+     * Capabilities of the current GL context.
+     * - Filled once by Window right after glad has loaded the function pointers.
+     * - Feature flags are only set when the matching entry points were loaded, so they can gate fast paths directly.
+     */
+    struct Caps {
+        int major = 0;
+        int minor = 0;
+        std::string vendor;
+        std::string renderer;
+        std::string version;
+
+        // Core features (with the version that made them core)
+        bool directStateAccess = false;    // 4.5 / ARB_direct_state_access
+        bool bufferStorage = false;        // 4.4 / ARB_buffer_storage
+        bool multiDrawIndirect = false;    // 4.3 / ARB_multi_draw_indirect
+        bool shaderStorageBuffers = false; // 4.3 / ARB_shader_storage_buffer_object
+        bool copyImage = false;            // 4.3 / ARB_copy_image
+        bool debugOutput = false;          // 4.3 / KHR_debug
+        bool baseInstance = false;         // 4.2 / ARB_base_instance
+        bool textureStorage = false;       // 4.2 / ARB_texture_storage
+        bool separateShaderObjects = false;// 4.1 (glProgramUniform*)
+        bool shaderDrawParameters = false; // 4.6 / ARB_shader_draw_parameters (gl_DrawID, gl_BaseInstance)
+
+        // Texture formats and filtering
+        bool textureCompressionS3TC = false;  // EXT_texture_compression_s3tc (BC1-BC3)
+        bool textureCompressionRGTC = true;   // core since 3.0 (BC4/BC5)
+        bool textureCompressionBPTC = false;  // 4.2 / ARB_texture_compression_bptc (BC7)
+        bool anisotropicFiltering = false;    // 4.6 / EXT_texture_filter_anisotropic
+
+        // Limits
+        int maxTextureSize = 0;
+        int maxArrayTextureLayers = 0;
+        int maxVertexAttribs = 0;
+        int maxUniformBlockSize = 0;
+        int maxTextureImageUnits = 0;
+        int storageBufferOffsetAlignment = 256; // GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT (4.3+)
+        float maxAnisotropy = 1.0f;
+
+        bool AtLeast(const int requiredMajor, const int requiredMinor) const {
+            return major > requiredMajor || (major == requiredMajor && minor >= requiredMinor);
+        }
+
+        // Read-only access to the table of the current context
+        static const Caps& Get();
+
+        // Query the current context; called by Window once per glad load
+        static void Load();
+    };
+
+}
+
+#endif //LEARNOPENGL_CAPS_H
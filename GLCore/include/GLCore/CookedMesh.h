@@ -0,0 +1,153 @@
+//
+// Created by niek on 11/20/2025.
+//
+
+#ifndef LEARNOPENGL_COOKEDMESH_H
+#define LEARNOPENGL_COOKEDMESH_H
+
+#include "GLCore/Frustum.h"
+#include "GLCore/MappedFile.h"
+#include "GLCore/MeshData.h"
+#include "GLCore/MeshLod.h"
+#include "GLCore/Meshlet.h"
+#include "GLCore/VertexPacking.h"
+
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace GLCore {
+
+    enum class CookedVertexFormat : std::uint32_t {
+        Full = 0,      // MeshVertex (32 bytes)
+        Packed = 1     // PackedMeshVertex (16 bytes), dequantized with the header's position / uv quantization
+    };
+
+    enum class CookedSection : std::uint32_t {
+        Vertices,
+        Indices,           // base mesh followed by the LOD chain (MeshLod ranges)
+        Groups,            // CookedGroup records
+        GroupNames,        // UTF-8 names, not terminated
+        Lods,              // MeshLod
+        Meshlets,          // Meshlet
+        MeshletIndices,    // cluster-ordered copy of LOD 0, indexed by Meshlet::firstIndex
+        MeshletCull,       // MeshletCullData as 8 arrays of header.meshletCullStride floats
+        Count
+    };
+
+    /** @brief On-disk group; the name is GroupNames[nameOffset, nameOffset + nameLength). */
+    struct CookedGroup {
+        std::uint32_t firstIndex = 0;
+        std::uint32_t indexCount = 0;
+        std::uint32_t nameOffset = 0;
+        std::uint32_t nameLength = 0;
+    };
+
+    /**
+     * Fixed 256-byte header at offset 0 of a .gmesh file, followed by the sections it points at.
+     * - Little-endian, native float layout; every section starts on a kAlignment boundary so the mapped file can be
+     *   read in place as typed arrays and handed to glBufferData without a copy.
+     * - A reader rejects any other magic or version: the files are rebuilt by the asset build, not migrated.
+     */
+    struct CookedMeshHeader {
+        static constexpr std::uint32_t kMagic = 0x48534D47;    // "GMSH"
+        static constexpr std::uint32_t kVersion = 1;
+        static constexpr std::size_t kAlignment = 64;
+
+        struct Section {
+            std::uint64_t offset = 0;
+            std::uint64_t size = 0;
+        };
+
+        std::uint32_t magic = kMagic;
+        std::uint32_t version = kVersion;
+        std::uint32_t headerSize = 0;
+        CookedVertexFormat vertexFormat = CookedVertexFormat::Full;
+        std::uint32_t vertexStride = 0;
+        std::uint32_t vertexCount = 0;
+        std::uint32_t indexCount = 0;
+        std::uint32_t groupCount = 0;
+        std::uint32_t lodCount = 0;
+        std::uint32_t meshletCount = 0;
+        std::uint32_t meshletIndexCount = 0;
+        std::uint32_t meshletCullStride = 0;   // meshletCount rounded up to 4
+        glm::vec3 boundsMin{0.0f};
+        glm::vec3 boundsMax{0.0f};
+        BoundingSphere bounds{};
+        PositionQuantization position{};       // Packed only
+        UVQuantization uv{};                   // Packed only
+        Section sections[static_cast<std::size_t>(CookedSection::Count)]{};
+    };
+
+    static_assert(sizeof(CookedMeshHeader) == 256, "CookedMeshHeader layout is part of the file format");
+    static_assert(sizeof(Meshlet) == 44 && sizeof(MeshLod) == 12, "Meshlet / MeshLod are stored verbatim");
+
+    struct CookSettings {
+        bool packVertices = false;         // store PackedMeshVertex instead of MeshVertex
+        std::uint32_t maxLods = 1;         // > 1 builds a chain when the mesh has no "lodN" groups yet
+        bool meshlets = true;              // cluster LOD 0 for MeshletCuller
+        MeshletSettings meshletSettings{};
+    };
+
+    /**
+     * Offline: writes `mesh` as a .gmesh file.
+     * - LODs come from existing "lodN error=E" groups (MeshOptimizer --lods) or are generated when maxLods > 1.
+     * - Meshlets are built over LOD 0; the original groups are kept as CookedGroup records.
+     * - Throws std::runtime_error("ERROR::COOKED_MESH::FILE_NOT_WRITABLE") on I/O errors.
+     */
+    void CookMesh(const MeshData& mesh, const std::string& path, const CookSettings& settings = {});
+
+    /**
+     * A .gmesh file mapped read-only; every accessor is a view into the mapping (no parsing, no copies).
+     * - The constructor validates magic, version and that each section is aligned, in range and sized to its count;
+     *   anything else throws std::runtime_error("ERROR::COOKED_MESH::...").
+     * - Upload with `VertexBuffer(mesh.Vertices<MeshVertex>())` / `IndexBuffer(mesh.Indices())`, which read straight
+     *   from the page cache.
+     */
+    class CookedMesh {
+    public:
+        explicit CookedMesh(const std::string& path);
+
+        const CookedMeshHeader& Header() const { return *mHeader; }
+        std::size_t FileSize() const { return mFile.Size(); }
+
+        std::span<const std::byte> VertexBytes() const { return View<std::byte>(CookedSection::Vertices); }
+        VertexFormat Format() const;
+
+        // Typed view of the vertices; V must match the stored format (MeshVertex or PackedMeshVertex)
+        template<VertexType V>
+        std::span<const V> Vertices() const {
+            constexpr CookedVertexFormat format = std::is_same_v<V, PackedMeshVertex> ? CookedVertexFormat::Packed
+                                                                                      : CookedVertexFormat::Full;
+            if (mHeader->vertexFormat != format || mHeader->vertexStride != sizeof(V))
+                throw std::runtime_error("ERROR::COOKED_MESH::VERTEX_FORMAT_MISMATCH");
+            return View<V>(CookedSection::Vertices);
+        }
+
+        std::span<const std::uint32_t> Indices() const { return View<std::uint32_t>(CookedSection::Indices); }
+        std::span<const CookedGroup> Groups() const { return View<CookedGroup>(CookedSection::Groups); }
+        std::string_view GroupName(std::size_t group) const;
+        std::span<const MeshLod> Lods() const { return View<MeshLod>(CookedSection::Lods); }
+        std::span<const Meshlet> Meshlets() const { return View<Meshlet>(CookedSection::Meshlets); }
+        std::span<const std::uint32_t> MeshletIndices() const { return View<std::uint32_t>(CookedSection::MeshletIndices); }
+
+        // MeshletCuller works on owned arrays; this copies the meshlet sections (a few memcpys, still no parsing)
+        MeshletMesh ToMeshletMesh() const;
+
+    private:
+        template<class T>
+        std::span<const T> View(const CookedSection section) const {
+            const CookedMeshHeader::Section& range = mHeader->sections[static_cast<std::size_t>(section)];
+            return {reinterpret_cast<const T*>(mFile.Data() + range.offset), static_cast<std::size_t>(range.size / sizeof(T))};
+        }
+
+        MappedFile mFile;
+        const CookedMeshHeader* mHeader = nullptr;
+    };
+
+}
+
+#endif //LEARNOPENGL_COOKEDMESH_H
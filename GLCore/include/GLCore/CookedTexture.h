@@ -0,0 +1,117 @@
+//
+// Created by niek on 11/23/2025.
+//
+
+#ifndef LEARNOPENGL_COOKEDTEXTURE_H
+#define LEARNOPENGL_COOKEDTEXTURE_H
+
+#include "GLCore/BlockCompression.h"
+#include "GLCore/Image.h"
+#include "GLCore/MappedFile.h"
+
+#include "glad/glad.h"
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+
+namespace GLCore {
+
+    enum class CookedTextureFormat : std::uint32_t {
+        R8 = 0,
+        RG8 = 1,
+        RGBA8 = 2,
+        SRGB8_ALPHA8 = 3,
+        BC1 = 4,
+        BC1_SRGB = 5,
+        BC3 = 6,
+        BC3_SRGB = 7,
+        BC4 = 8,
+        BC5 = 9,
+        BC7 = 10,
+        BC7_SRGB = 11
+    };
+
+    /**
+     * Fixed 288-byte header at offset 0 of a .gtex file, followed by the mip levels it points at (largest first).
+     * - Levels are tightly packed rows (or 4x4 blocks, row by row), bottom row first (already flipped for GL), each
+     *   on a kAlignment boundary.
+     * - A reader rejects any other magic or version: the files are rebuilt by the asset build, not migrated.
+     */
+    struct CookedTextureHeader {
+        static constexpr std::uint32_t kMagic = 0x58455447;    // "GTEX"
+        static constexpr std::uint32_t kVersion = 2;     // 2: block-compressed formats, flags
+        static constexpr std::size_t kAlignment = 64;
+        static constexpr std::uint32_t kMaxLevels = 16;
+        static constexpr std::uint32_t kGreyscale = 1;   // flags: source was grey (+ alpha); sample .rrr(g)
+
+        struct Level {
+            std::uint64_t offset = 0;
+            std::uint64_t size = 0;
+        };
+
+        std::uint32_t magic = kMagic;
+        std::uint32_t version = kVersion;
+        std::uint32_t headerSize = 0;
+        CookedTextureFormat format = CookedTextureFormat::RGBA8;
+        std::uint32_t width = 0;
+        std::uint32_t height = 0;
+        std::uint32_t levelCount = 0;
+        std::uint32_t flags = 0;
+        Level levels[kMaxLevels]{};
+    };
+
+    static_assert(sizeof(CookedTextureHeader) == 288, "CookedTextureHeader layout is part of the file format");
+
+    struct TextureCookSettings {
+        bool srgb = true;                                 // color data: SRGB8_ALPHA8 / the sRGB BC formats
+        std::optional<BlockFormat> compression;           // block-compress every level; uncompressed when empty
+        BlockQuality quality = BlockQuality::Normal;
+    };
+
+    /**
+     * Offline: writes a mip chain (see GenerateMips) as a .gtex file.
+     * - Uncompressed, 1, 2 and 4 channels map to R8, RG8 and RGBA8 (SRGB8_ALPHA8 with `srgb`); with `compression`
+     *   every level is encoded by CompressImage() on `pool` (BC4 / BC5 have no sRGB variant).
+     * - Every level must halve the previous. Grey and grey + alpha sources are flagged kGreyscale.
+     * - Throws std::runtime_error("ERROR::COOKED_TEXTURE::...") on invalid chains and I/O errors.
+     */
+    void CookTexture(std::span<const Image> levels, const std::string& path, const TextureCookSettings& settings = {},
+                     ThreadPool& pool = ThreadPool::Shared());
+
+    /**
+     * A .gtex file mapped read-only; Level() is a view into the mapping, ready for glTexSubImage2D (or
+     * glCompressedTexSubImage2D when Compression() is set).
+     * - The constructor validates magic, version, format, level sizes and that each level is aligned and in range;
+     *   anything else throws std::runtime_error("ERROR::COOKED_TEXTURE::...").
+     * - TextureLoader::Load() recognizes .gtex paths and uploads every level instead of generating mipmaps.
+     */
+    class CookedTexture {
+    public:
+        explicit CookedTexture(const std::string& path);
+
+        const CookedTextureHeader& Header() const { return *mHeader; }
+        std::size_t FileSize() const { return mFile.Size(); }
+
+        int Width() const { return static_cast<int>(mHeader->width); }
+        int Height() const { return static_cast<int>(mHeader->height); }
+        int Levels() const { return static_cast<int>(mHeader->levelCount); }
+        int Channels() const;
+        bool Greyscale() const { return (mHeader->flags & CookedTextureHeader::kGreyscale) != 0; }
+        std::optional<BlockFormat> Compression() const;
+        GLenum InternalFormat() const;
+        GLenum ClientFormat() const;    // format for glTexSubImage2D (type is GL_UNSIGNED_BYTE); uncompressed only
+
+        std::span<const std::byte> Level(int level) const;
+
+        static int Channels(CookedTextureFormat format);
+
+    private:
+        MappedFile mFile;
+        const CookedTextureHeader* mHeader = nullptr;
+    };
+
+}
+
+#endif //LEARNOPENGL_COOKEDTEXTURE_H
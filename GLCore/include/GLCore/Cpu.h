@@ -0,0 +1,22 @@
+//
+// Created by niek on 11/23/2025.
+//
+
+#ifndef LEARNOPENGL_CPU_H
+#define LEARNOPENGL_CPU_H
+
+namespace GLCore {
+
+    enum class SimdLevel {
+        Scalar,
+        SSE2,
+        AVX2      // AVX2 + FMA
+    };
+
+    // Highest level both this build and the running CPU / OS support; detected once
+    SimdLevel DetectSimdLevel();
+    const char* ToString(SimdLevel level);
+
+}
+
+#endif //LEARNOPENGL_CPU_H
@@ -0,0 +1,59 @@
+//
+// Created by niek on 11/8/2025.
+//
+
+#ifndef LEARNOPENGL_DEBUG_H
+#define LEARNOPENGL_DEBUG_H
+
+#include "glad/glad.h"
+
+#include <cstddef>
+#include <string>
+
+namespace GLCore::Debug {
+
+    /** @brief Number of driver debug messages received, split by message type. */
+    struct MessageCounters {
+        unsigned int errors = 0;
+        unsigned int performance = 0;
+        unsigned int portability = 0;
+        unsigned int deprecated = 0;
+        unsigned int undefinedBehavior = 0;
+        unsigned int other = 0;
+
+        unsigned int Total() const {
+            return errors + performance + portability + deprecated + undefinedBehavior + other;
+        }
+    };
+
+    /**
+     * @brief Installs the debug message sink on the current context (KHR_debug / GL 4.3).
+     * Messages are reported synchronously; each distinct message is printed once and counted every time.
+     * Returns false when the context does not expose KHR_debug.
+     */
+    bool Enable();
+
+    /** @brief Whether Enable() installed the sink on the context that is current now. */
+    bool IsEnabled();
+
+    /** @brief Forgets the sink if it was installed on `context`, so a later context gets its own. Called by Window. */
+    void OnContextDestroyed(const void* context);
+
+    /** @brief Closes the current frame's counters. Called by Window::SwapBuffers. */
+    void EndFrame();
+
+    /** @brief Counters of the last completed frame. */
+    MessageCounters GetFrameCounters();
+
+    /** @brief Counters accumulated since Enable(). */
+    MessageCounters GetTotalCounters();
+
+    /** @brief Number of distinct (source, type, id) messages seen. */
+    std::size_t GetUniqueMessageCount();
+
+    /** @brief Names a GL object for debug output and capture tools. No-op without KHR_debug. */
+    void Label(GLenum identifier, unsigned int name, const std::string& label);
+
+}
+
+#endif //LEARNOPENGL_DEBUG_H
@@ -0,0 +1,38 @@
+//
+// Created by niek on 11/14/2025.
+//
+
+#ifndef LEARNOPENGL_FRUSTUM_H
+#define LEARNOPENGL_FRUSTUM_H
+
+#include <array>
+#include <glm.hpp>
+
+namespace GLCore {
+
+    struct BoundingSphere {
+        glm::vec3 center{0.0f};
+        float radius = 0.0f;
+    };
+
+    /**
+     * View frustum as six normalized planes (left, right, bottom, top, near, far), pointing inwards.
+     * - Extracted from a view-projection matrix with GL clip conventions (-w <= z <= w).
+     */
+    class Frustum {
+    public:
+        Frustum() = default;
+        explicit Frustum(const glm::mat4& viewProjection);
+
+        // Conservative: true when the sphere is at least partly inside
+        bool Intersects(const BoundingSphere& sphere) const;
+
+        const std::array<glm::vec4, 6>& Planes() const { return mPlanes; }
+
+    private:
+        std::array<glm::vec4, 6> mPlanes{};
+    };
+
+}
+
+#endif //LEARNOPENGL_FRUSTUM_H
@@ -0,0 +1,117 @@
+//
+// Created by niek on 11/12/2025.
+//
+
+#ifndef LEARNOPENGL_GEOMETRYPOOL_H
+#define LEARNOPENGL_GEOMETRYPOOL_H
+
+#include "GLCore/Buffer.h"
+#include "GLCore/OffsetAllocator.h"
+#include "GLCore/VertexArray.h"
+
+#include <cstdint>
+#include <ranges>
+#include <string>
+#include <vector>
+
+namespace GLCore {
+
+    /** @brief Stable reference to a mesh in a GeometryPool; survives growth and defragmentation. */
+    struct MeshHandle {
+        std::uint32_t id = 0xFFFFFFFFu;
+
+        bool Valid() const { return id != 0xFFFFFFFFu; }
+    };
+
+    /** @brief Where a mesh lives inside the pool's shared buffers (in vertices / indices). */
+    struct MeshRange {
+        std::int32_t baseVertex = 0;
+        std::uint32_t vertexCount = 0;
+        std::uint32_t firstIndex = 0;
+        std::uint32_t indexCount = 0;
+    };
+
+    /**
+     * Shared vertex + index storage for many meshes of one vertex format.
+     * - Ranges come from O(1) OffsetAllocators; indices are stored mesh-relative and drawn with a base vertex,
+     *   so all meshes share one VAO and draws differ only by (firstIndex, baseVertex).
+     * - Grows by reallocating into larger buffers (GPU copy), which also compacts. Defragment() does the same copy at the
+     *   current capacity, so both briefly hold the old and new buffers (about twice the pool's memory).
+     */
+    class GeometryPool {
+    public:
+        struct Stats {
+            std::uint32_t meshes = 0;
+            std::uint32_t vertexCapacity = 0;
+            std::uint32_t verticesUsed = 0;
+            std::uint32_t indexCapacity = 0;
+            std::uint32_t indicesUsed = 0;
+            std::uint32_t growCount = 0;
+            std::uint32_t defragmentCount = 0;
+            float fragmentation = 0.0f; // 1 - largest free vertex range / free vertices
+        };
+
+        GeometryPool(const VertexFormat& format, std::uint32_t vertexCapacity, std::uint32_t indexCapacity,
+                     const std::string& label = {});
+
+        // Non-copyable (owns GL buffers)
+        GeometryPool(const GeometryPool&) = delete;
+        GeometryPool& operator=(const GeometryPool&) = delete;
+
+        MeshHandle Add(const void* vertices, std::uint32_t vertexCount, const std::uint32_t* indices, std::uint32_t indexCount);
+
+        template<std::ranges::contiguous_range VR, std::ranges::contiguous_range IR>
+            requires VertexType<std::ranges::range_value_t<VR>> && std::same_as<std::ranges::range_value_t<IR>, std::uint32_t>
+        MeshHandle Add(const VR& vertices, const IR& indices) {
+            return Add(std::ranges::data(vertices), static_cast<std::uint32_t>(std::ranges::size(vertices)),
+                       std::ranges::data(indices), static_cast<std::uint32_t>(std::ranges::size(indices)));
+        }
+
+        void Remove(MeshHandle mesh);
+        const MeshRange& GetRange(MeshHandle mesh) const;
+
+        // Copy every live mesh to the front of new buffers of the same capacity
+        void Defragment();
+
+        // Bind the shared VAO, then draw any number of meshes
+        void Bind() const;
+        void Draw(MeshHandle mesh, GLenum mode = GL_TRIANGLES) const;
+
+        VertexArray& GetVertexArray() { return mVertexArray; }
+        const VertexArray& GetVertexArray() const { return mVertexArray; }
+        const Buffer& GetVertexBuffer() const { return mVertices; }
+        const Buffer& GetIndexBuffer() const { return mIndices; }
+        const VertexFormat& Format() const { return mFormat; }
+        Stats GetStats() const;
+
+    private:
+        struct Slot {
+            MeshRange range{};
+            OffsetAllocator::Allocation vertexAllocation{};
+            OffsetAllocator::Allocation indexAllocation{};
+            bool live = false;
+        };
+
+        // Reallocate into buffers of the given capacity, packing live meshes front to back
+        void Rebuild(std::uint32_t vertexCapacity, std::uint32_t indexCapacity);
+        void AttachBuffers();
+
+        VertexFormat mFormat;
+        std::string mLabel;
+        Buffer mVertices;
+        Buffer mIndices;
+        VertexArray mVertexArray;
+        OffsetAllocator mVertexAllocator;
+        OffsetAllocator mIndexAllocator;
+
+        std::vector<Slot> mSlots;
+        std::vector<std::uint32_t> mFreeSlots;
+        std::uint32_t mVerticesUsed = 0;
+        std::uint32_t mIndicesUsed = 0;
+        std::uint32_t mGrowCount = 0;
+        std::uint32_t mDefragmentCount = 0;
+    };
+
+}
+
+#endif //LEARNOPENGL_GEOMETRYPOOL_H
@@ -0,0 +1,86 @@
+//
+// Created by niek on 11/18/2025.
+//
+
+#ifndef LEARNOPENGL_GLTFLOADER_H
+#define LEARNOPENGL_GLTFLOADER_H
+
+#include "GLCore/MeshData.h"
+#include "GLCore/ThreadPool.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GLCore {
+
+    /** @brief One triangle primitive of a glTF mesh, as ranges into GltfModel::geometry (indices are absolute). */
+    struct GltfPrimitive {
+        std::uint32_t mesh = 0;
+        std::int32_t material = -1;
+        std::uint32_t firstVertex = 0;
+        std::uint32_t vertexCount = 0;
+        std::uint32_t firstIndex = 0;
+        std::uint32_t indexCount = 0;
+        glm::vec3 boundsMin{0.0f};
+        glm::vec3 boundsMax{0.0f};
+    };
+
+    struct GltfMesh {
+        std::string name;
+        std::uint32_t firstPrimitive = 0;
+        std::uint32_t primitiveCount = 0;
+    };
+
+    /** @brief Node of the default scene with its world transform; mesh is -1 for pure transform nodes. */
+    struct GltfNode {
+        std::string name;
+        glm::mat4 world{1.0f};
+        std::int32_t mesh = -1;
+    };
+
+    struct GltfMaterial {
+        std::string name;
+        glm::vec4 baseColorFactor{1.0f};
+        std::string baseColorTexture;   // resolved file path; empty when absent or embedded
+    };
+
+    /**
+     * A loaded glTF 2.0 asset, geometry ready for one VertexBuffer + IndexBuffer upload.
+     * - All primitives share geometry.vertices / geometry.indices back to back; geometry.groups has one
+     *   "mesh/primitive" range per primitive.
+     */
+    struct GltfModel {
+        struct Stats {
+            std::uint64_t bytes = 0;     // JSON + binary buffers read
+            std::uint32_t accessors = 0; // decoded
+            std::uint32_t jobs = 0;      // decode jobs handed to the pool
+            unsigned int threads = 1;
+            float parseMs = 0.0f;
+            float decodeMs = 0.0f;
+            float totalMs = 0.0f;
+            float megabytesPerSecond = 0.0f;
+        };
+
+        MeshData geometry;
+        std::vector<GltfPrimitive> primitives;
+        std::vector<GltfMesh> meshes;
+        std::vector<GltfNode> nodes;
+        std::vector<GltfMaterial> materials;
+        Stats stats{};
+    };
+
+    /**
+     * Loads .gltf (JSON + external or data-URI buffers) and .glb files.
+     * - The JSON is parsed with nlohmann::json straight from a memory-mapped file; .bin buffers and the GLB BIN chunk
+     *   are memory-mapped and read in place.
+     * - Accessors (POSITION, NORMAL, TEXCOORD_0, indices) are decoded on `pool` in slices of up to 64k elements,
+     *   each slice written directly into its final place in the vertex / index arrays.
+     * - Supports float positions/normals, float or normalized u8/u16 texture coordinates, u8/u16/u32 indices and
+     *   strided buffer views; non-triangle primitives are skipped. Sparse accessors and missing files throw.
+     */
+    GltfModel LoadGltf(const std::string& path, ThreadPool& pool = ThreadPool::Shared());
+
+}
+
+#endif //LEARNOPENGL_GLTFLOADER_H
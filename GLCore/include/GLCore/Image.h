@@ -0,0 +1,38 @@
+//
+// Created by niek on 11/23/2025.
+//
+
+#ifndef LEARNOPENGL_IMAGE_H
+#define LEARNOPENGL_IMAGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace GLCore {
+
+    /** @brief Tightly packed 8-bit pixels, rows bottom-up or top-down as decoded; 1, 2 or 4 channels. */
+    struct Image {
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        std::vector<std::uint8_t> pixels;
+
+        std::size_t Bytes() const { return pixels.size(); }
+    };
+
+    /**
+     * Decodes PNG, JPEG, TGA, BMP, PSD, GIF or PNM with stb_image, using TextureLoader's channel rules: grey and
+     * grey + alpha keep their channel count, everything else becomes RGBA. QOI goes to DecodeQoi (always RGBA).
+     * - flipVertically puts the first row at the bottom, as GL samples it.
+     * - Throws std::runtime_error("ERROR::IMAGE::FILE_NOT_FOUND" / "ERROR::IMAGE::DECODE_FAILED").
+     * - Not called LoadImage: windows.h defines that as a macro.
+     */
+    Image LoadImageFile(const std::string& path, bool flipVertically = true);
+    Image DecodeImage(std::span<const std::byte> encoded, bool flipVertically = true, const std::string& name = "<memory>");
+
+}
+
+#endif //LEARNOPENGL_IMAGE_H
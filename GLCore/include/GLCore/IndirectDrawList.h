@@ -0,0 +1,122 @@
+//
+// Created by niek on 11/14/2025.
+//
+
+#ifndef LEARNOPENGL_INDIRECTDRAWLIST_H
+#define LEARNOPENGL_INDIRECTDRAWLIST_H
+
+#include "GLCore/Buffer.h"
+#include "GLCore/Frustum.h"
+#include "GLCore/GeometryPool.h"
+#include "GLCore/StreamBuffer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace GLCore {
+
+    /** @brief Layout of one glMultiDrawElementsIndirect command (matches the GL spec). */
+    struct DrawElementsIndirectCommand {
+        std::uint32_t count = 0;
+        std::uint32_t instanceCount = 1;
+        std::uint32_t firstIndex = 0;
+        std::int32_t baseVertex = 0;
+        std::uint32_t baseInstance = 0;
+    };
+
+    /**
+     * Per-frame list of indexed draws from one GeometryPool, grouped into material buckets.
+     * - Add() frustum-culls each draw on the CPU and records a command plus a blob of per-draw data.
+     * - On 4.3+ Upload() streams all commands and per-draw data to the GPU; Submit(bucket) is one
+     *   glMultiDrawElementsIndirect. Per-draw data is an SSBO at DataBinding(); every command's baseInstance is its
+     *   index in that array, which shaders read through the instanced uint attribute set up by AttachDrawID()
+     *   (or gl_BaseInstance where shader draw parameters exist).
+     * - On older contexts Submit() falls back to a glDrawElementsBaseVertex loop and hands each draw's data to a
+     *   callback (set uniforms there).
+     */
+    class IndirectDrawList {
+    public:
+        struct Stats {
+            std::uint32_t candidates = 0;
+            std::uint32_t culled = 0;
+            std::uint32_t draws = 0;
+            std::uint32_t dropped = 0;     // over maxDrawsPerFrame
+            std::uint32_t buckets = 0;     // non-empty buckets
+            std::uint32_t submitCalls = 0; // GL draw calls issued
+            float uploadMs = 0.0f;
+        };
+
+        using PerDrawCallback = std::function<void(std::uint32_t drawIndex, const void* drawData)>;
+
+        // drawDataSize must equal the std430 array stride of the per-draw struct in the shader
+        IndirectDrawList(std::size_t drawDataSize, std::uint32_t maxDrawsPerFrame, unsigned int dataBinding = 0,
+                         const std::string& label = {});
+
+        // Non-copyable (owns GL buffers)
+        IndirectDrawList(const IndirectDrawList&) = delete;
+        IndirectDrawList& operator=(const IndirectDrawList&) = delete;
+
+        // Feed the draw index to `location` as an instanced uint attribute (indirect path only)
+        void AttachDrawID(VertexArray& vertexArray, unsigned int location, unsigned int binding = 15) const;
+
+        void Begin(const Frustum& frustum);
+        void Begin();   // no culling
+
+        // Returns false when the draw was culled or the list is full; a null drawData uploads zeros
+        bool Add(std::uint32_t bucket, const MeshRange& range, const BoundingSphere& bounds, const void* drawData);
+        bool Add(std::uint32_t bucket, const MeshRange& range, const void* drawData);
+
+        template<class T>
+            requires std::is_trivially_copyable_v<T>
+        bool Add(const std::uint32_t bucket, const MeshRange& range, const BoundingSphere& bounds, const T& drawData) {
+            return Add(bucket, range, bounds, static_cast<const void*>(&drawData));
+        }
+
+        // Write commands and per-draw data; call once after the last Add()
+        void Upload();
+
+        // The GeometryPool (or another VAO with 32-bit indices) must be bound
+        void Submit(std::uint32_t bucket, GLenum mode = GL_TRIANGLES, const PerDrawCallback& perDraw = {});
+
+        // Fence this frame's stream region; call after the last Submit()
+        void End();
+
+        bool IsIndirect() const { return mIndirect; }
+        unsigned int DataBinding() const { return mDataBinding; }
+        const Stats& GetStats() const { return mStats; }
+
+    private:
+        struct Bucket {
+            std::vector<DrawElementsIndirectCommand> commands;
+            std::vector<std::byte> data;
+            std::uint32_t firstDraw = 0;
+        };
+
+        struct DrawID {
+            std::uint32_t id;
+            using Layout = VertexLayout<Attrib<std::uint32_t>>;
+        };
+
+        void BeginFrame();
+
+        std::size_t mDrawDataSize;
+        std::uint32_t mMaxDraws;
+        unsigned int mDataBinding;
+        bool mIndirect;
+        StreamBuffer mStream;
+        Buffer mDrawIDs;
+
+        std::vector<Bucket> mBuckets;
+        Frustum mFrustum{};
+        bool mCull = false;
+        std::size_t mCommandOffset = 0;
+        Stats mStats{};
+    };
+
+}
+
+#endif //LEARNOPENGL_INDIRECTDRAWLIST_H
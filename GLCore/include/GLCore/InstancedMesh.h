@@ -0,0 +1,109 @@
+//
+// Created by niek on 11/14/2025.
+//
+
+#ifndef LEARNOPENGL_INSTANCEDMESH_H
+#define LEARNOPENGL_INSTANCEDMESH_H
+
+#include "GLCore/Buffer.h"
+#include "GLCore/StreamBuffer.h"
+#include "GLCore/VertexArray.h"
+
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <string>
+
+namespace GLCore {
+
+    /**
+     * One indexed mesh drawn many times with per-instance data.
+     * - Instance data is structure-of-arrays: a transform stream (mat4, 4 locations), a color stream (u8vec4) and a
+     *   layer stream (uint, e.g. a TextureArrayPool layer), each with divisor 1. Their locations follow the vertex
+     *   attributes: transform at N..N+3, color at N+4, layer at N+5.
+     * - Instance data lives in a StreamBuffer block per frame; Allocate() hands out ranges of instances in it.
+     *   Draw() uploads the range's slice of every stream (fallback strategies), so a range may be filled any time
+     *   before its own draw, also after other ranges were drawn.
+     * - Draw() uses glDrawElementsInstancedBaseVertexBaseInstance when available (no rebinding per draw),
+     *   otherwise it re-points the instance streams at the range.
+     */
+    class InstancedMesh {
+    public:
+        struct InstanceRange {
+            std::uint32_t first = 0;
+            std::uint32_t count = 0;
+            std::span<glm::mat4> transforms;
+            std::span<glm::u8vec4> colors;
+            std::span<std::uint32_t> layers;
+        };
+
+        struct Stats {
+            std::uint32_t instances = 0;
+            std::uint32_t drawCalls = 0;
+        };
+
+        template<std::ranges::contiguous_range VR, std::ranges::contiguous_range IR>
+            requires VertexType<std::ranges::range_value_t<VR>> && std::same_as<std::ranges::range_value_t<IR>, std::uint32_t>
+        InstancedMesh(const VR& vertices, const IR& indices, const std::uint32_t maxInstancesPerFrame, const std::string& label = {})
+            : InstancedMesh(std::ranges::data(vertices), static_cast<std::uint32_t>(std::ranges::size(vertices)),
+                            VertexFormat::Of<std::ranges::range_value_t<VR>>(),
+                            std::ranges::data(indices), static_cast<std::uint32_t>(std::ranges::size(indices)),
+                            maxInstancesPerFrame, label) {}
+
+        InstancedMesh(const void* vertices, std::uint32_t vertexCount, const VertexFormat& format,
+                      const std::uint32_t* indices, std::uint32_t indexCount,
+                      std::uint32_t maxInstancesPerFrame, const std::string& label = {});
+
+        // Non-copyable (owns GL objects)
+        InstancedMesh(const InstancedMesh&) = delete;
+        InstancedMesh& operator=(const InstancedMesh&) = delete;
+
+        // Frame bracketing of the instance stream
+        void BeginFrame();
+        void EndFrame();
+
+        // Reserve `count` instances this frame; write their data through the returned spans before Draw()
+        InstanceRange Allocate(std::uint32_t count);
+
+        void Draw(const InstanceRange& range, GLenum mode = GL_TRIANGLES);
+
+        std::uint32_t TransformLocation() const { return mInstanceLocation; }
+        std::uint32_t ColorLocation() const { return mInstanceLocation + 4; }
+        std::uint32_t LayerLocation() const { return mInstanceLocation + 5; }
+        const Stats& GetStats() const { return mStats; }
+
+    private:
+        struct TransformColumns {
+            glm::vec4 c0, c1, c2, c3;
+            using Layout = VertexLayout<Attrib<glm::vec4>, Attrib<glm::vec4>, Attrib<glm::vec4>, Attrib<glm::vec4>>;
+        };
+        struct InstanceColor {
+            glm::u8vec4 color;
+            using Layout = VertexLayout<Attrib<glm::u8vec4>>;
+        };
+
+        struct InstanceLayer {
+            std::uint32_t layer;
+            using Layout = VertexLayout<Attrib<std::uint32_t>>;
+        };
+
+        static constexpr unsigned int kTransformBinding = 1;
+        static constexpr unsigned int kColorBinding = 2;
+        static constexpr unsigned int kLayerBinding = 3;
+
+        Buffer mVertices;
+        Buffer mIndices;
+        std::uint32_t mIndexCount;
+        std::uint32_t mInstanceLocation;
+        std::uint32_t mMaxInstances;
+        StreamBuffer mStream;
+        VertexArray mVertexArray;
+
+        StreamAllocation mBlock{};   // this frame's SoA block: [transforms][colors][layers]
+        std::uint32_t mCursor = 0;   // instances allocated this frame
+        Stats mStats{};
+    };
+
+}
+
+#endif //LEARNOPENGL_INSTANCEDMESH_H
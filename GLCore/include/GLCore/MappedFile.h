@@ -0,0 +1,52 @@
+//
+// Created by niek on 11/18/2025.
+//
+
+#ifndef LEARNOPENGL_MAPPEDFILE_H
+#define LEARNOPENGL_MAPPEDFILE_H
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string_view>
+
+namespace GLCore {
+
+    /**
+     * Read-only memory mapping of a whole file (mmap / MapViewOfFile).
+     * - Pages are faulted in on first touch, so parsers read straight from the page cache without a read() copy.
+     * - Throws std::runtime_error when the file cannot be opened or mapped; an empty file maps to an empty span.
+     */
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        explicit MappedFile(const std::filesystem::path& path);
+        ~MappedFile();
+
+        // Non-copyable (owns the mapping), movable
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        const std::byte* Data() const { return mData; }
+        std::size_t Size() const { return mSize; }
+        std::span<const std::byte> Bytes() const { return {mData, mSize}; }
+        std::string_view Text() const { return {reinterpret_cast<const char*>(mData), mSize}; }
+        bool IsOpen() const { return mOpen; }
+
+    private:
+        void Close();
+
+        const std::byte* mData = nullptr;
+        std::size_t mSize = 0;
+        bool mOpen = false;
+#ifdef _WIN32
+        void* mFile = nullptr;
+        void* mMapping = nullptr;
+#endif
+    };
+
+}
+
+#endif //LEARNOPENGL_MAPPEDFILE_H
@@ -0,0 +1,47 @@
+//
+// Created by niek on 11/15/2025.
+//
+
+#ifndef LEARNOPENGL_MESHDATA_H
+#define LEARNOPENGL_MESHDATA_H
+
+#include "GLCore/VertexLayout.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GLCore {
+
+    /** @brief Full-precision vertex produced by the importers (position, normal, uv). */
+    struct MeshVertex {
+        glm::vec3 position{0.0f};
+        glm::vec3 normal{0.0f};
+        glm::vec2 uv{0.0f};
+
+        using Layout = VertexLayout<Attrib<glm::vec3>, Attrib<glm::vec3>, Attrib<glm::vec2>>;
+    };
+
+    /** @brief Named index range of a MeshData (OBJ `g`/`o`, or one LOD of a chain). */
+    struct MeshGroup {
+        std::string name;
+        std::uint32_t firstIndex = 0;
+        std::uint32_t indexCount = 0;
+    };
+
+    /** @brief CPU-side indexed triangle mesh, as loaded from disk and fed to the optimizers. */
+    struct MeshData {
+        std::vector<MeshVertex> vertices;
+        std::vector<std::uint32_t> indices;
+        std::vector<MeshGroup> groups;   // empty: one range over all indices
+    };
+
+    // Wavefront OBJ: v / vt / vn / f / g / o (polygons are fan-triangulated, negative indices allowed); throws on I/O errors.
+    // LoadObj runs the parallel importer from ObjLoader.h on ThreadPool::Shared(). SaveObj writes v / vt / vn / g / f
+    // only (materials are not kept), floats with max_digits10 so they read back bit-exact.
+    MeshData LoadObj(const std::string& path);
+    void SaveObj(const MeshData& mesh, const std::string& path);
+
+}
+
+#endif //LEARNOPENGL_MESHDATA_H
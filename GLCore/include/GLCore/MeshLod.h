@@ -0,0 +1,78 @@
+//
+// Created by niek on 11/16/2025.
+//
+
+#ifndef LEARNOPENGL_MESHLOD_H
+#define LEARNOPENGL_MESHLOD_H
+
+#include "GLCore/MeshData.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace GLCore {
+
+    /** @brief One level of detail: an index range into the shared index buffer and its geometric error (mesh units). */
+    struct MeshLod {
+        std::uint32_t firstIndex = 0;
+        std::uint32_t indexCount = 0;
+        float error = 0.0f;
+    };
+
+    struct LodSettings {
+        std::uint32_t maxLods = 6;       // including LOD 0
+        float reduction = 0.5f;          // triangle ratio between consecutive levels
+        float maxError = 0.05f;          // relative to the mesh extent
+        std::uint32_t minTriangles = 64;
+    };
+
+    /**
+     * Builds a LOD chain with MeshOptimizer::Simplify.
+     * - Every level indexes the same vertices; the levels are appended to mesh.indices (LOD 0 is the input range).
+     * - Each level is simplified from LOD 0 and vertex-cache optimized; the chain stops early when a level would not
+     *   remove at least 10% more triangles or would exceed maxError.
+     * - mesh.groups is replaced with one "lodN error=E" group per level, which SaveObj/LoadObj round-trip.
+     */
+    std::vector<MeshLod> GenerateLods(MeshData& mesh, const LodSettings& settings = {});
+
+    // Recover the chain from the "lodN error=E" groups written by GenerateLods (empty when there are none)
+    std::vector<MeshLod> LodsFromGroups(const MeshData& mesh);
+
+    /**
+     * Runtime LOD choice by projected screen-space error.
+     * - A level is acceptable when its error, projected at the object's distance, is at most pixelThreshold.
+     * - Hysteresis: switching coarser needs error <= threshold * (1 - hysteresis), switching finer only happens once the
+     *   current level exceeds threshold * (1 + hysteresis), so objects near a boundary do not flip every frame.
+     */
+    class LodSelector {
+    public:
+        struct Stats {
+            std::uint32_t objects = 0;
+            std::uint32_t switches = 0;
+            std::uint64_t trianglesFull = 0;      // what LOD 0 everywhere would draw
+            std::uint64_t trianglesSelected = 0;
+        };
+
+        explicit LodSelector(float pixelThreshold = 1.0f, float hysteresis = 0.25f);
+
+        // Vertical field of view in radians and viewport height in pixels
+        void SetProjection(float fovY, float viewportHeight);
+
+        void BeginFrame() { mStats = {}; }
+
+        // `distance` to the camera, `scale` of the object (world units per mesh unit)
+        std::uint32_t Select(std::span<const MeshLod> lods, float distance, float scale, std::uint32_t currentLod);
+
+        const Stats& GetStats() const { return mStats; }
+
+    private:
+        float mPixelThreshold;
+        float mHysteresis;
+        float mPixelsPerUnit = 1.0f;   // pixels covered by one world unit at distance 1
+        Stats mStats{};
+    };
+
+}
+
+#endif //LEARNOPENGL_MESHLOD_H
@@ -0,0 +1,54 @@
+//
+// Created by niek on 11/15/2025.
+//
+
+#ifndef LEARNOPENGL_MESHOPTIMIZER_H
+#define LEARNOPENGL_MESHOPTIMIZER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace GLCore::MeshOptimizer {
+
+    /**
+     * Post-transform cache statistics of an index buffer, simulated with a FIFO cache.
+     * - acmr: cache misses per triangle (0.5 is ideal for large regular meshes, 3.0 is the worst case)
+     * - atvr: cache misses per referenced vertex (1.0 is ideal)
+     */
+    struct VertexCacheStats {
+        float acmr = 0.0f;
+        float atvr = 0.0f;
+    };
+
+    VertexCacheStats AnalyzeVertexCache(std::span<const std::uint32_t> indices, std::uint32_t vertexCount,
+                                        std::uint32_t cacheSize = 16);
+
+    // Tipsify (Sander et al. 2007): reorders triangles for the post-transform cache in linear time
+    std::vector<std::uint32_t> OptimizeVertexCache(std::span<const std::uint32_t> indices, std::uint32_t vertexCount,
+                                                   std::uint32_t cacheSize = 16);
+
+    // Reorders clusters of cache-optimized triangles front to back from the outside in, so fewer pixels are shaded twice.
+    // Clusters are only split where the cache ACMR stays within `threshold` of the unsplit cluster.
+    // Positions are read as three floats at the start of each `vertexStride`-byte vertex.
+    std::vector<std::uint32_t> OptimizeOverdraw(std::span<const std::uint32_t> indices, const void* vertices,
+                                                std::uint32_t vertexCount, std::size_t vertexStride,
+                                                std::uint32_t cacheSize = 16, float threshold = 1.05f);
+
+    // Quadric error metric edge collapse onto existing vertices, so every result shares the input vertex buffer.
+    // Stops at `targetIndexCount` or when the next collapse would exceed `targetError` (relative to the mesh extent).
+    // Border vertices only slide along their border; vertices on attribute seams (same position, several vertices) stay.
+    // `resultError` receives the reached error, relative to the mesh extent.
+    std::vector<std::uint32_t> Simplify(std::span<const std::uint32_t> indices, const void* vertices,
+                                        std::uint32_t vertexCount, std::size_t vertexStride,
+                                        std::size_t targetIndexCount, float targetError, float* resultError = nullptr);
+
+    // Reorders vertices by first use so fetches walk memory linearly; unreferenced vertices are dropped.
+    // Rewrites `indices` in place and returns the new vertex count.
+    std::uint32_t OptimizeVertexFetch(void* vertices, std::uint32_t vertexCount, std::size_t vertexStride,
+                                      std::span<std::uint32_t> indices);
+
+}
+
+#endif //LEARNOPENGL_MESHOPTIMIZER_H
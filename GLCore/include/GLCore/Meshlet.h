@@ -0,0 +1,119 @@
+//
+// Created by niek on 11/17/2025.
+//
+
+#ifndef LEARNOPENGL_MESHLET_H
+#define LEARNOPENGL_MESHLET_H
+
+#include "GLCore/Frustum.h"
+#include "GLCore/IndirectDrawList.h"
+#include "GLCore/MeshData.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace GLCore {
+
+    /**
+     * A small cluster of triangles with its own bounds.
+     * - Triangles are a contiguous range of MeshletMesh::indices, so a cluster draws as one indexed range.
+     * - Backface cone: every triangle faces away from any viewer for which
+     *   dot(bounds.center - eye, coneAxis) >= coneCutoff * |bounds.center - eye| + bounds.radius.
+     *   coneCutoff = 1 marks clusters whose normals spread too far to ever be rejected.
+     */
+    struct Meshlet {
+        std::uint32_t firstIndex = 0;
+        std::uint32_t indexCount = 0;
+        std::uint32_t vertexCount = 0;     // unique vertices referenced
+        BoundingSphere bounds{};
+        glm::vec3 coneAxis{0.0f, 0.0f, 1.0f};
+        float coneCutoff = 1.0f;
+    };
+
+    struct MeshletSettings {
+        std::uint32_t maxVertices = 64;
+        std::uint32_t maxTriangles = 124;
+        float coneWeight = 0.5f;           // 0 = spatially compact clusters, 1 = favour tight normal cones
+    };
+
+    /**
+     * Meshlet bounds in structure-of-arrays form, padded to a multiple of 4 so the culler can test four clusters per
+     * SSE instruction. Padding lanes are zero and their results are ignored.
+     */
+    struct MeshletCullData {
+        std::vector<float> centerX, centerY, centerZ, radius;
+        std::vector<float> axisX, axisY, axisZ, cutoff;
+    };
+
+    /** @brief Cluster-ordered index buffer plus per-meshlet bounds; upload `indices` in place of the original ones. */
+    struct MeshletMesh {
+        std::vector<std::uint32_t> indices;
+        std::vector<Meshlet> meshlets;
+        MeshletCullData cullData;
+        BoundingSphere bounds{};
+    };
+
+    /**
+     * Splits a triangle list into meshlets of at most maxVertices unique vertices and maxTriangles triangles.
+     * - Greedy growth over shared vertices: the next triangle is the neighbour that adds the fewest new vertices,
+     *   ties broken by distance to the cluster centre blended with normal agreement (coneWeight).
+     * - Reads positions as 3 floats at offset 0 of each `stride`-byte vertex; vertices are not modified.
+     */
+    MeshletMesh BuildMeshlets(std::span<const std::uint32_t> indices, const void* vertices, std::uint32_t vertexCount,
+                              std::size_t stride, const MeshletSettings& settings = {});
+    MeshletMesh BuildMeshlets(const MeshData& mesh, const MeshletSettings& settings = {});
+
+    /**
+     * CPU cluster culling that feeds an IndirectDrawList.
+     * - Per instance: the mesh sphere is frustum tested first, then all meshlets are tested against the frustum and
+     *   their backface cone, four at a time with SSE (scalar fallback elsewhere).
+     * - Surviving meshlets that are adjacent in the index buffer are merged into one indirect command, so a fully
+     *   visible mesh still costs a single draw.
+     * - Instance transforms may rotate, translate and scale uniformly; non-uniform scale makes the cone test unsafe.
+     */
+    class MeshletCuller {
+    public:
+        struct Stats {
+            std::uint32_t instances = 0;
+            std::uint32_t instancesCulled = 0;   // whole mesh outside the frustum
+            std::uint32_t meshlets = 0;          // tested
+            std::uint32_t frustumCulled = 0;
+            std::uint32_t backfaceCulled = 0;
+            std::uint32_t draws = 0;             // commands added after merging
+            std::uint64_t trianglesTotal = 0;
+            std::uint64_t trianglesSubmitted = 0;
+            float cullMs = 0.0f;
+        };
+
+        // Culling and cone tests use the world-space frustum and eye position; resets stats
+        void Begin(const Frustum& frustum, const glm::vec3& eye);
+
+        /**
+         * Cull one instance of `mesh`, which lives at `range` inside the draw list's GeometryPool (or other VAO).
+         * Each surviving run of meshlets is added to `drawList` with a copy of `drawData`; returns the meshlets kept.
+         */
+        std::uint32_t Cull(const MeshletMesh& mesh, const MeshRange& range, const glm::mat4& model,
+                           IndirectDrawList& drawList, std::uint32_t bucket, const void* drawData);
+
+        template<class T>
+            requires std::is_trivially_copyable_v<T>
+        std::uint32_t Cull(const MeshletMesh& mesh, const MeshRange& range, const glm::mat4& model,
+                           IndirectDrawList& drawList, const std::uint32_t bucket, const T& drawData) {
+            return Cull(mesh, range, model, drawList, bucket, static_cast<const void*>(&drawData));
+        }
+
+        const Stats& GetStats() const { return mStats; }
+
+    private:
+        Frustum mFrustum{};
+        glm::vec3 mEye{0.0f};
+        std::vector<std::uint8_t> mVisible;
+        Stats mStats{};
+    };
+
+}
+
+#endif //LEARNOPENGL_MESHLET_H
@@ -0,0 +1,49 @@
+//
+// Created by niek on 11/23/2025.
+//
+
+#ifndef LEARNOPENGL_MIPGENERATOR_H
+#define LEARNOPENGL_MIPGENERATOR_H
+
+#include "GLCore/Cpu.h"
+#include "GLCore/Image.h"
+#include "GLCore/ThreadPool.h"
+
+#include <span>
+#include <vector>
+
+namespace GLCore {
+
+    enum class MipFilter {
+        Box,        // 2x2 average
+        Kaiser,     // Kaiser-windowed sinc, radius 2 (alpha 4): sharp with little ringing; the default
+        Lanczos3    // radius 3: sharpest, some ringing on hard edges
+    };
+
+    struct MipSettings {
+        MipFilter filter = MipFilter::Kaiser;
+        bool srgb = true;               // color channels are sRGB-encoded: filter in linear light, re-encode after
+        bool premultiplyAlpha = true;   // weight color by alpha while filtering (2- and 4-channel images)
+        bool wrap = false;              // tiling texture: taps wrap around the edges instead of clamping
+        int maxLevels = 0;              // including level 0; 0 = down to 1x1
+        SimdLevel maxSimd = SimdLevel::AVX2;   // cap on the dispatched kernels (benchmarks, comparisons)
+    };
+
+    /**
+     * CPU mip chain generation for the asset pipeline (glGenerateMipmap filters in whatever space and with whatever
+     * kernel the driver picks, and costs GPU time at load).
+     * - Each level is filtered from the previous one: 8-bit -> linear float (LUT), separable 2:1 kernel, clamp,
+     *   -> 8-bit (exactly rounded sRGB encode). Levels are processed in bands of rows spread over `pool`.
+     * - The horizontal (RGBA) and vertical passes have SSE2 and AVX2 + FMA kernels picked at runtime from
+     *   DetectSimdLevel(); results match the scalar path to within one 8-bit step.
+     * - Returns the full chain with a copy of `source` as level 0; sizes halve (rounded down, at least 1) per level.
+     */
+    std::vector<Image> GenerateMips(const Image& source, const MipSettings& settings = {}, ThreadPool& pool = ThreadPool::Shared());
+
+    // Many images at once: images are spread over the pool as well as the bands inside each image
+    std::vector<std::vector<Image>> GenerateMips(std::span<const Image> sources, const MipSettings& settings = {},
+                                                 ThreadPool& pool = ThreadPool::Shared());
+
+}
+
+#endif //LEARNOPENGL_MIPGENERATOR_H
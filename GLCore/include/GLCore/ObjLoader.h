@@ -0,0 +1,41 @@
+//
+// Created by niek on 11/19/2025.
+//
+
+#ifndef LEARNOPENGL_OBJLOADER_H
+#define LEARNOPENGL_OBJLOADER_H
+
+#include "GLCore/MeshData.h"
+#include "GLCore/ThreadPool.h"
+
+#include <cstdint>
+#include <string>
+
+namespace GLCore {
+
+    struct ObjLoadStats {
+        std::uint64_t bytes = 0;
+        std::uint32_t chunks = 0;
+        unsigned int threads = 1;
+        std::uint64_t corners = 0;      // face corners before deduplication
+        float parseMs = 0.0f;           // parallel: chunk parsing
+        float mergeMs = 0.0f;           // attribute concatenation + index resolution
+        float dedupMs = 0.0f;           // corner -> vertex hashing and triangulation
+        float totalMs = 0.0f;
+        float megabytesPerSecond = 0.0f;
+    };
+
+    /**
+     * Parallel Wavefront OBJ import (same format support as LoadObj(path), which forwards here with the shared pool).
+     * - The file is memory-mapped and cut into line-aligned chunks; each chunk is parsed on `pool` with std::from_chars
+     *   into chunk-local attribute, face and group lists.
+     * - Chunks are merged in file order and relative (negative) indices resolved against the chunk's global base, so the
+     *   result is identical for any thread count.
+     * - Corners (position/uv/normal triples) are deduplicated with open-addressing hash tables, first per chunk in
+     *   parallel, then globally; vertices are numbered in order of first use.
+     */
+    MeshData LoadObj(const std::string& path, ThreadPool& pool, ObjLoadStats* stats = nullptr);
+
+}
+
+#endif //LEARNOPENGL_OBJLOADER_H
@@ -0,0 +1,82 @@
+//
+// Created by niek on 11/12/2025.
+//
+
+#ifndef LEARNOPENGL_OFFSETALLOCATOR_H
+#define LEARNOPENGL_OFFSETALLOCATOR_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace GLCore {
+
+    /**
+     * O(1) range allocator for GPU buffers (TLSF-style two-level segregated free lists).
+     * - Manages offsets only; the caller owns the memory.
+     * - Free ranges are binned by a small floating point size class (3-bit mantissa), and a two-level
+     *   bitmask finds the first non-empty bin that is guaranteed to fit in constant time. Only when there is
+     *   none is the bin the size rounds down to searched for a range that fits (exact fits, a full allocator).
+     * - Adjacent free ranges are merged on Free().
+     */
+    class OffsetAllocator {
+    public:
+        static constexpr std::uint32_t kNoSpace = 0xFFFFFFFFu;
+
+        struct Allocation {
+            std::uint32_t offset = kNoSpace;
+            std::uint32_t metadata = kNoSpace; // internal node index
+
+            bool Valid() const { return offset != kNoSpace; }
+        };
+
+        struct StorageReport {
+            std::uint32_t totalFree = 0;
+            std::uint32_t largestFree = 0;
+        };
+
+        explicit OffsetAllocator(std::uint32_t size = 0);
+
+        Allocation Allocate(std::uint32_t size);
+        void Free(Allocation allocation);
+
+        // Drop every allocation and start over with a new capacity
+        void Reset(std::uint32_t size);
+
+        std::uint32_t Capacity() const { return mSize; }
+        std::uint32_t AllocationSize(Allocation allocation) const;
+        StorageReport GetStorageReport() const;
+
+    private:
+        static constexpr std::uint32_t kTopBins = 32;
+        static constexpr std::uint32_t kLeafBinsPerTop = 8;
+        static constexpr std::uint32_t kBinCount = kTopBins * kLeafBinsPerTop;
+        static constexpr std::uint32_t kUnused = 0xFFFFFFFFu;
+
+        struct Node {
+            std::uint32_t offset = 0;
+            std::uint32_t size = 0;
+            std::uint32_t binPrev = kUnused;
+            std::uint32_t binNext = kUnused;
+            std::uint32_t neighborPrev = kUnused;
+            std::uint32_t neighborNext = kUnused;
+            bool used = false;
+        };
+
+        std::uint32_t InsertFreeNode(std::uint32_t offset, std::uint32_t size);
+        void RemoveFreeNode(std::uint32_t nodeIndex);   // unlink and recycle the node
+        void UnlinkFreeNode(std::uint32_t nodeIndex);   // take it off its bin list, keep the node
+        std::uint32_t NewNode();
+
+        std::uint32_t mSize = 0;
+        std::uint32_t mFreeStorage = 0;
+        std::uint32_t mUsedBinsTop = 0;
+        std::array<std::uint8_t, kTopBins> mUsedBins{};
+        std::array<std::uint32_t, kBinCount> mBinHeads{};
+        std::vector<Node> mNodes;
+        std::vector<std::uint32_t> mFreeNodes;
+    };
+
+}
+
+#endif //LEARNOPENGL_OFFSETALLOCATOR_H
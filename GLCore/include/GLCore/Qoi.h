@@ -0,0 +1,41 @@
+//
+// Created by niek on 11/28/2025.
+//
+
+#ifndef LEARNOPENGL_QOI_H
+#define LEARNOPENGL_QOI_H
+
+#include "GLCore/Image.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace GLCore {
+
+    // True when `encoded` starts with the QOI magic ("qoif")
+    bool IsQoi(std::span<const std::byte> encoded);
+
+    /**
+     * Encodes an image as QOI ("Quite OK Image" format, qoiformat.org): a lossless, byte-oriented format that
+     * decodes several times faster than PNG at somewhat larger files. It is the asset build's intermediate format.
+     * - QOI stores 3 or 4 channels: grey becomes RGB and grey + alpha becomes RGBA. Images without alpha (1 channel,
+     *   or 4 channels that are all opaque) are written with 3 channels.
+     * - Rows are written top row first, as QOI defines it; pass flipVertically for images decoded bottom row first.
+     * - `srgb` only sets the header's colorspace field.
+     */
+    std::vector<std::uint8_t> EncodeQoi(const Image& image, bool flipVertically = false, bool srgb = true);
+
+    /**
+     * Decodes QOI into 4-channel RGBA (also for 3-channel files). flipVertically puts the first row at the bottom,
+     * as LoadImageFile does.
+     * - DecodeImage() / LoadImageFile() and TextureLoader recognize QOI by its magic and decode it here, not with stb_image.
+     * - Every chunk is bounds-checked; malformed input throws std::runtime_error("ERROR::IMAGE::DECODE_FAILED").
+     */
+    Image DecodeQoi(std::span<const std::byte> encoded, bool flipVertically = true, const std::string& name = "<memory>");
+
+}
+
+#endif //LEARNOPENGL_QOI_H
@@ -0,0 +1,99 @@
+//
+// Created by niek on 11/7/2025.
+//
+
+#ifndef LEARNOPENGL_RENDERTARGET_H
+#define LEARNOPENGL_RENDERTARGET_H
+
+#include "glad/glad.h"
+
+#include <memory>
+#include <vector>
+
+namespace GLCore {
+
+    /**
+     * An off-screen framebuffer with a color texture and an optional depth-stencil renderbuffer.
+     * - The allocated size may be larger than the logical size it is used at (see RenderTargetPool).
+     * - Bind() sets the viewport to the logical size.
+     * - RAII: GL objects deleted in destructor.
+     */
+    class RenderTarget {
+    public:
+        RenderTarget(int width, int height, GLenum colorFormat = GL_RGBA8, bool depth = true);
+        ~RenderTarget();
+
+        // Non-copyable (owning handles)
+        RenderTarget(const RenderTarget&) = delete;
+        RenderTarget& operator=(const RenderTarget&) = delete;
+
+        // Binding
+        void Bind() const;
+        static void Unbind();
+
+        // Copy the logical area to the default framebuffer, stretched to (width, height)
+        void BlitToScreen(int width, int height) const;
+
+        // Accessors
+        unsigned int FramebufferID() const { return mFramebuffer; }
+        unsigned int ColorTexture() const { return mColor; }
+        GLenum ColorFormat() const { return mColorFormat; }
+        bool HasDepth() const { return mDepth != 0; }
+
+        // Size the target is currently used at
+        int Width() const { return mWidth; }
+        int Height() const { return mHeight; }
+
+        // Size of the GL storage (>= logical size)
+        int AllocatedWidth() const { return mAllocatedWidth; }
+        int AllocatedHeight() const { return mAllocatedHeight; }
+
+        void SetLogicalSize(int width, int height);
+
+    private:
+        unsigned int mFramebuffer = 0;
+        unsigned int mColor = 0;
+        unsigned int mDepth = 0;
+        GLenum mColorFormat = GL_RGBA8;
+        int mWidth = 0, mHeight = 0;
+        int mAllocatedWidth = 0, mAllocatedHeight = 0;
+    };
+
+    /**
+     * Hands out render targets whose storage is rounded up to size buckets.
+     * While a window is dragged the bucket rarely changes, so Acquire() keeps returning the
+     * same allocation and only its logical size is updated.
+     */
+    class RenderTargetPool {
+    public:
+        explicit RenderTargetPool(int bucketGranularity = 256);
+
+        // Returns a target with at least (width, height) of storage; owned by the pool
+        RenderTarget* Acquire(int width, int height, GLenum colorFormat = GL_RGBA8, bool depth = true);
+
+        // Return a target to the pool; it stays allocated until reused or trimmed
+        void Release(const RenderTarget* target);
+
+        // Delete every released target
+        void Trim();
+
+        // Number of GL allocations made over the pool's lifetime
+        size_t AllocationCount() const { return mAllocationCount; }
+        size_t Size() const { return mEntries.size(); }
+
+    private:
+        int Bucket(int size) const;
+
+        struct Entry {
+            std::unique_ptr<RenderTarget> target;
+            bool inUse = false;
+        };
+
+        std::vector<Entry> mEntries;
+        int mGranularity;
+        size_t mAllocationCount = 0;
+    };
+
+}
+
+#endif //LEARNOPENGL_RENDERTARGET_H
@@ -21,11 +21,16 @@ namespace GLCore {
         // Construct and link a shader program from vertex/fragment file paths.
         explicit Shader(const char* vertexPath, const char* fragmentPath);
 
+        // Construct and link a shader program from in-memory GLSL sources (used by GLCore's built-in renderers).
+        static Shader FromSource(const char* vertexSource, const char* fragmentSource, const std::string& label);
+
         ~Shader();
 
-        // Non-copyable (owning handle)
+        // Non-copyable (owning handle), movable
         Shader(const Shader&) = delete;
         Shader& operator=(const Shader&) = delete;
+        Shader(Shader&& other) noexcept;
+        Shader& operator=(Shader&& other) noexcept;
 
         // Binding
         void Bind() const;
@@ -37,9 +42,16 @@ namespace GLCore {
         void SetBool(const std::string& name, bool value) const;
         void SetInt(const std::string& name, int value) const;
         void SetFloat(const std::string& name, float value) const;
+        void SetVec4(const std::string& name, const glm::vec4& value) const;
         void SetMat4(const std::string& name, const glm::mat4& value) const;
 
     private:
+        Shader() = default;
+
+        // Helper: compile both stages, link and label
+        void Build(const char* vertexSource, const char* fragmentSource,
+                   const std::string& vertexLabel, const std::string& fragmentLabel, const std::string& programLabel);
+
         // Helper: read a text-file to string
         static std::string ReadTextFile(const char* path);
 
@@ -0,0 +1,103 @@
+//
+// Created by niek on 11/13/2025.
+//
+
+#ifndef LEARNOPENGL_SPRITEBATCH_H
+#define LEARNOPENGL_SPRITEBATCH_H
+
+#include "GLCore/Buffer.h"
+#include "GLCore/Shader.h"
+#include "GLCore/StreamBuffer.h"
+#include "GLCore/VertexArray.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace GLCore {
+
+    class Atlas;
+
+    enum class BlendMode : std::uint8_t {
+        Opaque,
+        Alpha,
+        Additive,
+        Premultiplied
+    };
+
+    /** @brief One textured quad. Textures are GL_TEXTURE_2D_ARRAY objects addressed by (texture, layer). */
+    struct Sprite {
+        glm::vec2 position{0.0f};              // center, in the units of the Begin() projection
+        glm::vec2 size{1.0f};
+        float rotation = 0.0f;                 // radians
+        glm::vec4 uv{0.0f, 0.0f, 1.0f, 1.0f};  // u0, v0, u1, v1
+        glm::u8vec4 color{255};
+        unsigned int texture = 0;              // 0 = built-in white texture
+        std::uint16_t layer = 0;
+        BlendMode blend = BlendMode::Alpha;
+        std::int16_t order = 0;                // lower draws first; sorting never crosses orders
+    };
+
+    /**
+     * Batched 2D quad renderer.
+     * - Draw() only records sprites; End() sorts them by (order, blend, texture), writes the vertices
+     *   straight into a StreamBuffer and issues one draw per run of equal state.
+     * - Images packed into texture arrays share a batch, so layers do not break batches; only a change of
+     *   array texture or blend mode does.
+     */
+    class SpriteBatch {
+    public:
+        struct Stats {
+            std::uint32_t sprites = 0;
+            std::uint32_t drawCalls = 0;
+            std::uint32_t textureBinds = 0;
+            std::uint32_t blendChanges = 0;
+            std::uint32_t dropped = 0;   // sprites beyond the per-frame capacity
+            double cpuMs = 0.0;          // time spent in End()
+        };
+
+        struct SpriteVertex {
+            glm::vec2 position;
+            glm::vec2 uv;
+            glm::u8vec4 color;
+            std::uint32_t layer;
+
+            using Layout = VertexLayout<Attrib<glm::vec2>, Attrib<glm::vec2>, Attrib<glm::u8vec4>, Attrib<std::uint32_t>>;
+        };
+
+        explicit SpriteBatch(std::uint32_t maxSpritesPerBatch = 131072);
+        ~SpriteBatch();
+
+        // Non-copyable (owns GL objects)
+        SpriteBatch(const SpriteBatch&) = delete;
+        SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+        void Begin(const glm::mat4& projection);
+        void Draw(const Sprite& sprite);
+        // Sprite `id` of `atlas`: overrides texture, layer and uv; size and everything else come from `sprite`
+        void Draw(const Atlas& atlas, std::uint32_t id, Sprite sprite);
+        void End();
+
+        // Stats of the last End()
+        const Stats& GetStats() const { return mStats; }
+
+    private:
+        void SortSprites();
+        static void ApplyBlend(BlendMode mode);
+
+        std::uint32_t mCapacity;
+        Shader mShader;
+        StreamBuffer mStream;
+        IndexBuffer mQuadIndices;
+        VertexArray mVertexArray;
+        unsigned int mWhiteTexture = 0;
+
+        glm::mat4 mProjection{1.0f};
+        std::vector<Sprite> mSprites;
+        std::vector<std::uint64_t> mKeys;       // sort keys, index in the low 32 bits
+        std::vector<std::uint64_t> mSortScratch;
+        Stats mStats{};
+    };
+
+}
+
+#endif //LEARNOPENGL_SPRITEBATCH_H
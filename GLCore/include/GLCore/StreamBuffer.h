@@ -0,0 +1,104 @@
+//
+// Created by niek on 11/11/2025.
+//
+
+#ifndef LEARNOPENGL_STREAMBUFFER_H
+#define LEARNOPENGL_STREAMBUFFER_H
+
+#include "glad/glad.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace GLCore {
+
+    /** @brief How a StreamBuffer gets CPU-written data to the GPU. */
+    enum class StreamStrategy {
+        Auto,             // PersistentMapped when buffer storage is available, Orphaning otherwise
+        PersistentMapped, // glBufferStorage + persistent coherent map, fenced per-frame regions
+        Orphaning,        // CPU staging, glBufferData(nullptr) at frame start + glBufferSubData
+        SubData           // CPU staging + glBufferSubData into a single region (driver synchronizes)
+    };
+
+    /** @brief A suballocation: write `size` bytes to `data`, source them on the GPU at `offset`. */
+    struct StreamAllocation {
+        void* data = nullptr;
+        std::size_t offset = 0;
+        std::size_t size = 0;
+
+        explicit operator bool() const { return data != nullptr; }
+    };
+
+    /**
+     * A ring buffer for per-frame dynamic data (particles, UI, debug lines, instance data).
+     * - Split into framesInFlight regions; BeginFrame() waits on the fence of the region it reuses.
+     * - Allocate() hands out aligned ranges of the current region; Flush() publishes staged writes
+     *   (only needed by the fallback strategies, where data is staged on the CPU until then).
+     * - RAII: buffer unmapped/deleted and fences released in destructor.
+     */
+    class StreamBuffer {
+    public:
+        struct Stats {
+            std::size_t bytesThisFrame = 0;
+            std::size_t bytesTotal = 0;
+            double waitMs = 0.0;          // time BeginFrame() blocked on the GPU last frame
+            unsigned int stalls = 0;      // frames that had to wait at all
+            unsigned int failedAllocations = 0;
+        };
+
+        StreamBuffer(std::size_t bytesPerFrame, unsigned int framesInFlight = 3,
+                     StreamStrategy strategy = StreamStrategy::Auto, const std::string& label = {});
+        ~StreamBuffer();
+
+        // Non-copyable (owning handles), movable
+        StreamBuffer(const StreamBuffer&) = delete;
+        StreamBuffer& operator=(const StreamBuffer&) = delete;
+        StreamBuffer(StreamBuffer&& other) noexcept;
+        StreamBuffer& operator=(StreamBuffer&& other) noexcept;
+
+        // Frame bracketing
+        void BeginFrame();
+        void EndFrame();
+
+        // Returns an empty allocation when the current region is exhausted
+        StreamAllocation Allocate(std::size_t size, std::size_t alignment = 16);
+
+        // Make writes since the last flush visible to draws issued after this call
+        void Flush();
+
+        // Upload [offset, offset + size) (GPU offsets, as in StreamAllocation) now, for callers that write parts of
+        // one allocation between draws; pair with SkipFlush() so Flush() / EndFrame() do not upload it again
+        void FlushRange(std::size_t offset, std::size_t size);
+        void SkipFlush() { mFlushedCursor = mCursor; }
+
+        unsigned int ID() const { return mID; }
+        StreamStrategy Strategy() const { return mStrategy; }
+        std::size_t CapacityPerFrame() const { return mRegionSize; }
+        const Stats& GetStats() const { return mStats; }
+
+        static const char* StrategyName(StreamStrategy strategy);
+
+    private:
+        void Release();
+        std::size_t RegionBase() const;
+
+        unsigned int mID = 0;
+        StreamStrategy mStrategy = StreamStrategy::Auto;
+        std::size_t mRegionSize = 0;
+        unsigned int mFrames = 1;
+        unsigned int mFrameIndex = 0;
+
+        std::size_t mCursor = 0;        // bytes used in the current region
+        std::size_t mFlushedCursor = 0; // staged bytes already uploaded
+
+        std::byte* mMapped = nullptr;   // persistent mapping of the whole buffer
+        std::vector<std::byte> mStaging;
+        std::vector<GLsync> mFences;
+
+        Stats mStats{};
+    };
+
+}
+
+#endif //LEARNOPENGL_STREAMBUFFER_H
@@ -0,0 +1,150 @@
+//
+// Created by niek on 11/21/2025.
+//
+
+#ifndef LEARNOPENGL_TEXTURE_H
+#define LEARNOPENGL_TEXTURE_H
+
+#include "glad/glad.h"
+
+#include <cstddef>
+#include <string>
+
+// EXT_texture_compression_s3tc / EXT_texture_sRGB (BC1-BC3) are extensions, so the core glad build lacks their enums
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+#ifndef GL_COMPRESSED_SRGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_SRGB_S3TC_DXT1_EXT 0x8C4C
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT 0x8C4F
+#endif
+
+namespace GLCore {
+
+    /**
+     * A 2D texture with a fixed size, format and mip count.
+     * - Uses immutable storage (glTexStorage2D) when available, DSA (glTexture*) when available; the fallback binds
+     *   GL_TEXTURE_2D on the active unit and unbinds afterwards.
+     * - SetSubImage() also accepts a byte offset as `pixels` while a GL_PIXEL_UNPACK_BUFFER is bound; so does
+     *   SetCompressedSubImage() for block-compressed formats (BC1/BC3/BC4/BC5/BC7, see BlockCompression.h).
+     * - RAII: texture deleted in destructor.
+     */
+    class Texture2D {
+    public:
+        Texture2D() = default;
+        // levels = 0 allocates the full mip chain
+        Texture2D(int width, int height, GLenum internalFormat, int levels = 0, const std::string& label = {});
+        ~Texture2D();
+
+        // Non-copyable (owning handle), movable
+        Texture2D(const Texture2D&) = delete;
+        Texture2D& operator=(const Texture2D&) = delete;
+        Texture2D(Texture2D&& other) noexcept;
+        Texture2D& operator=(Texture2D&& other) noexcept;
+
+        void SetSubImage(int level, int x, int y, int width, int height, GLenum format, GLenum type, const void* pixels) const;
+        // Whole 4x4 blocks in InternalFormat(); `bytes` is ImageBytes(InternalFormat(), width, height)
+        void SetCompressedSubImage(int level, int x, int y, int width, int height, std::size_t bytes, const void* data) const;
+        void GenerateMipmaps() const;
+
+        // Sampling state; the constructor sets trilinear (or linear for one level) filtering and GL_REPEAT
+        void SetFilter(GLenum minFilter, GLenum magFilter) const;
+        void SetWrap(GLenum wrapS, GLenum wrapT) const;
+        void SetAnisotropy(float anisotropy) const;   // clamped to Caps::maxAnisotropy; no-op without support
+        void SetSwizzle(GLenum r, GLenum g, GLenum b, GLenum a) const;
+        // Sampled levels (GL_TEXTURE_BASE_LEVEL / MAX_LEVEL); levels outside the range need not hold data yet
+        void SetLevelRange(int baseLevel, int maxLevel) const;
+        // Filter, wrap, anisotropy and swizzle of `source`
+        void CopySampling(const Texture2D& source) const;
+
+        void Bind(unsigned int unit) const;
+
+        // A smaller copy without the `count` largest levels (GPU copy, needs Caps::copyImage); sampling state and
+        // swizzle are carried over. Levels() must exceed count
+        Texture2D DropMips(int count, const std::string& label = {}) const;
+        // GPU copy of `count` levels of `source` (same format and level sizes) starting at `sourceLevel` into this
+        // texture from `level` on; needs Caps::copyImage
+        void CopyLevels(const Texture2D& source, int sourceLevel, int level, int count) const;
+
+        unsigned int ID() const { return mID; }
+        int Width() const { return mWidth; }
+        int Height() const { return mHeight; }
+        int Levels() const { return mLevels; }
+        GLenum InternalFormat() const { return mInternalFormat; }
+
+        // GPU memory of all levels, assuming 4 bytes per texel for 3-channel formats (drivers pad them)
+        std::size_t EstimatedBytes() const;
+
+        // floor(log2(max(width, height))) + 1
+        static int MipLevels(int width, int height);
+        static std::size_t BytesPerTexel(GLenum internalFormat);    // uncompressed formats
+        static bool IsCompressed(GLenum internalFormat);
+        // Bytes of one width x height image: whole 4x4 blocks for compressed formats, texels otherwise
+        static std::size_t ImageBytes(GLenum internalFormat, int width, int height);
+
+    private:
+        void SetParameter(GLenum name, GLint value) const;
+        GLint GetParameter(GLenum name) const;
+
+        unsigned int mID = 0;
+        int mWidth = 0, mHeight = 0;
+        int mLevels = 0;
+        GLenum mInternalFormat = GL_RGBA8;
+    };
+
+    /**
+     * A 2D texture array (GL_TEXTURE_2D_ARRAY): `layers` images of one size, format and mip count, as SpriteBatch
+     * samples them (texture, layer). Storage, DSA, fallback and RAII rules are those of Texture2D.
+     */
+    class Texture2DArray {
+    public:
+        Texture2DArray() = default;
+        // levels = 0 allocates the full mip chain
+        Texture2DArray(int width, int height, int layers, GLenum internalFormat, int levels = 0, const std::string& label = {});
+        ~Texture2DArray();
+
+        // Non-copyable (owning handle), movable
+        Texture2DArray(const Texture2DArray&) = delete;
+        Texture2DArray& operator=(const Texture2DArray&) = delete;
+        Texture2DArray(Texture2DArray&& other) noexcept;
+        Texture2DArray& operator=(Texture2DArray&& other) noexcept;
+
+        // `layerCount` consecutive layers from `layer` on; `pixels` may be a byte offset into a bound unpack buffer
+        void SetSubImage(int level, int x, int y, int layer, int width, int height, int layerCount, GLenum format,
+                         GLenum type, const void* pixels) const;
+        // Whole 4x4 blocks; `bytes` is Texture2D::ImageBytes(InternalFormat(), width, height) * layerCount
+        void SetCompressedSubImage(int level, int x, int y, int layer, int width, int height, int layerCount,
+                                   std::size_t bytes, const void* data) const;
+        void GenerateMipmaps() const;
+
+        // Sampling state; the constructor sets trilinear (or linear for one level) filtering and GL_CLAMP_TO_EDGE
+        void SetFilter(GLenum minFilter, GLenum magFilter) const;
+        void SetWrap(GLenum wrapS, GLenum wrapT) const;
+        void SetAnisotropy(float anisotropy) const;   // clamped to Caps::maxAnisotropy; no-op without support
+        void SetSwizzle(GLenum r, GLenum g, GLenum b, GLenum a) const;
+
+        void Bind(unsigned int unit) const;
+
+        unsigned int ID() const { return mID; }
+        int Width() const { return mWidth; }
+        int Height() const { return mHeight; }
+        int Layers() const { return mLayers; }
+        int Levels() const { return mLevels; }
+        GLenum InternalFormat() const { return mInternalFormat; }
+
+        // GPU memory of all levels of all layers (see Texture2D::EstimatedBytes)
+        std::size_t EstimatedBytes() const;
+
+    private:
+        void SetParameter(GLenum name, GLint value) const;
+
+        unsigned int mID = 0;
+        int mWidth = 0, mHeight = 0, mLayers = 0;
+        int mLevels = 0;
+        GLenum mInternalFormat = GL_RGBA8;
+    };
+
+}
+
+#endif //LEARNOPENGL_TEXTURE_H
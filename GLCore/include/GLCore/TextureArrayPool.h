@@ -0,0 +1,102 @@
+//
+// Created by niek on 11/27/2025.
+//
+
+#ifndef LEARNOPENGL_TEXTUREARRAYPOOL_H
+#define LEARNOPENGL_TEXTUREARRAYPOOL_H
+
+#include "GLCore/CookedTexture.h"
+#include "GLCore/Image.h"
+#include "GLCore/Texture.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace GLCore {
+
+    /** @brief A texture in a TextureArrayPool: which array and which layer of it. Materials store this pair. */
+    struct TextureSlot {
+        static constexpr std::uint16_t kInvalid = 0xFFFF;
+
+        std::uint16_t array = kInvalid;
+        std::uint16_t layer = 0;
+
+        bool Valid() const { return array != kInvalid; }
+    };
+
+    struct TextureArrayPoolSettings {
+        int layersPerArray = 64;        // clamped to Caps::maxArrayTextureLayers
+    };
+
+    /**
+     * Groups textures of matching size, format and mip count into GL_TEXTURE_2D_ARRAY layers, so objects with
+     * different textures share one bind and one draw; the layer travels as per-instance data (InstancedMesh layer
+     * stream, Sprite::layer).
+     * - Each array has layersPerArray layers and a free list; Allocate() takes a free layer of the first matching
+     *   array and creates a new array when all are full. Release() returns the layer; Trim() deletes arrays
+     *   without used layers. Array indices stay stable, so slots remain valid until released.
+     * - Add() allocates and uploads a mip chain (GenerateMips) or every level of a .gtex. Grey and grey + alpha
+     *   sources get their own arrays with .rrr1 / .rrrg swizzles.
+     * - Bind() skips the glBindTexture when the unit already holds the array (as far as the pool knows: BeginFrame()
+     *   and InvalidateBindings() forget). Stats count binds and skipped binds per frame.
+     * - Use it on the GL thread; throws std::runtime_error("ERROR::TEXTURE_ARRAY_POOL::...").
+     */
+    class TextureArrayPool {
+    public:
+        struct Stats {
+            std::uint32_t arrays = 0;
+            std::uint32_t layers = 0;           // over all arrays
+            std::uint32_t usedLayers = 0;
+            std::uint64_t bytes = 0;            // GPU memory of all arrays, free layers included
+            std::uint32_t binds = 0;            // glBindTexture calls since BeginFrame()
+            std::uint32_t skippedBinds = 0;     // Bind() calls that found the array already bound
+        };
+
+        explicit TextureArrayPool(const TextureArrayPoolSettings& settings = {});
+
+        // Non-copyable (owns textures)
+        TextureArrayPool(const TextureArrayPool&) = delete;
+        TextureArrayPool& operator=(const TextureArrayPool&) = delete;
+
+        // An empty layer; levels = 0 is the full mip chain. Upload with Get(slot).SetSubImage(..., slot.layer, ...)
+        TextureSlot Allocate(int width, int height, GLenum internalFormat, int levels = 0);
+        TextureSlot Add(std::span<const Image> levels, bool srgb = true);      // level 0 first; 1, 2 or 4 channels
+        TextureSlot Add(const CookedTexture& texture);
+        void Release(TextureSlot slot);
+        void Trim();
+
+        const Texture2DArray& Get(const TextureSlot slot) const { return mArrays[slot.array].texture; }
+        const Texture2DArray& GetArray(const std::uint16_t array) const { return mArrays[array].texture; }
+        std::size_t ArrayCount() const { return mArrays.size(); }     // including trimmed indices
+
+        // Resets the per-frame bind counts; call once per frame
+        void BeginFrame();
+        void Bind(std::uint16_t array, unsigned int unit);
+        void Bind(const TextureSlot slot, const unsigned int unit) { Bind(slot.array, unit); }
+        // Forget what is bound; call after binding textures behind the pool's back
+        void InvalidateBindings();
+
+        const Stats& GetStats() const { return mStats; }
+
+    private:
+        enum class Swizzle : std::uint8_t { None, Grey, GreyAlpha };
+
+        struct Array {
+            Texture2DArray texture;             // ID 0 once trimmed
+            Swizzle swizzle = Swizzle::None;
+            std::vector<std::uint16_t> freeLayers;
+        };
+
+        TextureSlot Allocate(int width, int height, GLenum internalFormat, int levels, Swizzle swizzle);
+
+        TextureArrayPoolSettings mSettings;
+        std::vector<Array> mArrays;
+        std::vector<unsigned int> mBound;       // array texture per unit, 0 = unknown
+        Stats mStats{};
+    };
+
+}
+
+#endif //LEARNOPENGL_TEXTUREARRAYPOOL_H
@@ -0,0 +1,130 @@
+//
+// Created by niek on 11/22/2025.
+//
+
+#ifndef LEARNOPENGL_TEXTURECACHE_H
+#define LEARNOPENGL_TEXTURECACHE_H
+
+#include "GLCore/TextureLoader.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace GLCore {
+
+    /** @brief Reference to a texture in a TextureCache; one Acquire() / AddRef() per Release(). */
+    struct TextureHandle {
+        std::uint32_t id = 0xFFFFFFFFu;
+
+        bool Valid() const { return id != 0xFFFFFFFFu; }
+    };
+
+    struct TextureCacheSettings {
+        std::size_t budgetBytes = 512u << 20;   // estimated GPU bytes of resident textures
+        bool dropMips = true;                   // shrink referenced textures once nothing unreferenced is left to evict
+        int minDropSize = 64;                   // never drop below this many texels on the smaller side
+    };
+
+    /**
+     * Content-addressed, reference-counted texture cache on top of TextureLoader.
+     * - Acquire() hashes the file (XXH64, seeded with the load options) and returns the existing entry when the same
+     *   content was requested before, under any path; only new content is decoded and uploaded.
+     * - Entries stay resident after their last Release() until the budget needs the memory. Update() evicts
+     *   unreferenced textures least-recently-used first; if still over budget it drops the largest mip of referenced
+     *   textures (LRU first, one level per texture per pass, needs Caps::copyImage). Dropped levels are not restored.
+     * - Get() marks a texture used this frame. Call Update() once per frame on the GL thread.
+     */
+    class TextureCache {
+    public:
+        struct Stats {
+            std::uint32_t textures = 0;          // resident
+            std::uint32_t pending = 0;           // decoding or uploading
+            std::uint32_t failed = 0;
+            std::uint64_t residentBytes = 0;
+            std::uint64_t peakResidentBytes = 0;
+            std::uint64_t budgetBytes = 0;
+            std::uint64_t lookups = 0;
+            std::uint64_t hits = 0;              // Acquire() that found the content already cached or in flight
+            std::uint64_t evictions = 0;
+            std::uint64_t evictedBytes = 0;
+            std::uint64_t mipDrops = 0;
+            std::uint64_t droppedBytes = 0;
+            std::uint64_t hashedBytes = 0;
+            double hashMs = 0.0;
+
+            double HitRate() const { return lookups ? static_cast<double>(hits) / static_cast<double>(lookups) : 0.0; }
+        };
+
+        explicit TextureCache(const TextureCacheSettings& settings = {}, ThreadPool& pool = ThreadPool::Shared(),
+                              const TextureLoaderSettings& loaderSettings = {});
+
+        // Non-copyable (owns textures)
+        TextureCache(const TextureCache&) = delete;
+        TextureCache& operator=(const TextureCache&) = delete;
+
+        // Unreadable files return a handle in the Failed state
+        TextureHandle Acquire(const std::string& path, const TextureLoadOptions& options = {});
+        void AddRef(TextureHandle handle);
+        void Release(TextureHandle handle);
+
+        // Upload, adopt finished textures and enforce the budget; call once per frame
+        void Update();
+        void WaitIdle();
+        bool Idle() const { return mPending.empty(); }
+
+        // nullptr until Ready; the pointer stays valid across Acquire() until the texture is evicted or freed
+        const Texture2D* Get(TextureHandle handle);
+        TextureState State(TextureHandle handle) const { return mSlots[handle.id].state; }
+        const std::string& Path(TextureHandle handle) const { return mSlots[handle.id].path; }
+        const std::string& Error(TextureHandle handle) const { return mSlots[handle.id].error; }
+        std::uint32_t RefCount(TextureHandle handle) const { return mSlots[handle.id].refs; }
+
+        void SetBudget(std::size_t bytes) { mSettings.budgetBytes = bytes; }
+        // Enforce the budget now instead of on the next Update()
+        void Trim();
+
+        TextureLoader& Loader() { return mLoader; }
+        const Stats& GetStats() const { return mStats; }
+
+        // XXH64 of `bytes`
+        static std::uint64_t Hash(std::span<const std::byte> bytes, std::uint64_t seed = 0);
+
+    private:
+        struct Slot {
+            std::uint64_t key = 0;
+            std::string path;
+            TextureId loaderId = 0;
+            TextureState state = TextureState::Decoding;
+            Texture2D texture;
+            std::string error;
+            std::uint32_t refs = 0;
+            std::uint64_t bytes = 0;
+            std::uint64_t lastUsedFrame = 0;
+            std::list<std::uint32_t>::iterator lru;    // valid while Ready
+        };
+
+        std::uint32_t AllocateSlot();
+        void Free(std::uint32_t id);
+        void Evict(std::uint32_t id);
+        void Touch(Slot& slot);
+
+        TextureCacheSettings mSettings;
+        TextureLoader mLoader;
+        std::deque<Slot> mSlots;                    // deque: Get() pointers stay valid across Acquire()
+        std::vector<std::uint32_t> mFreeSlots;
+        std::unordered_map<std::uint64_t, std::uint32_t> mByKey;
+        std::vector<std::uint32_t> mPending;
+        std::list<std::uint32_t> mLru;                  // resident slots, most recently used first
+        std::uint64_t mFrame = 0;
+        Stats mStats{};
+    };
+
+}
+
+#endif //LEARNOPENGL_TEXTURECACHE_H
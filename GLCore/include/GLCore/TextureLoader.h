@@ -0,0 +1,128 @@
+//
+// Created by niek on 11/21/2025.
+//
+
+#ifndef LEARNOPENGL_TEXTURELOADER_H
+#define LEARNOPENGL_TEXTURELOADER_H
+
+#include "GLCore/StreamBuffer.h"
+#include "GLCore/Texture.h"
+#include "GLCore/ThreadPool.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+
+namespace GLCore {
+
+    using TextureId = std::uint32_t;
+
+    enum class TextureState {
+        Decoding,     // queued or running on the pool
+        Uploading,    // decoded, waiting for (or in the middle of) its staged upload
+        Ready,
+        Failed,
+        Taken         // moved out with Take()
+    };
+
+    struct TextureLoadOptions {
+        bool srgb = true;               // RGB(A) images as GL_SRGB8_ALPHA8 (color data); off for normal / data maps
+        bool generateMipmaps = true;    // glGenerateMipmap once level 0 is complete
+        bool flipVertically = true;     // first row at the bottom, as GL samples it
+    };
+
+    struct TextureLoaderSettings {
+        std::size_t uploadBytesPerFrame = 8u << 20;
+        unsigned int framesInFlight = 3;    // StreamBuffer regions
+    };
+
+    /**
+     * Asynchronous image loading (PNG, JPEG, TGA, BMP, PSD, GIF, PNM via the vendored stb_image; QOI via DecodeQoi).
+     * - Load() returns immediately; the file is memory-mapped and decoded on `pool` (8-bit: grey -> R8, grey+alpha ->
+     *   RG8 with swizzles, everything else -> RGBA8 / SRGB8_ALPHA8).
+     * - Update(), once per frame on the GL thread, uploads decoded images in row slices of at most
+     *   uploadBytesPerFrame through a StreamBuffer bound as GL_PIXEL_UNPACK_BUFFER, so one large texture never stalls a
+     *   frame. Mipmaps are generated on the GPU after the last slice.
+     * - .gtex files (CookTexture / the TextureCooker tool) skip decoding and upload their cooked levels instead, in the
+     *   file's format; generateMipmaps = false uploads level 0 only, and flipVertically does not apply (cooked flipped).
+     *   Block-compressed levels go up in whole block rows; a BC format the driver lacks fails the texture.
+     * - Get() returns nullptr until the texture is Ready; decode failures are reported by State() / Error().
+     * - Create and use it on the GL thread (it owns a StreamBuffer); only decoding runs on the pool.
+     */
+    class TextureLoader {
+    public:
+        struct Stats {
+            std::uint32_t requested = 0;
+            std::uint32_t ready = 0;
+            std::uint32_t failed = 0;
+            std::uint32_t decoding = 0;          // in flight on the pool
+            std::uint32_t uploading = 0;         // decoded, not yet fully uploaded
+            std::uint64_t sourceBytes = 0;       // encoded file bytes decoded so far
+            std::uint64_t decodedBytes = 0;      // pixel bytes produced
+            double decodeMs = 0.0;               // summed over workers
+            std::uint64_t uploadedBytes = 0;
+            std::uint64_t uploadedBytesThisFrame = 0;
+            double updateMs = 0.0;               // CPU time of the last Update()
+
+            // Per-thread decode throughput in decoded MB per second of decode time
+            double DecodeMegabytesPerSecond() const {
+                return decodeMs > 0.0 ? static_cast<double>(decodedBytes) / (1024.0 * 1024.0) / (decodeMs / 1000.0) : 0.0;
+            }
+        };
+
+        explicit TextureLoader(ThreadPool& pool = ThreadPool::Shared(), const TextureLoaderSettings& settings = {});
+        ~TextureLoader();
+
+        // Non-copyable (owns textures and the staging buffer)
+        TextureLoader(const TextureLoader&) = delete;
+        TextureLoader& operator=(const TextureLoader&) = delete;
+
+        TextureId Load(const std::string& path, const TextureLoadOptions& options = {});
+
+        // Collect finished decodes and upload up to the frame budget; call once per frame
+        void Update();
+
+        // Blocks (calling Update) until every requested texture is Ready or Failed
+        void WaitIdle();
+        bool Idle() const { return mStats.decoding == 0 && mStats.uploading == 0; }
+
+        TextureState State(TextureId id) const { return mEntries[id].state; }
+        const Texture2D* Get(TextureId id) const;
+        const std::string& Path(TextureId id) const { return mEntries[id].path; }
+        const std::string& Error(TextureId id) const { return mEntries[id].error; }
+
+        // Move a Ready texture out; the id then reports Taken
+        Texture2D Take(TextureId id);
+
+        const Stats& GetStats() const { return mStats; }
+
+    private:
+        struct Decoded;
+        struct Inbox;
+
+        struct Entry {
+            std::string path;
+            TextureLoadOptions options;
+            TextureState state = TextureState::Decoding;
+            Texture2D texture;
+            std::string error;
+        };
+
+        void Collect();
+
+        ThreadPool& mPool;
+        TextureLoaderSettings mSettings;
+        StreamBuffer mStaging;
+        std::shared_ptr<Inbox> mInbox;               // shared with the decode tasks, which may outlive a frame
+        std::deque<Entry> mEntries;                  // deque: Get() pointers stay valid across Load()
+        std::deque<std::unique_ptr<Decoded>> mUploads;
+        int mUploadedLevel = 0;                      // of mUploads.front()
+        int mUploadedRows = 0;                       // of mUploadedLevel
+        Stats mStats{};
+    };
+
+}
+
+#endif //LEARNOPENGL_TEXTURELOADER_H
@@ -0,0 +1,132 @@
+//
+// Created by niek on 11/25/2025.
+//
+
+#ifndef LEARNOPENGL_TEXTURESTREAMER_H
+#define LEARNOPENGL_TEXTURESTREAMER_H
+
+#include "GLCore/CookedTexture.h"
+#include "GLCore/MeshData.h"
+#include "GLCore/StreamBuffer.h"
+#include "GLCore/Texture.h"
+#include "GLCore/ThreadPool.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <string>
+
+namespace GLCore {
+
+    using StreamedTextureId = std::uint32_t;
+
+    struct TextureStreamerSettings {
+        std::size_t budgetBytes = 256u << 20;       // GPU bytes of the streamed (non-tail) levels
+        std::size_t uploadBytesPerFrame = 8u << 20;
+        unsigned int framesInFlight = 3;            // StreamBuffer regions
+        int tailSize = 64;                          // levels no larger than this are uploaded by Add() and never evicted
+        std::uint32_t keepFrames = 120;             // frames without a Request() before a texture falls back to its tail
+        float lodBias = 0.0f;                       // added to every requested level (positive: blurrier, cheaper)
+    };
+
+    /**
+     * Mip-level streaming of cooked (.gtex) textures, driven by how large they appear on screen.
+     * - Add() maps the file and uploads only the mip tail; Get() is usable right away and sharpens as levels arrive.
+     * - Request() (every frame, per visible object) turns distance, UV density and object scale into the finest level
+     *   worth sampling. Update() fits the requests into budgetBytes (coarsening the largest top levels first), evicts
+     *   surplus levels when over budget and streams missing ones, coarsest first, at most uploadBytesPerFrame through
+     *   a StreamBuffer bound as GL_PIXEL_UNPACK_BUFFER. The pages of a level are faulted in on the pool beforehand.
+     * - GL storage only covers the allocated levels: growing or shrinking reallocates the texture (resident levels
+     *   are copied on the GPU with Caps::copyImage, re-uploaded from the mapping otherwise), so the texture behind
+     *   Get() can change its ID in Update(). GL_TEXTURE_BASE_LEVEL / MAX_LEVEL clamp sampling to the complete levels.
+     * - Create and use it on the GL thread; throws std::runtime_error("ERROR::TEXTURE_STREAMER::...") on bad files.
+     */
+    class TextureStreamer {
+    public:
+        struct Stats {
+            std::uint32_t textures = 0;
+            std::uint32_t streaming = 0;            // textures with levels on their way in
+            std::uint64_t residentBytes = 0;        // complete, sampleable levels (tails included)
+            std::uint64_t allocatedBytes = 0;       // GPU storage, including levels still being uploaded
+            std::uint64_t pendingBytes = 0;         // within budget, not resident yet
+            std::uint64_t requestedBytes = 0;       // what the requests alone would keep resident
+            std::uint64_t fullBytes = 0;            // every level of every texture
+            std::uint64_t budgetBytes = 0;
+            std::uint64_t evictedBytes = 0;
+            std::uint32_t evictedLevels = 0;
+            std::uint64_t streamedBytes = 0;
+            std::uint32_t streamedLevels = 0;
+            std::uint64_t uploadedBytesThisFrame = 0;
+            std::uint32_t reallocations = 0;
+            double updateMs = 0.0;                  // CPU time of the last Update()
+        };
+
+        explicit TextureStreamer(ThreadPool& pool = ThreadPool::Shared(), const TextureStreamerSettings& settings = {});
+        ~TextureStreamer();
+
+        // Non-copyable (owns textures and the staging buffer)
+        TextureStreamer(const TextureStreamer&) = delete;
+        TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+        StreamedTextureId Add(const std::string& path);
+
+        // Vertical field of view in radians and viewport height in pixels; needed by Request()
+        void SetProjection(float fovY, float viewportHeight);
+
+        // `distance` to the camera, `uvDensity` UV units per mesh unit (see UvDensity), `scale` world units per mesh unit
+        void Request(StreamedTextureId id, float distance, float uvDensity, float scale = 1.0f);
+        void RequestLevel(StreamedTextureId id, int level);
+
+        // Budget, evict and stream; call once per frame
+        void Update();
+
+        const Texture2D& Get(StreamedTextureId id) const { return mEntries[id].texture; }
+        const std::string& Path(StreamedTextureId id) const { return mEntries[id].path; }
+        int Levels(StreamedTextureId id) const { return mEntries[id].file->Levels(); }
+        int ResidentLevel(StreamedTextureId id) const { return mEntries[id].resident; }   // finest complete level
+        int TargetLevel(StreamedTextureId id) const { return mEntries[id].target; }       // after the budget
+
+        void SetBudget(std::size_t bytes) { mSettings.budgetBytes = bytes; }
+        const Stats& GetStats() const { return mStats; }
+
+        // Average UV units per mesh unit: sqrt(UV area / surface area) over all triangles
+        static float UvDensity(const MeshData& mesh);
+
+    private:
+        struct Entry {
+            std::string path;
+            std::unique_ptr<CookedTexture> file;
+            Texture2D texture;                  // file levels [allocated, levels)
+            int tail = 0;                       // first level of the always-resident tail
+            int allocated = 0;
+            int resident = 0;
+            int requested = 0;                  // finest level asked for by the latest requests
+            int target = 0;
+            int frameRequest = 0;               // finest level asked for this frame
+            std::uint64_t requestFrame = 0;
+            int uploadedRows = 0;               // rows (block rows) of level resident - 1 uploaded so far
+            int prefetched = -1;                // level whose pages are faulted in (or being faulted by `prefetch`)
+            std::future<void> prefetch;
+        };
+
+        std::uint64_t LevelBytes(const Entry& entry, int level) const;
+        std::uint64_t RangeBytes(const Entry& entry, int first) const;    // levels [first, levels)
+        void Reallocate(Entry& entry, int allocated);
+        void UploadDirect(const Entry& entry, int level) const;
+        void Prefetch(Entry& entry, int level);
+        void Evict(Entry& entry, int level);
+
+        ThreadPool& mPool;
+        TextureStreamerSettings mSettings;
+        StreamBuffer mStaging;
+        std::deque<Entry> mEntries;             // deque: Get() references stay valid across Add()
+        float mPixelsPerUnit = 1.0f;            // pixels covered by one world unit at distance 1
+        std::uint64_t mFrame = 0;
+        Stats mStats{};
+    };
+
+}
+
+#endif //LEARNOPENGL_TEXTURESTREAMER_H
@@ -0,0 +1,66 @@
+//
+// Created by niek on 11/18/2025.
+//
+
+#ifndef LEARNOPENGL_THREADPOOL_H
+#define LEARNOPENGL_THREADPOOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace GLCore {
+
+    /**
+     * Fixed set of worker threads for CPU-side asset work (decoding, parsing, mip generation). Never touches GL.
+     * - Submit() queues one task and returns its future.
+     * - ParallelFor() spreads an index range over the workers and the calling thread and blocks until it is done;
+     *   it is safe to call from inside a task, because the caller keeps taking indices itself.
+     */
+    class ThreadPool {
+    public:
+        // 0 = one worker per hardware thread minus the caller (at least one)
+        explicit ThreadPool(unsigned int threadCount = 0);
+        ~ThreadPool();
+
+        // Non-copyable (owns threads)
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        template<class F>
+        std::future<std::invoke_result_t<F>> Submit(F&& task) {
+            auto packaged = std::make_shared<std::packaged_task<std::invoke_result_t<F>()>>(std::forward<F>(task));
+            std::future<std::invoke_result_t<F>> result = packaged->get_future();
+            Enqueue([packaged] { (*packaged)(); });
+            return result;
+        }
+
+        // Calls body(i) for every i in [0, count); rethrows the first exception once all started indices finished
+        void ParallelFor(std::size_t count, const std::function<void(std::size_t)>& body);
+
+        unsigned int ThreadCount() const { return static_cast<unsigned int>(mWorkers.size()); }
+
+        // Process-wide pool, created on first use
+        static ThreadPool& Shared();
+
+    private:
+        void Enqueue(std::function<void()> task);
+        void WorkerLoop();
+
+        std::vector<std::thread> mWorkers;
+        std::deque<std::function<void()>> mQueue;
+        std::mutex mMutex;
+        std::condition_variable mWake;
+        bool mStopping = false;
+    };
+
+}
+
+#endif //LEARNOPENGL_THREADPOOL_H
@@ -0,0 +1,78 @@
+//
+// Created by niek on 11/10/2025.
+//
+
+#ifndef LEARNOPENGL_VERTEXARRAY_H
+#define LEARNOPENGL_VERTEXARRAY_H
+
+#include "GLCore/Buffer.h"
+
+#include <string>
+#include <vector>
+
+namespace GLCore {
+
+    /**
+     * A vertex array object built from VertexFormat descriptions.
+     * - One binding per vertex stream: interleaved data uses a single binding, split streams use several.
+     * - Uses DSA (glVertexArray*) when available, classic glVertexAttribPointer otherwise.
+     * - RAII: VAO deleted in destructor. Buffers are not owned.
+     */
+    class VertexArray {
+    public:
+        explicit VertexArray(const std::string& label = {});
+        ~VertexArray();
+
+        // Non-copyable (owning handle), movable
+        VertexArray(const VertexArray&) = delete;
+        VertexArray& operator=(const VertexArray&) = delete;
+        VertexArray(VertexArray&& other) noexcept;
+        VertexArray& operator=(VertexArray&& other) noexcept;
+
+        /**
+         * @brief Describe a vertex stream and attach a buffer to it.
+         * Attribute i of the format gets location firstLocation + i.
+         * A divisor of 1 makes the stream advance per instance instead of per vertex.
+         */
+        void SetVertexBuffer(unsigned int binding, const Buffer& buffer, const VertexFormat& format,
+                             unsigned int firstLocation = 0, std::size_t offset = 0, unsigned int divisor = 0);
+        void SetVertexBuffer(unsigned int binding, const VertexBuffer& buffer,
+                             unsigned int firstLocation = 0, unsigned int divisor = 0);
+
+        /** @brief Describe a vertex stream without attaching storage yet; attach it with RebindVertexBuffer(). */
+        void SetVertexFormat(unsigned int binding, const VertexFormat& format,
+                             unsigned int firstLocation = 0, unsigned int divisor = 0);
+
+        /** @brief Point an already described stream at another buffer or offset (e.g. a streaming region). */
+        void RebindVertexBuffer(unsigned int binding, unsigned int bufferID, std::size_t offset);
+
+        void SetIndexBuffer(const IndexBuffer& buffer);
+        void SetIndexBuffer(const Buffer& buffer, GLenum indexType);
+
+        // Binding
+        void Bind() const;
+        static void Unbind();
+
+        unsigned int ID() const { return mID; }
+        GLenum IndexType() const { return mIndexType; }
+
+    private:
+        struct Stream {
+            unsigned int binding = 0;
+            VertexFormat format{};
+            unsigned int firstLocation = 0;
+            unsigned int divisor = 0;
+        };
+
+        // Classic path: (re)issue glVertexAttribPointer for a stream with the VAO and buffer bound
+        void SpecifyAttributes(const Stream& stream, unsigned int bufferID, std::size_t offset) const;
+        Stream* FindStream(unsigned int binding);
+
+        unsigned int mID = 0;
+        GLenum mIndexType = GL_UNSIGNED_INT;
+        std::vector<Stream> mStreams;
+    };
+
+}
+
+#endif //LEARNOPENGL_VERTEXARRAY_H
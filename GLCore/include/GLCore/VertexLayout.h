@@ -0,0 +1,154 @@
+//
+// Created by niek on 11/10/2025.
+//
+
+#ifndef LEARNOPENGL_VERTEXLAYOUT_H
+#define LEARNOPENGL_VERTEXLAYOUT_H
+
+#include "glad/glad.h"
+#include <glm.hpp>
+#include <gtc/type_precision.hpp>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace GLCore {
+
+    // Attribute storage types without a GLM equivalent
+    struct Half2 { std::uint16_t x, y; };                  // GL_HALF_FLOAT x2
+    struct Half4 { std::uint16_t x, y, z, w; };            // GL_HALF_FLOAT x4
+    struct PackedSnorm1010102 { std::uint32_t bits; };     // GL_INT_2_10_10_10_REV
+    struct PackedUnorm1010102 { std::uint32_t bits; };     // GL_UNSIGNED_INT_2_10_10_10_REV
+
+    /** @brief How the shader sees an attribute: converted float, normalized [0,1]/[-1,1], or integer. */
+    enum class AttribMode {
+        Float,
+        Normalized,
+        Integer
+    };
+
+    /** @brief Runtime description of a single attribute within a vertex stream. */
+    struct VertexAttribute {
+        unsigned int location;
+        int components;
+        GLenum type;
+        AttribMode mode;
+        unsigned int offset;
+    };
+
+    /** @brief Runtime view of a vertex layout: attributes + stride. */
+    struct VertexFormat {
+        std::span<const VertexAttribute> attributes;
+        unsigned int stride = 0;
+
+        template<class V>
+        static constexpr VertexFormat Of() { return {V::Layout::Attributes, V::Layout::Stride}; }
+    };
+
+    // Maps a C++ attribute type to its GL component count/type and default shader-side interpretation
+    template<class T> struct AttribTraits;
+
+    template<int N, GLenum GLType, AttribMode Mode>
+    struct AttribTraitsBase {
+        static constexpr int Components = N;
+        static constexpr GLenum Type = GLType;
+        static constexpr AttribMode DefaultMode = Mode;
+    };
+
+    template<> struct AttribTraits<float> : AttribTraitsBase<1, GL_FLOAT, AttribMode::Float> {};
+    template<> struct AttribTraits<glm::vec2> : AttribTraitsBase<2, GL_FLOAT, AttribMode::Float> {};
+    template<> struct AttribTraits<glm::vec3> : AttribTraitsBase<3, GL_FLOAT, AttribMode::Float> {};
+    template<> struct AttribTraits<glm::vec4> : AttribTraitsBase<4, GL_FLOAT, AttribMode::Float> {};
+    template<> struct AttribTraits<std::int32_t> : AttribTraitsBase<1, GL_INT, AttribMode::Integer> {};
+    template<> struct AttribTraits<glm::ivec2> : AttribTraitsBase<2, GL_INT, AttribMode::Integer> {};
+    template<> struct AttribTraits<glm::ivec3> : AttribTraitsBase<3, GL_INT, AttribMode::Integer> {};
+    template<> struct AttribTraits<glm::ivec4> : AttribTraitsBase<4, GL_INT, AttribMode::Integer> {};
+    template<> struct AttribTraits<std::uint32_t> : AttribTraitsBase<1, GL_UNSIGNED_INT, AttribMode::Integer> {};
+    template<> struct AttribTraits<glm::uvec2> : AttribTraitsBase<2, GL_UNSIGNED_INT, AttribMode::Integer> {};
+    template<> struct AttribTraits<glm::uvec3> : AttribTraitsBase<3, GL_UNSIGNED_INT, AttribMode::Integer> {};
+    template<> struct AttribTraits<glm::uvec4> : AttribTraitsBase<4, GL_UNSIGNED_INT, AttribMode::Integer> {};
+    template<> struct AttribTraits<glm::u8vec2> : AttribTraitsBase<2, GL_UNSIGNED_BYTE, AttribMode::Normalized> {};
+    template<> struct AttribTraits<glm::u8vec4> : AttribTraitsBase<4, GL_UNSIGNED_BYTE, AttribMode::Normalized> {};
+    template<> struct AttribTraits<glm::i8vec4> : AttribTraitsBase<4, GL_BYTE, AttribMode::Normalized> {};
+    template<> struct AttribTraits<glm::u16vec2> : AttribTraitsBase<2, GL_UNSIGNED_SHORT, AttribMode::Normalized> {};
+    template<> struct AttribTraits<glm::u16vec4> : AttribTraitsBase<4, GL_UNSIGNED_SHORT, AttribMode::Normalized> {};
+    template<> struct AttribTraits<glm::i16vec2> : AttribTraitsBase<2, GL_SHORT, AttribMode::Normalized> {};
+    template<> struct AttribTraits<glm::i16vec4> : AttribTraitsBase<4, GL_SHORT, AttribMode::Normalized> {};
+    template<> struct AttribTraits<Half2> : AttribTraitsBase<2, GL_HALF_FLOAT, AttribMode::Float> {};
+    template<> struct AttribTraits<Half4> : AttribTraitsBase<4, GL_HALF_FLOAT, AttribMode::Float> {};
+    template<> struct AttribTraits<PackedSnorm1010102> : AttribTraitsBase<4, GL_INT_2_10_10_10_REV, AttribMode::Normalized> {};
+    template<> struct AttribTraits<PackedUnorm1010102> : AttribTraitsBase<4, GL_UNSIGNED_INT_2_10_10_10_REV, AttribMode::Normalized> {};
+
+    /** @brief One attribute of a vertex layout, in member declaration order. */
+    template<class T, AttribMode Mode = AttribTraits<T>::DefaultMode>
+    struct Attrib {
+        using Type = T;
+        static constexpr AttribMode Mode_ = Mode;
+
+        static_assert(Mode != AttribMode::Integer || AttribTraits<T>::DefaultMode == AttribMode::Integer,
+                      "Integer attributes need an integer storage type");
+    };
+
+    /**
+     * Compile-time vertex layout. List the attributes in the order the vertex struct declares its members;
+     * offsets follow C++ alignment rules and locations are assigned 0..N-1.
+     *
+     *   struct ColoredVertex {
+     *       glm::vec3 position;
+     *       glm::u8vec4 color;
+     *       using Layout = GLCore::VertexLayout<GLCore::Attrib<glm::vec3>, GLCore::Attrib<glm::u8vec4>>;
+     *   };
+     */
+    template<class... Attribs>
+    struct VertexLayout {
+    private:
+        static constexpr unsigned int AlignUp(const unsigned int value, const unsigned int alignment) {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        struct Computed {
+            std::array<VertexAttribute, sizeof...(Attribs)> attributes{};
+            unsigned int stride = 0;
+        };
+
+        static constexpr Computed Compute() {
+            Computed result{};
+            unsigned int offset = 0;
+            unsigned int maxAlign = 1;
+            unsigned int index = 0;
+            ((offset = AlignUp(offset, alignof(typename Attribs::Type)),
+              result.attributes[index] = VertexAttribute{
+                  index,
+                  AttribTraits<typename Attribs::Type>::Components,
+                  AttribTraits<typename Attribs::Type>::Type,
+                  Attribs::Mode_,
+                  offset},
+              offset += sizeof(typename Attribs::Type),
+              maxAlign = std::max<unsigned int>(maxAlign, alignof(typename Attribs::Type)),
+              ++index), ...);
+            result.stride = AlignUp(offset, maxAlign);
+            return result;
+        }
+
+        static constexpr Computed kComputed = Compute();
+
+    public:
+        static constexpr std::size_t Count = sizeof...(Attribs);
+        static constexpr std::array<VertexAttribute, sizeof...(Attribs)> Attributes = kComputed.attributes;
+        static constexpr unsigned int Stride = kComputed.stride;
+    };
+
+    /** @brief A vertex struct with a Layout whose stride matches the struct size. */
+    template<class V>
+    concept VertexType = requires {
+        typename V::Layout;
+        { V::Layout::Stride } -> std::convertible_to<unsigned int>;
+    } && sizeof(V) == V::Layout::Stride;
+
+}
+
+#endif //LEARNOPENGL_VERTEXLAYOUT_H
@@ -0,0 +1,78 @@
+//
+// Created by niek on 11/15/2025.
+//
+
+#ifndef LEARNOPENGL_VERTEXPACKING_H
+#define LEARNOPENGL_VERTEXPACKING_H
+
+#include "GLCore/MeshData.h"
+#include "GLCore/VertexLayout.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GLCore {
+
+    /** @brief Per-mesh dequantization: decoded = quantized * scale + offset. */
+    struct PositionQuantization {
+        glm::vec3 offset{0.0f};
+        glm::vec3 scale{1.0f};
+    };
+
+    struct UVQuantization {
+        glm::vec2 offset{0.0f};
+        glm::vec2 scale{1.0f};
+    };
+
+    /**
+     * 16-byte vertex (MeshVertex is 32):
+     * - position: half floats in [-1, 1] of the mesh bounds (w = 1), see PositionQuantization
+     * - normal: octahedral xy in GL_INT_2_10_10_10_REV (z and w unused)
+     * - uv: unorm16 in the mesh UV bounds, see UVQuantization
+     */
+    struct PackedMeshVertex {
+        Half4 position;
+        PackedSnorm1010102 normal;
+        glm::u16vec2 uv;
+
+        using Layout = VertexLayout<Attrib<Half4>, Attrib<PackedSnorm1010102>, Attrib<glm::u16vec2>>;
+    };
+
+    struct PackedMesh {
+        std::vector<PackedMeshVertex> vertices;
+        std::vector<std::uint32_t> indices;
+        PositionQuantization position;
+        UVQuantization uv;
+    };
+
+}
+
+namespace GLCore::VertexPacking {
+
+    /**
+     * Batch quantizers over strided input and output, so they can read from and write into interleaved vertices.
+     * - SSE2 handles four vertices per step where available; the scalar path produces identical bits.
+     * - Inputs: positions/normals vec3, tangents vec4 (w = +-1 handedness), uvs vec2, colors vec4 in [0, 1].
+     */
+    PositionQuantization FitPositions(const void* src, std::size_t srcStride, std::uint32_t count);
+    UVQuantization FitUVs(const void* src, std::size_t srcStride, std::uint32_t count);
+
+    void QuantizePositions(const void* src, std::size_t srcStride, void* dst, std::size_t dstStride, std::uint32_t count,
+                           const PositionQuantization& quantization);   // -> Half4
+    void QuantizeNormals(const void* src, std::size_t srcStride, void* dst, std::size_t dstStride, std::uint32_t count);   // -> PackedSnorm1010102
+    void QuantizeTangents(const void* src, std::size_t srcStride, void* dst, std::size_t dstStride, std::uint32_t count);  // -> PackedSnorm1010102, w = sign
+    void QuantizeUVs(const void* src, std::size_t srcStride, void* dst, std::size_t dstStride, std::uint32_t count,
+                     const UVQuantization& quantization);               // -> u16vec2
+    void QuantizeColors(const void* src, std::size_t srcStride, void* dst, std::size_t dstStride, std::uint32_t count);   // -> u8vec4
+
+    // MeshData -> PackedMesh with fitted bounds
+    PackedMesh PackMesh(const MeshData& mesh);
+
+    // Scalar decoders, matching what the shaders do (for tools and error reports)
+    float HalfToFloat(std::uint16_t half);
+    glm::vec3 DecodeOctahedral(PackedSnorm1010102 packed);
+
+}
+
+#endif //LEARNOPENGL_VERTEXPACKING_H
@@ -9,10 +9,29 @@
 
 namespace GLCore {
 
+    /** @brief Swap interval policy. Adaptive tears late frames instead of waiting a full refresh (interval -1). */
+    enum class VSyncMode {
+        Off,
+        On,
+        Adaptive
+    };
+
     struct WindowProperties {
         const char* title;
         int width;
         int height;
+        VSyncMode vsync = VSyncMode::On;
+        double maxFrameRate = 0.0; // frame limiter for VSyncMode::Off, 0 = uncapped
+        bool debugContext = false; // request a debug context and install the GLCore::Debug sink
+    };
+
+    /** @brief Measured interval between consecutive buffer swaps over the recent history. */
+    struct FrameTiming {
+        double averageMs = 0.0;
+        double jitterMs = 0.0; // standard deviation of the interval
+        double minMs = 0.0;
+        double maxMs = 0.0;
+        int sampleCount = 0;
     };
 
     class Window {
@@ -29,9 +48,22 @@ namespace GLCore {
 
         // Basic operations
         bool ShouldClose() const;
+        void RequestClose() const;
         void SwapBuffers() const;
         static void PollEvents();
 
+        /**
+         * @brief Takes the framebuffer size accumulated by resize events since the last call.
+         * Returns false when no resize happened. Sizes of 0 (minimized) are never reported.
+         */
+        bool ConsumePendingResize(int& width, int& height);
+
+        // Presentation
+        void SetVSync(VSyncMode mode);
+        VSyncMode GetVSync() const;
+        void SetFrameRateLimit(double framesPerSecond);
+        FrameTiming GetFrameTiming() const;
+
         // Introspection
         int Width() const;
         int Height() const;
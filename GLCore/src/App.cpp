@@ -14,12 +14,22 @@ namespace GLCore {
         Window window;
 
         explicit Impl(const AppProperties& p)
-            : props(p), window(WindowProperties{p.title, p.width, p.height}) {}
+            : props(p), window(WindowProperties{p.title, p.width, p.height, p.vsync, p.maxFrameRate, p.debugContext}) {}
 
         static void ProcessInput(GLFWwindow* win) {
             if (glfwGetKey(win, GLFW_KEY_ESCAPE) == GLFW_PRESS)
                 glfwSetWindowShouldClose(win, GLFW_TRUE);
         }
+
+        // Applies the resize events gathered during the last PollEvents as a single change
+        bool ApplyPendingResize() {
+            int width = 0, height = 0;
+            if (!window.ConsumePendingResize(width, height)) return false;
+            glViewport(0, 0, width, height);
+            props.width = width;
+            props.height = height;
+            return true;
+        }
     };
 
     App::App() = default;
@@ -39,6 +49,8 @@ namespace GLCore {
         OnInit();
         while (!mImpl->window.ShouldClose()) {
             Impl::ProcessInput(native);
+            if (mImpl->ApplyPendingResize())
+                OnResize(mImpl->props.width, mImpl->props.height);
             OnUpdate();
 
             // Rendering events
@@ -51,6 +63,9 @@ namespace GLCore {
         OnShutdown();
     }
 
+    Window& App::GetWindow() { return mImpl->window; }
+    const Window& App::GetWindow() const { return mImpl->window; }
+
     const char* App::GetAppName() const { return mImpl ? mImpl->props.title : ""; }
     int App::GetAppWidth() const { return mImpl ? mImpl->props.width : 0; }
     int App::GetAppHeight() const { return mImpl ? mImpl->props.height : 0; }
@@ -0,0 +1,195 @@
+//
+// Created by niek on 11/26/2025.
+//
+
+#include "GLCore/Atlas.h"
+
+#include "GLCore/MipGenerator.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+
+namespace GLCore {
+
+    namespace {
+        std::size_t AlignUp(const std::size_t value) {
+            return (value + AtlasHeader::kAlignment - 1) & ~(AtlasHeader::kAlignment - 1);
+        }
+
+        std::uint64_t LevelBytes(const AtlasHeader& header, const int level) {
+            const std::uint64_t w = std::max(1u, header.width >> level), h = std::max(1u, header.height >> level);
+            return w * h * header.pages * 4;
+        }
+
+        // Fills the whole cell around `rect` with `image`, clamping to its edges outside the rectangle
+        void Blit(Image& page, const Image& image, const AtlasRect& rect, const int cellWidth, const int cellHeight, const int gutter) {
+            const int x0 = rect.x - gutter, y0 = rect.y - gutter;
+            for (int y = y0; y < y0 + cellHeight; ++y) {
+                const int sy = std::clamp(y - rect.y, 0, image.height - 1);
+                const std::uint8_t* row = image.pixels.data() + static_cast<std::size_t>(sy) * image.width * image.channels;
+                std::uint8_t* out = page.pixels.data() + (static_cast<std::size_t>(y) * page.width + x0) * 4;
+                for (int x = 0; x < cellWidth; ++x, out += 4) {
+                    const std::uint8_t* in = row + static_cast<std::size_t>(std::clamp(x0 + x - rect.x, 0, image.width - 1)) * image.channels;
+                    switch (image.channels) {
+                        case 1: out[0] = out[1] = out[2] = in[0]; out[3] = 255; break;
+                        case 2: out[0] = out[1] = out[2] = in[0]; out[3] = in[1]; break;
+                        case 3: std::memcpy(out, in, 3); out[3] = 255; break;
+                        default: std::memcpy(out, in, 4); break;
+                    }
+                }
+            }
+        }
+    }
+
+    AtlasLayout CookAtlas(const std::span<const std::string> names, const std::span<const Image> images, const std::string& path,
+                          const AtlasSettings& settings, std::vector<std::uint32_t>* ids, ThreadPool& pool) {
+        const auto fail = [&path](const std::string& what) { return std::runtime_error("ERROR::ATLAS::" + what + ": " + path); };
+        if (names.size() != images.size() || images.empty()) throw fail("INVALID_INPUT");
+        for (const Image& image : images) {
+            if (image.width <= 0 || image.height <= 0 || image.channels < 1 || image.channels > 4
+                || image.pixels.size() != static_cast<std::size_t>(image.width) * image.height * image.channels)
+                throw fail("INVALID_IMAGE");
+        }
+
+        // Sprite IDs: table order is hash order
+        std::vector<std::uint32_t> order(images.size());
+        std::iota(order.begin(), order.end(), 0u);
+        std::vector<std::uint32_t> hashes(images.size());
+        for (std::size_t i = 0; i < names.size(); ++i) hashes[i] = Atlas::Hash(names[i]);
+        std::sort(order.begin(), order.end(), [&hashes](const std::uint32_t a, const std::uint32_t b) { return hashes[a] < hashes[b]; });
+        for (std::size_t i = 1; i < order.size(); ++i) {
+            if (hashes[order[i]] == hashes[order[i - 1]]) throw fail("NAME_COLLISION: " + names[order[i - 1]] + ", " + names[order[i]]);
+        }
+
+        std::vector<glm::ivec2> sizes(images.size());
+        for (std::size_t i = 0; i < images.size(); ++i) sizes[i] = {images[i].width, images[i].height};
+        const AtlasLayout layout = PackAtlas(sizes, settings);
+        if (layout.pages > 0xFFFF || layout.width > 0xFFFF || layout.height > 0xFFFF) throw fail("ATLAS_TOO_LARGE");
+
+        // Pages, every cell filled edge to edge
+        const int align = 1 << (settings.mipLevels - 1);
+        std::vector<Image> pages(static_cast<std::size_t>(layout.pages));
+        for (Image& page : pages) {
+            page.width = layout.width;
+            page.height = layout.height;
+            page.channels = 4;
+            page.pixels.assign(static_cast<std::size_t>(layout.width) * layout.height * 4, 0);
+        }
+        for (std::size_t i = 0; i < images.size(); ++i) {
+            const AtlasRect& rect = layout.rects[i];
+            const int cellWidth = (rect.width + 2 * settings.gutter + align - 1) / align * align;
+            const int cellHeight = (rect.height + 2 * settings.gutter + align - 1) / align * align;
+            Blit(pages[static_cast<std::size_t>(rect.page)], images[i], rect, cellWidth, cellHeight, settings.gutter);
+        }
+
+        MipSettings mips;
+        mips.filter = MipFilter::Box;
+        mips.srgb = settings.srgb;
+        mips.maxLevels = std::min({settings.mipLevels, static_cast<int>(AtlasHeader::kMaxLevels),
+                                   static_cast<int>(std::bit_width(static_cast<unsigned>(std::max(layout.width, layout.height))))});
+        const std::vector<std::vector<Image>> chains = GenerateMips(pages, mips, pool);
+
+        AtlasHeader header;
+        header.headerSize = sizeof(AtlasHeader);
+        header.format = settings.srgb ? CookedTextureFormat::SRGB8_ALPHA8 : CookedTextureFormat::RGBA8;
+        header.width = static_cast<std::uint32_t>(layout.width);
+        header.height = static_cast<std::uint32_t>(layout.height);
+        header.pages = static_cast<std::uint32_t>(layout.pages);
+        header.levelCount = static_cast<std::uint32_t>(chains[0].size());
+        header.spriteCount = static_cast<std::uint32_t>(images.size());
+        header.spritesOffset = AlignUp(sizeof(AtlasHeader));
+
+        std::vector<std::byte> bytes(header.spritesOffset + images.size() * sizeof(AtlasSprite));
+        if (ids) ids->assign(images.size(), 0);
+        for (std::uint32_t id = 0; id < order.size(); ++id) {
+            const std::uint32_t i = order[id];
+            const AtlasRect& rect = layout.rects[i];
+            AtlasSprite sprite;
+            sprite.u0 = static_cast<float>(rect.x) / static_cast<float>(layout.width);
+            sprite.v0 = static_cast<float>(rect.y) / static_cast<float>(layout.height);
+            sprite.u1 = static_cast<float>(rect.x + rect.width) / static_cast<float>(layout.width);
+            sprite.v1 = static_cast<float>(rect.y + rect.height) / static_cast<float>(layout.height);
+            sprite.nameHash = hashes[i];
+            sprite.page = static_cast<std::uint16_t>(rect.page);
+            sprite.x = static_cast<std::uint16_t>(rect.x);
+            sprite.y = static_cast<std::uint16_t>(rect.y);
+            sprite.width = static_cast<std::uint16_t>(rect.width);
+            sprite.height = static_cast<std::uint16_t>(rect.height);
+            std::memcpy(bytes.data() + header.spritesOffset + id * sizeof(AtlasSprite), &sprite, sizeof(sprite));
+            if (ids) (*ids)[i] = id;
+        }
+
+        for (std::uint32_t level = 0; level < header.levelCount; ++level) {
+            const std::size_t offset = AlignUp(bytes.size());
+            const std::size_t pageBytes = chains[0][level].pixels.size();
+            bytes.resize(offset + pageBytes * pages.size());
+            for (std::size_t page = 0; page < pages.size(); ++page)
+                std::memcpy(bytes.data() + offset + page * pageBytes, chains[page][level].pixels.data(), pageBytes);
+            header.levels[level] = {offset, pageBytes * pages.size()};
+        }
+        std::memcpy(bytes.data(), &header, sizeof(header));
+
+        std::ofstream file(path, std::ios::binary);
+        if (!file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size())))
+            throw fail("FILE_NOT_WRITABLE");
+        return layout;
+    }
+
+    Atlas::Atlas(const std::string& path) {
+        try {
+            mFile = MappedFile(path);
+        } catch (const std::runtime_error&) {
+            throw std::runtime_error("ERROR::ATLAS::FILE_NOT_FOUND: " + path);
+        }
+        const auto fail = [&path](const char* what) { return std::runtime_error(std::string("ERROR::ATLAS::") + what + ": " + path); };
+
+        if (mFile.Size() < sizeof(AtlasHeader)) throw fail("TRUNCATED");
+        mHeader = reinterpret_cast<const AtlasHeader*>(mFile.Data());
+        const AtlasHeader& header = *mHeader;
+        if (header.magic != AtlasHeader::kMagic) throw fail("INVALID_MAGIC");
+        if (header.version != AtlasHeader::kVersion || header.headerSize != sizeof(AtlasHeader)) throw fail("UNSUPPORTED_VERSION");
+        if (header.format != CookedTextureFormat::RGBA8 && header.format != CookedTextureFormat::SRGB8_ALPHA8) throw fail("INVALID_FORMAT");
+        if (header.width == 0 || header.height == 0 || header.pages == 0 || header.levelCount == 0
+            || header.levelCount > AtlasHeader::kMaxLevels
+            || header.levelCount > static_cast<std::uint32_t>(std::bit_width(std::max(header.width, header.height))))
+            throw fail("INVALID_SIZE");
+        if (header.spritesOffset % alignof(AtlasSprite) != 0 || header.spritesOffset > mFile.Size()
+            || header.spriteCount > (mFile.Size() - header.spritesOffset) / sizeof(AtlasSprite))
+            throw fail("TABLE_OUT_OF_RANGE");
+
+        for (std::uint32_t i = 0; i < header.levelCount; ++i) {
+            const AtlasHeader::Level& level = header.levels[i];
+            if (level.offset % AtlasHeader::kAlignment != 0 || level.offset > mFile.Size() || level.size > mFile.Size() - level.offset)
+                throw fail("LEVEL_OUT_OF_RANGE");
+            if (level.size != LevelBytes(header, static_cast<int>(i))) throw fail("LEVEL_SIZE_MISMATCH");
+        }
+
+        mSprites = reinterpret_cast<const AtlasSprite*>(mFile.Data() + header.spritesOffset);
+        for (const AtlasSprite& sprite : Sprites()) {
+            if (sprite.page >= header.pages) throw fail("INVALID_SPRITE");
+        }
+
+        const int width = static_cast<int>(header.width), height = static_cast<int>(header.height);
+        const int pages = static_cast<int>(header.pages), levels = static_cast<int>(header.levelCount);
+        mTexture = Texture2DArray(width, height, pages,
+                                  header.format == CookedTextureFormat::SRGB8_ALPHA8 ? GL_SRGB8_ALPHA8 : GL_RGBA8, levels, path);
+        for (int level = 0; level < levels; ++level) {
+            mTexture.SetSubImage(level, 0, 0, 0, std::max(1, width >> level), std::max(1, height >> level), pages, GL_RGBA,
+                                 GL_UNSIGNED_BYTE, mFile.Data() + header.levels[level].offset);
+        }
+    }
+
+    std::uint32_t Atlas::Find(const std::string_view name) const {
+        const std::uint32_t hash = Hash(name);
+        const std::span<const AtlasSprite> sprites = Sprites();
+        const auto it = std::lower_bound(sprites.begin(), sprites.end(), hash,
+                                         [](const AtlasSprite& sprite, const std::uint32_t value) { return sprite.nameHash < value; });
+        if (it == sprites.end() || it->nameHash != hash) return kNotFound;
+        return static_cast<std::uint32_t>(it - sprites.begin());
+    }
+
+}
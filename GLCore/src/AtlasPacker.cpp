@@ -0,0 +1,171 @@
+//
+// Created by niek on 11/26/2025.
+//
+
+#include "GLCore/AtlasPacker.h"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+namespace GLCore {
+
+    namespace {
+        struct Box {
+            int x = 0, y = 0, width = 0, height = 0;
+        };
+
+        bool Contains(const Box& outer, const Box& inner) {
+            return inner.x >= outer.x && inner.y >= outer.y && inner.x + inner.width <= outer.x + outer.width
+                   && inner.y + inner.height <= outer.y + outer.height;
+        }
+
+        // One page in block units: the maximal free rectangles, which may overlap
+        class Bin {
+        public:
+            Bin(const int width, const int height) : mFree{{0, 0, width, height}} {}
+
+            // Best short side fit: the free rectangle leaving the smallest leftover on its shorter side
+            bool Insert(const int width, const int height, Box& placed) {
+                int bestShort = std::numeric_limits<int>::max(), bestLong = bestShort;
+                for (const Box& free : mFree) {
+                    if (free.width < width || free.height < height) continue;
+                    const int dx = free.width - width, dy = free.height - height;
+                    const int shortSide = std::min(dx, dy), longSide = std::max(dx, dy);
+                    if (shortSide < bestShort || (shortSide == bestShort && longSide < bestLong)) {
+                        bestShort = shortSide;
+                        bestLong = longSide;
+                        placed = {free.x, free.y, width, height};
+                    }
+                }
+                if (bestShort == std::numeric_limits<int>::max()) return false;
+
+                Split(placed);
+                Prune();
+                return true;
+            }
+
+        private:
+            void Split(const Box& used) {
+                std::vector<Box> next;
+                next.reserve(mFree.size() + 4);
+                for (const Box& free : mFree) {
+                    if (used.x >= free.x + free.width || used.x + used.width <= free.x
+                        || used.y >= free.y + free.height || used.y + used.height <= free.y) {
+                        next.push_back(free);
+                        continue;
+                    }
+                    // Up to four maximal rectangles around the used one
+                    if (used.x > free.x) next.push_back({free.x, free.y, used.x - free.x, free.height});
+                    if (used.x + used.width < free.x + free.width)
+                        next.push_back({used.x + used.width, free.y, free.x + free.width - used.x - used.width, free.height});
+                    if (used.y > free.y) next.push_back({free.x, free.y, free.width, used.y - free.y});
+                    if (used.y + used.height < free.y + free.height)
+                        next.push_back({free.x, used.y + used.height, free.width, free.y + free.height - used.y - used.height});
+                }
+                mFree = std::move(next);
+            }
+
+            void Prune() {
+                for (std::size_t i = 0; i < mFree.size(); ++i) {
+                    for (std::size_t j = i + 1; j < mFree.size(); ++j) {
+                        if (Contains(mFree[j], mFree[i])) {
+                            mFree.erase(mFree.begin() + static_cast<std::ptrdiff_t>(i--));
+                            break;
+                        }
+                        if (Contains(mFree[i], mFree[j])) mFree.erase(mFree.begin() + static_cast<std::ptrdiff_t>(j--));
+                    }
+                }
+            }
+
+            std::vector<Box> mFree;
+        };
+    }
+
+    AtlasLayout PackAtlas(const std::span<const glm::ivec2> sizes, const AtlasSettings& settings) {
+        const int align = 1 << std::clamp(settings.mipLevels - 1, 0, 15);
+        if (settings.maxSize <= 0 || !std::has_single_bit(static_cast<unsigned>(settings.maxSize)) || settings.maxSize < align
+            || settings.gutter < 0 || settings.mipLevels < 1)
+            throw std::runtime_error("ERROR::ATLAS::INVALID_SETTINGS");
+
+        // Cells in blocks of align x align texels
+        const int maxBlocks = settings.maxSize / align;
+        std::vector<glm::ivec2> cells(sizes.size());
+        glm::ivec2 largest{1, 1};
+        std::uint64_t cellArea = 0;
+        AtlasLayout layout;
+        layout.rects.resize(sizes.size());
+        for (std::size_t i = 0; i < sizes.size(); ++i) {
+            const glm::ivec2 size = sizes[i];
+            if (size.x <= 0 || size.y <= 0) throw std::runtime_error("ERROR::ATLAS::INVALID_IMAGE: " + std::to_string(i));
+            cells[i] = (size + 2 * settings.gutter + align - 1) / align;
+            if (cells[i].x > maxBlocks || cells[i].y > maxBlocks)
+                throw std::runtime_error("ERROR::ATLAS::IMAGE_TOO_LARGE: " + std::to_string(i) + " (" + std::to_string(size.x) + "x"
+                                         + std::to_string(size.y) + ")");
+            largest = glm::max(largest, cells[i]);
+            cellArea += static_cast<std::uint64_t>(cells[i].x) * cells[i].y;
+            layout.rects[i].width = size.x;
+            layout.rects[i].height = size.y;
+            layout.usedTexels += static_cast<std::uint64_t>(size.x) * size.y;
+        }
+        if (sizes.empty()) return layout;
+
+        // Largest first: long side, then area
+        std::vector<std::size_t> order(sizes.size());
+        std::iota(order.begin(), order.end(), std::size_t{0});
+        std::stable_sort(order.begin(), order.end(), [&cells](const std::size_t a, const std::size_t b) {
+            const int sideA = std::max(cells[a].x, cells[a].y), sideB = std::max(cells[b].x, cells[b].y);
+            if (sideA != sideB) return sideA > sideB;
+            return cells[a].x * cells[a].y > cells[b].x * cells[b].y;
+        });
+
+        const auto place = [&](const std::size_t i, const Box& box, const int page) {
+            AtlasRect& rect = layout.rects[i];
+            rect.page = page;
+            rect.x = box.x * align + settings.gutter;
+            rect.y = box.y * align + settings.gutter;
+        };
+
+        // One page, from the smallest power of two that could hold every cell up to maxSize x maxSize
+        const auto grow = [maxBlocks](int& width, int& height) {
+            if ((width <= height && width < maxBlocks) || height == maxBlocks) width *= 2;
+            else height *= 2;
+        };
+        int width = static_cast<int>(std::bit_ceil(static_cast<unsigned>(largest.x)));
+        int height = static_cast<int>(std::bit_ceil(static_cast<unsigned>(largest.y)));
+        while (static_cast<std::uint64_t>(width) * height < cellArea && (width < maxBlocks || height < maxBlocks))
+            grow(width, height);
+        for (;;) {
+            Bin bin(width, height);
+            Box box;
+            std::size_t placed = 0;
+            for (; placed < order.size() && bin.Insert(cells[order[placed]].x, cells[order[placed]].y, box); ++placed)
+                place(order[placed], box, 0);
+            if (placed == order.size()) {
+                layout.width = width * align;
+                layout.height = height * align;
+                layout.pages = 1;
+                return layout;
+            }
+            if (width == maxBlocks && height == maxBlocks) break;
+            grow(width, height);
+        }
+
+        // Several maxSize pages (array layers share one size): each cell goes to the first page it fits
+        std::vector<Bin> bins;
+        for (const std::size_t i : order) {
+            Box box;
+            std::size_t page = 0;
+            while (page < bins.size() && !bins[page].Insert(cells[i].x, cells[i].y, box)) ++page;
+            if (page == bins.size()) bins.emplace_back(maxBlocks, maxBlocks).Insert(cells[i].x, cells[i].y, box);
+            place(i, box, static_cast<int>(page));
+        }
+        layout.width = layout.height = settings.maxSize;
+        layout.pages = static_cast<int>(bins.size());
+        return layout;
+    }
+
+}
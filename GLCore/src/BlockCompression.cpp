@@ -0,0 +1,750 @@
+//
+// Created by niek on 11/24/2025.
+//
+
+#include "GLCore/BlockCompression.h"
+#include "GLCore/Caps.h"
+#include "GLCore/Texture.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace GLCore {
+
+    namespace {
+        using Texel = std::array<int, 4>;
+        using Block = std::array<Texel, 16>;
+
+        // BC7 interpolation weights (out of 64) for 4-bit indices
+        constexpr int kWeights4[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+        int RefinePasses(const BlockQuality quality) {
+            return quality == BlockQuality::Fast ? 0 : quality == BlockQuality::Normal ? 1 : 3;
+        }
+
+        int Square(const int x) { return x * x; }
+
+        template<int Channels>
+        int Distance(const Texel& a, const Texel& b) {
+            int d = 0;
+            for (int c = 0; c < Channels; ++c) d += Square(a[c] - b[c]);
+            return d;
+        }
+
+        /**
+         * Principal axis of the block's texels (first `channels` components) by power iteration on the covariance,
+         * and the block mean. Returns a zero axis for a solid block.
+         */
+        template<int channels>
+        void PrincipalAxis(const Block& block, float mean[4], float axis[4]) {
+            // Exact integer moments: covariance = (16 * sum(xy) - sum(x) * sum(y)) / 256
+            int sum[4]{}, products[4][4]{};
+            for (const Texel& t : block)
+                for (int i = 0; i < channels; ++i) {
+                    sum[i] += t[i];
+                    for (int j = i; j < channels; ++j) products[i][j] += t[i] * t[j];
+                }
+            float covariance[4][4]{};
+            for (int i = 0; i < 4; ++i) {
+                mean[i] = static_cast<float>(sum[i]) / 16.0f;
+                axis[i] = 0.0f;
+            }
+            for (int i = 0; i < channels; ++i)
+                for (int j = i; j < channels; ++j)
+                    covariance[i][j] = covariance[j][i] = static_cast<float>(16 * products[i][j] - sum[i] * sum[j]) / 256.0f;
+
+            // Start from the largest diagonal entry's axis so the iteration cannot begin orthogonal to the answer
+            int start = 0;
+            for (int c = 1; c < channels; ++c) if (covariance[c][c] > covariance[start][start]) start = c;
+            if (covariance[start][start] <= 0.0f) return;
+            float v[4] = {covariance[start][0], covariance[start][1], covariance[start][2], covariance[start][3]};
+            for (int iteration = 0; iteration < 4; ++iteration) {
+                float next[4]{}, length = 0.0f;
+                for (int i = 0; i < channels; ++i) {
+                    for (int j = 0; j < channels; ++j) next[i] += covariance[i][j] * v[j];
+                    length = std::max(length, std::abs(next[i]));
+                }
+                if (length <= 0.0f) return;
+                const float scale = 1.0f / length;
+                for (int i = 0; i < channels; ++i) v[i] = next[i] * scale;
+            }
+            float length = 0.0f;
+            for (int c = 0; c < channels; ++c) length += v[c] * v[c];
+            length = std::sqrt(length);
+            for (int c = 0; c < channels; ++c) axis[c] = v[c] / length;
+        }
+
+        // The block's extent along `axis`, as two points on the line through `mean` clamped to [0, 255]
+        template<int channels>
+        void AxisEndpoints(const Block& block, const float mean[4], const float axis[4], float low[4], float high[4]) {
+            float tMin = 0.0f, tMax = 0.0f;
+            for (const Texel& t : block) {
+                float projection = 0.0f;
+                for (int c = 0; c < channels; ++c) projection += (static_cast<float>(t[c]) - mean[c]) * axis[c];
+                tMin = std::min(tMin, projection);
+                tMax = std::max(tMax, projection);
+            }
+            for (int c = 0; c < channels; ++c) {
+                low[c] = std::clamp(mean[c] + tMin * axis[c], 0.0f, 255.0f);
+                high[c] = std::clamp(mean[c] + tMax * axis[c], 0.0f, 255.0f);
+            }
+        }
+
+        /**
+         * Least-squares endpoints for fixed indices: minimizes sum |(1 - w_i) a + w_i b - x_i|^2 per channel.
+         * Returns false when every texel uses the same weight (the system is singular).
+         */
+        template<int channels>
+        bool LeastSquares(const Block& block, const float weights[16], float a[4], float b[4]) {
+            float aa = 0.0f, ab = 0.0f, bb = 0.0f, ax[4]{}, bx[4]{};
+            for (int i = 0; i < 16; ++i) {
+                const float w = weights[i], iw = 1.0f - w;
+                aa += iw * iw;
+                ab += iw * w;
+                bb += w * w;
+                for (int c = 0; c < channels; ++c) {
+                    ax[c] += iw * static_cast<float>(block[i][c]);
+                    bx[c] += w * static_cast<float>(block[i][c]);
+                }
+            }
+            const float determinant = aa * bb - ab * ab;
+            if (std::abs(determinant) < 1e-6f) return false;
+            for (int c = 0; c < channels; ++c) {
+                a[c] = std::clamp((bb * ax[c] - ab * bx[c]) / determinant, 0.0f, 255.0f);
+                b[c] = std::clamp((aa * bx[c] - ab * ax[c]) / determinant, 0.0f, 255.0f);
+            }
+            return true;
+        }
+
+        /** @brief Little-endian bit stream over one zeroed 16-byte block. */
+        class BitWriter {
+        public:
+            explicit BitWriter(std::uint8_t* out) : mOut(out) {}
+
+            void Put(const std::uint32_t value, const int bits) {
+                for (int b = 0; b < bits; ++b, ++mPosition)
+                    mOut[mPosition >> 3] |= static_cast<std::uint8_t>(((value >> b) & 1u) << (mPosition & 7));
+            }
+
+        private:
+            std::uint8_t* mOut;
+            int mPosition = 0;
+        };
+
+        class BitReader {
+        public:
+            explicit BitReader(const std::uint8_t* in) : mIn(in) {}
+
+            std::uint32_t Get(const int bits) {
+                std::uint32_t value = 0;
+                for (int b = 0; b < bits; ++b, ++mPosition) value |= ((mIn[mPosition >> 3] >> (mPosition & 7)) & 1u) << b;
+                return value;
+            }
+
+        private:
+            const std::uint8_t* mIn;
+            int mPosition = 0;
+        };
+
+        // ---- BC1 color --------------------------------------------------------------------------------------------
+
+        Texel Unpack565(const std::uint16_t color) {
+            const int r = color >> 11, g = (color >> 5) & 63, b = color & 31;
+            return {(r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2), 255};
+        }
+
+        std::uint16_t Pack565(const float color[4]) {
+            const auto quantize = [](const float v, const int max) { return std::clamp(static_cast<int>(v / 255.0f * max + 0.5f), 0, max); };
+            return static_cast<std::uint16_t>(quantize(color[0], 31) << 11 | quantize(color[1], 63) << 5 | quantize(color[2], 31));
+        }
+
+        std::array<Texel, 4> ColorPalette(const std::uint16_t c0, const std::uint16_t c1) {
+            const Texel a = Unpack565(c0), b = Unpack565(c1);
+            std::array<Texel, 4> palette{a, b, a, b};
+            if (c0 > c1) {
+                for (int c = 0; c < 3; ++c) {
+                    palette[2][c] = (2 * a[c] + b[c]) / 3;
+                    palette[3][c] = (a[c] + 2 * b[c]) / 3;
+                }
+            } else {
+                for (int c = 0; c < 3; ++c) palette[2][c] = (a[c] + b[c]) / 2;
+                palette[3] = {0, 0, 0, 255};    // transparent black in RGBA DXT1; opaque black as RGB DXT1
+            }
+            return palette;
+        }
+
+        struct ColorFit {
+            std::uint16_t c0 = 0, c1 = 0;
+            std::uint8_t indices[16]{};
+            int error = std::numeric_limits<int>::max();
+        };
+
+        // Best indices for two 5:6:5 endpoints, always in four-color order (c0 > c1; equal endpoints use index 0)
+        ColorFit FitColor(const Block& block, std::uint16_t c0, std::uint16_t c1) {
+            ColorFit fit;
+            if (c0 < c1) std::swap(c0, c1);
+            fit.c0 = c0;
+            fit.c1 = c1;
+            fit.error = 0;
+            const std::array<Texel, 4> palette = ColorPalette(c0, c1);
+
+            // The four entries lie on the c0 -> c1 line in the order 0, 2, 3, 1: index by rounded projection
+            // (branch-free; a compare per candidate mispredicts on most texels)
+            static constexpr std::uint8_t kOrder[4] = {0, 2, 3, 1};
+            int direction[3], length = 0;
+            for (int c = 0; c < 3; ++c) {
+                direction[c] = palette[1][c] - palette[0][c];
+                length += direction[c] * direction[c];
+            }
+            for (int i = 0; i < 16; ++i) {
+                int dot = 0;
+                for (int c = 0; c < 3; ++c) dot += (block[i][c] - palette[0][c]) * direction[c];
+                const int step = length > 0 ? std::clamp((dot * 6 + length) / (2 * length), 0, 3) : 0;
+                fit.indices[i] = kOrder[step];
+                fit.error += Distance<3>(block[i], palette[kOrder[step]]);
+            }
+            return fit;
+        }
+
+        /**
+         * Endpoint pairs (5 and 6 bits) whose 2:1 blend comes closest to each 8-bit value, so a solid block is
+         * encoded with palette entry 2 instead of the nearest representable endpoint.
+         */
+        struct SolidColorTables {
+            std::uint8_t five[256][2];
+            std::uint8_t six[256][2];
+
+            SolidColorTables() {
+                Build(five, 5);
+                Build(six, 6);
+            }
+
+            static void Build(std::uint8_t (&table)[256][2], const int bits) {
+                const int levels = 1 << bits;
+                const auto expand = [bits](const int q) { return bits == 5 ? (q << 3) | (q >> 2) : (q << 2) | (q >> 4); };
+                for (int v = 0; v < 256; ++v) {
+                    int bestError = std::numeric_limits<int>::max();
+                    for (int a = 0; a < levels; ++a) {
+                        for (int b = 0; b < levels; ++b) {
+                            const int value = (2 * expand(a) + expand(b)) / 3;
+                            const int error = std::abs(value - v) * 1024 + std::abs(expand(a) - expand(b));
+                            if (error < bestError) {
+                                bestError = error;
+                                table[v][0] = static_cast<std::uint8_t>(a);
+                                table[v][1] = static_cast<std::uint8_t>(b);
+                            }
+                        }
+                    }
+                }
+            }
+        };
+
+        void WriteColor(const ColorFit& fit, std::uint8_t* out) {
+            out[0] = static_cast<std::uint8_t>(fit.c0);
+            out[1] = static_cast<std::uint8_t>(fit.c0 >> 8);
+            out[2] = static_cast<std::uint8_t>(fit.c1);
+            out[3] = static_cast<std::uint8_t>(fit.c1 >> 8);
+            std::uint32_t bits = 0;
+            for (int i = 0; i < 16; ++i) bits |= static_cast<std::uint32_t>(fit.indices[i]) << (2 * i);
+            for (int b = 0; b < 4; ++b) out[4 + b] = static_cast<std::uint8_t>(bits >> (8 * b));
+        }
+
+        void EncodeColor(const Block& block, std::uint8_t* out, const int passes) {
+            bool solid = true;
+            for (int i = 1; i < 16 && solid; ++i) solid = block[i][0] == block[0][0] && block[i][1] == block[0][1] && block[i][2] == block[0][2];
+            if (solid) {
+                static const SolidColorTables tables;
+                const Texel& t = block[0];
+                const auto c0 = static_cast<std::uint16_t>(tables.five[t[0]][0] << 11 | tables.six[t[1]][0] << 5 | tables.five[t[2]][0]);
+                const auto c1 = static_cast<std::uint16_t>(tables.five[t[0]][1] << 11 | tables.six[t[1]][1] << 5 | tables.five[t[2]][1]);
+                ColorFit fit;
+                fit.c0 = std::max(c0, c1);
+                fit.c1 = std::min(c0, c1);
+                const std::uint8_t index = c0 == c1 ? 0 : c0 > c1 ? 2 : 3;
+                std::fill(std::begin(fit.indices), std::end(fit.indices), index);
+                WriteColor(fit, out);
+                return;
+            }
+
+            float mean[4], axis[4], low[4]{}, high[4]{};
+            PrincipalAxis<3>(block, mean, axis);
+            AxisEndpoints<3>(block, mean, axis, low, high);
+            ColorFit best = FitColor(block, Pack565(high), Pack565(low));
+
+            // Index -> weight of c1: 0 -> 0, 1 -> 1, 2 -> 1/3, 3 -> 2/3
+            static constexpr float kColorWeights[4] = {0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f};
+            for (int pass = 0; pass < passes && best.c0 != best.c1; ++pass) {
+                float weights[16];
+                for (int i = 0; i < 16; ++i) weights[i] = kColorWeights[best.indices[i]];
+                float a[4]{}, b[4]{};
+                if (!LeastSquares<3>(block, weights, a, b)) break;
+                const ColorFit fit = FitColor(block, Pack565(a), Pack565(b));
+                if (fit.error >= best.error) break;
+                best = fit;
+            }
+            WriteColor(best, out);
+        }
+
+        void DecodeColor(const std::uint8_t* in, Texel* texels) {
+            const auto c0 = static_cast<std::uint16_t>(in[0] | in[1] << 8);
+            const auto c1 = static_cast<std::uint16_t>(in[2] | in[3] << 8);
+            const std::array<Texel, 4> palette = ColorPalette(c0, c1);
+            const std::uint32_t bits = in[4] | in[5] << 8 | in[6] << 16 | static_cast<std::uint32_t>(in[7]) << 24;
+            for (int i = 0; i < 16; ++i) texels[i] = palette[(bits >> (2 * i)) & 3];
+        }
+
+        // ---- BC4 single channel -----------------------------------------------------------------------------------
+
+        std::array<int, 8> ChannelPalette(const int e0, const int e1) {
+            std::array<int, 8> palette{e0, e1};
+            if (e0 > e1) {
+                for (int k = 2; k < 8; ++k) palette[k] = ((8 - k) * e0 + (k - 1) * e1 + 3) / 7;
+            } else {
+                for (int k = 2; k < 6; ++k) palette[k] = ((6 - k) * e0 + (k - 1) * e1 + 2) / 5;
+                palette[6] = 0;
+                palette[7] = 255;
+            }
+            return palette;
+        }
+
+        struct ChannelFit {
+            int e0 = 0, e1 = 0;
+            std::uint8_t indices[16]{};
+            int error = std::numeric_limits<int>::max();
+        };
+
+        ChannelFit FitChannel(const int (&values)[16], const int e0, const int e1) {
+            ChannelFit fit;
+            fit.e0 = e0;
+            fit.e1 = e1;
+            fit.error = 0;
+            const std::array<int, 8> palette = ChannelPalette(e0, e1);
+            if (e0 > e1) {
+                // Eight-value mode: entries run e0, 2, 3, ..., 7, e1, so the rounded position is the index
+                static constexpr std::uint8_t kOrder[8] = {0, 2, 3, 4, 5, 6, 7, 1};
+                const int range = e1 - e0;
+                for (int i = 0; i < 16; ++i) {
+                    const int step = std::clamp(((values[i] - e0) * 14 + range) / (2 * range), 0, 7);
+                    fit.indices[i] = kOrder[step];
+                    fit.error += Square(values[i] - palette[kOrder[step]]);
+                }
+                return fit;
+            }
+            for (int i = 0; i < 16; ++i) {
+                int best = 0, bestDistance = Square(values[i] - palette[0]);
+                for (int k = 1; k < 8; ++k) {
+                    const int distance = Square(values[i] - palette[k]);
+                    if (distance < bestDistance) {
+                        best = k;
+                        bestDistance = distance;
+                    }
+                }
+                fit.indices[i] = static_cast<std::uint8_t>(best);
+                fit.error += bestDistance;
+            }
+            return fit;
+        }
+
+        void EncodeChannel(const int (&values)[16], std::uint8_t* out, const int passes) {
+            int low = 255, high = 0, innerLow = 255, innerHigh = 0;
+            bool extremes = false;
+            for (const int v : values) {
+                low = std::min(low, v);
+                high = std::max(high, v);
+                if (v == 0 || v == 255) extremes = true;
+                else {
+                    innerLow = std::min(innerLow, v);
+                    innerHigh = std::max(innerHigh, v);
+                }
+            }
+
+            // Eight-value mode spans [low, high]; e0 == e1 (solid) is exact in either mode
+            ChannelFit best = FitChannel(values, high, low);
+            static constexpr float kWeights8[8] = {0.0f, 1.0f, 1.0f / 7, 2.0f / 7, 3.0f / 7, 4.0f / 7, 5.0f / 7, 6.0f / 7};
+            for (int pass = 0; pass < passes && best.error > 0; ++pass) {
+                Block block{};
+                float weights[16];
+                for (int i = 0; i < 16; ++i) {
+                    block[i][0] = values[i];
+                    weights[i] = kWeights8[best.indices[i]];
+                }
+                float a[4]{}, b[4]{};
+                if (!LeastSquares<1>(block, weights, a, b)) break;
+                const int e0 = static_cast<int>(a[0] + 0.5f), e1 = static_cast<int>(b[0] + 0.5f);
+                if (e0 <= e1) break;    // would switch to six-value mode
+                const ChannelFit fit = FitChannel(values, e0, e1);
+                if (fit.error >= best.error) break;
+                best = fit;
+            }
+
+            // Six-value mode: the inner range gets the interpolated entries, 0 and 255 are exact
+            if (passes > 0 && extremes && innerLow <= innerHigh) {
+                const ChannelFit fit = FitChannel(values, innerLow, innerHigh);
+                if (fit.error < best.error) best = fit;
+            }
+
+            out[0] = static_cast<std::uint8_t>(best.e0);
+            out[1] = static_cast<std::uint8_t>(best.e1);
+            std::uint64_t bits = 0;
+            for (int i = 0; i < 16; ++i) bits |= static_cast<std::uint64_t>(best.indices[i]) << (3 * i);
+            for (int b = 0; b < 6; ++b) out[2 + b] = static_cast<std::uint8_t>(bits >> (8 * b));
+        }
+
+        void DecodeChannel(const std::uint8_t* in, Texel* texels, const int channel) {
+            const std::array<int, 8> palette = ChannelPalette(in[0], in[1]);
+            std::uint64_t bits = 0;
+            for (int b = 0; b < 6; ++b) bits |= static_cast<std::uint64_t>(in[2 + b]) << (8 * b);
+            for (int i = 0; i < 16; ++i) texels[i][channel] = palette[(bits >> (3 * i)) & 7];
+        }
+
+        // ---- BC7 mode 6 -------------------------------------------------------------------------------------------
+
+        struct Bc7Fit {
+            int q[2][4]{};      // 7-bit endpoints
+            int p[2]{};         // p-bits: the shared low bit of each endpoint
+            std::uint8_t indices[16]{};
+            int error = std::numeric_limits<int>::max();
+        };
+
+        void FitBc7Indices(const Block& block, Bc7Fit& fit) {
+            Texel e0, e1;
+            for (int c = 0; c < 4; ++c) {
+                e0[c] = fit.q[0][c] << 1 | fit.p[0];
+                e1[c] = fit.q[1][c] << 1 | fit.p[1];
+            }
+            Texel palette[16];
+            for (int k = 0; k < 16; ++k)
+                for (int c = 0; c < 4; ++c) palette[k][c] = ((64 - kWeights4[k]) * e0[c] + kWeights4[k] * e1[c] + 32) >> 6;
+
+            // Project onto the endpoint line for a first guess, then settle on the best of its neighbours
+            static constexpr std::array<std::uint8_t, 65> kNearest = [] {
+                std::array<std::uint8_t, 65> nearest{};
+                for (int w = 0; w <= 64; ++w)
+                    for (int k = 1; k < 16; ++k)
+                        if (std::abs(kWeights4[k] - w) < std::abs(kWeights4[nearest[w]] - w)) nearest[w] = static_cast<std::uint8_t>(k);
+                return nearest;
+            }();
+            int direction[4], length = 0;
+            for (int c = 0; c < 4; ++c) {
+                direction[c] = e1[c] - e0[c];
+                length += direction[c] * direction[c];
+            }
+
+            fit.error = 0;
+            for (int i = 0; i < 16; ++i) {
+                int guess = 0;
+                if (length > 0) {
+                    int dot = 0;
+                    for (int c = 0; c < 4; ++c) dot += (block[i][c] - e0[c]) * direction[c];
+                    guess = kNearest[std::clamp((dot * 64 + length / 2) / length, 0, 64)];
+                }
+                int best = guess, bestDistance = Distance<4>(block[i], palette[guess]);
+                for (const int k : {guess - 1, guess + 1}) {
+                    if (k < 0 || k > 15) continue;
+                    const int distance = Distance<4>(block[i], palette[k]);
+                    if (distance < bestDistance) {
+                        best = k;
+                        bestDistance = distance;
+                    }
+                }
+                fit.indices[i] = static_cast<std::uint8_t>(best);
+                fit.error += bestDistance;
+            }
+        }
+
+        int QuantizeBc7(const float value, const int pBit) {
+            return std::clamp(static_cast<int>(std::floor((value - static_cast<float>(pBit)) / 2.0f + 0.5f)), 0, 127);
+        }
+
+        // Quantize float endpoints with every allowed p-bit pair (the cheaper per-endpoint choice when `exhaustive`
+        // is off) and keep the best fit in `best`
+        void TryBc7(const Block& block, const float a[4], const float b[4], const bool exhaustive, Bc7Fit& best) {
+            const auto bestPBit = [](const float e[4]) {
+                float error[2]{};
+                for (int p = 0; p < 2; ++p)
+                    for (int c = 0; c < 4; ++c) {
+                        const float d = static_cast<float>(QuantizeBc7(e[c], p) << 1 | p) - e[c];
+                        error[p] += d * d;
+                    }
+                return error[1] < error[0] ? 1 : 0;
+            };
+            const int p0 = bestPBit(a), p1 = bestPBit(b);
+            for (int combination = 0; combination < 4; ++combination) {
+                Bc7Fit fit;
+                fit.p[0] = exhaustive ? combination & 1 : p0;
+                fit.p[1] = exhaustive ? combination >> 1 : p1;
+                for (int c = 0; c < 4; ++c) {
+                    fit.q[0][c] = QuantizeBc7(a[c], fit.p[0]);
+                    fit.q[1][c] = QuantizeBc7(b[c], fit.p[1]);
+                }
+                FitBc7Indices(block, fit);
+                if (fit.error < best.error) best = fit;
+                if (!exhaustive) break;
+            }
+        }
+
+        void EncodeBc7(const Block& block, std::uint8_t* out, const BlockQuality quality) {
+            const int passes = RefinePasses(quality);
+            const bool exhaustive = quality != BlockQuality::Fast;
+
+            float mean[4], axis[4], low[4]{}, high[4]{};
+            PrincipalAxis<4>(block, mean, axis);
+            AxisEndpoints<4>(block, mean, axis, low, high);
+            Bc7Fit best;
+            TryBc7(block, low, high, exhaustive, best);
+
+            for (int pass = 0; pass < passes && best.error > 0; ++pass) {
+                float weights[16];
+                for (int i = 0; i < 16; ++i) weights[i] = static_cast<float>(kWeights4[best.indices[i]]) / 64.0f;
+                float a[4]{}, b[4]{};
+                if (!LeastSquares<4>(block, weights, a, b)) break;
+                const int previous = best.error;
+                TryBc7(block, a, b, exhaustive, best);
+                if (best.error >= previous) break;
+            }
+
+            // High: greedy +-1 steps on each quantized endpoint component
+            if (quality == BlockQuality::High) {
+                for (bool improved = true; improved && best.error > 0;) {
+                    improved = false;
+                    for (int e = 0; e < 2; ++e)
+                        for (int c = 0; c < 4; ++c)
+                            for (const int step : {-1, 1}) {
+                                Bc7Fit fit = best;
+                                fit.q[e][c] += step;
+                                if (fit.q[e][c] < 0 || fit.q[e][c] > 127) continue;
+                                FitBc7Indices(block, fit);
+                                if (fit.error < best.error) {
+                                    best = fit;
+                                    improved = true;
+                                }
+                            }
+                }
+            }
+
+            // The anchor (texel 0) index is stored without its top bit: swap the endpoints if it is set
+            if (best.indices[0] & 8) {
+                for (int c = 0; c < 4; ++c) std::swap(best.q[0][c], best.q[1][c]);
+                std::swap(best.p[0], best.p[1]);
+                for (std::uint8_t& index : best.indices) index = static_cast<std::uint8_t>(15 - index);
+            }
+
+            std::memset(out, 0, 16);
+            BitWriter writer(out);
+            writer.Put(1u << 6, 7);    // mode 6
+            for (int c = 0; c < 4; ++c) {
+                writer.Put(static_cast<std::uint32_t>(best.q[0][c]), 7);
+                writer.Put(static_cast<std::uint32_t>(best.q[1][c]), 7);
+            }
+            writer.Put(static_cast<std::uint32_t>(best.p[0]), 1);
+            writer.Put(static_cast<std::uint32_t>(best.p[1]), 1);
+            writer.Put(best.indices[0], 3);
+            for (int i = 1; i < 16; ++i) writer.Put(best.indices[i], 4);
+        }
+
+        void DecodeBc7(const std::uint8_t* in, Texel* texels) {
+            if ((in[0] & 0x7F) != 1u << 6)
+                throw std::runtime_error("ERROR::BLOCK_COMPRESSION::UNSUPPORTED_BC7_MODE: only mode 6 is decoded");
+            BitReader reader(in);
+            reader.Get(7);
+            int e[2][4];
+            for (int c = 0; c < 4; ++c) {
+                e[0][c] = static_cast<int>(reader.Get(7)) << 1;
+                e[1][c] = static_cast<int>(reader.Get(7)) << 1;
+            }
+            const int p0 = static_cast<int>(reader.Get(1)), p1 = static_cast<int>(reader.Get(1));
+            for (int c = 0; c < 4; ++c) {
+                e[0][c] |= p0;
+                e[1][c] |= p1;
+            }
+            for (int i = 0; i < 16; ++i) {
+                const int w = kWeights4[reader.Get(i == 0 ? 3 : 4)];
+                for (int c = 0; c < 4; ++c) texels[i][c] = ((64 - w) * e[0][c] + w * e[1][c] + 32) >> 6;
+            }
+        }
+
+        // ---- Block gather / scatter -------------------------------------------------------------------------------
+
+        // 4x4 texels at block (bx, by), edges repeated; raw channels, or RGBA with grey expanded when `expand`
+        Block LoadBlock(const Image& image, const int bx, const int by, const bool expand) {
+            Block block{};
+            for (int y = 0; y < 4; ++y) {
+                const int sy = std::min(by * 4 + y, image.height - 1);
+                for (int x = 0; x < 4; ++x) {
+                    const int sx = std::min(bx * 4 + x, image.width - 1);
+                    const std::uint8_t* p = &image.pixels[(static_cast<std::size_t>(sy) * image.width + sx) * image.channels];
+                    Texel& t = block[y * 4 + x];
+                    if (!expand || image.channels == 4) {
+                        for (int c = 0; c < image.channels; ++c) t[c] = p[c];
+                    } else {
+                        t = {p[0], p[0], p[0], image.channels == 2 ? p[1] : 255};
+                    }
+                }
+            }
+            return block;
+        }
+
+        // Channel c of texel i, with the same grey expansion as LoadBlock when the image has fewer channels
+        int Sample(const Image& image, const std::size_t texel, const int c, const int channels) {
+            const std::uint8_t* p = &image.pixels[texel * image.channels];
+            if (channels <= image.channels) return p[c];
+            if (c < 3) return p[0];
+            return image.channels == 2 ? p[1] : 255;
+        }
+    }
+
+    std::vector<std::uint8_t> CompressImage(const Image& image, const BlockFormat format, const BlockQuality quality, ThreadPool& pool) {
+        if (image.width <= 0 || image.height <= 0 || image.pixels.size() != static_cast<std::size_t>(image.width) * image.height * image.channels)
+            throw std::runtime_error("ERROR::BLOCK_COMPRESSION::INVALID_IMAGE");
+        if ((image.channels != 1 && image.channels != 2 && image.channels != 4) || (format == BlockFormat::BC5 && image.channels < 2))
+            throw std::runtime_error(std::string("ERROR::BLOCK_COMPRESSION::UNSUPPORTED_CHANNELS: ") + std::to_string(image.channels)
+                                     + " for " + ToString(format));
+
+        const int blocksX = (image.width + 3) / 4, blocksY = (image.height + 3) / 4;
+        const std::size_t blockBytes = BlockBytes(format);
+        const int passes = RefinePasses(quality);
+        std::vector<std::uint8_t> blocks(static_cast<std::size_t>(blocksX) * blocksY * blockBytes);
+
+        pool.ParallelFor(static_cast<std::size_t>(blocksY), [&](const std::size_t row) {
+            const int by = static_cast<int>(row);
+            for (int bx = 0; bx < blocksX; ++bx) {
+                std::uint8_t* out = blocks.data() + (static_cast<std::size_t>(by) * blocksX + bx) * blockBytes;
+                const Block block = LoadBlock(image, bx, by, format != BlockFormat::BC4 && format != BlockFormat::BC5);
+                int channel[16];
+                switch (format) {
+                    case BlockFormat::BC1:
+                        EncodeColor(block, out, passes);
+                        break;
+                    case BlockFormat::BC3:
+                        for (int i = 0; i < 16; ++i) channel[i] = block[i][3];
+                        EncodeChannel(channel, out, passes);
+                        EncodeColor(block, out + 8, passes);
+                        break;
+                    case BlockFormat::BC4:
+                        for (int i = 0; i < 16; ++i) channel[i] = block[i][0];
+                        EncodeChannel(channel, out, passes);
+                        break;
+                    case BlockFormat::BC5:
+                        for (int c = 0; c < 2; ++c) {
+                            for (int i = 0; i < 16; ++i) channel[i] = block[i][c];
+                            EncodeChannel(channel, out + 8 * c, passes);
+                        }
+                        break;
+                    case BlockFormat::BC7:
+                        EncodeBc7(block, out, quality);
+                        break;
+                }
+            }
+        });
+        return blocks;
+    }
+
+    Image DecompressImage(const std::span<const std::uint8_t> blocks, const BlockFormat format, const int width, const int height) {
+        if (width <= 0 || height <= 0 || blocks.size() != CompressedBytes(format, width, height))
+            throw std::runtime_error("ERROR::BLOCK_COMPRESSION::SIZE_MISMATCH");
+
+        Image image;
+        image.width = width;
+        image.height = height;
+        image.channels = BlockChannels(format);
+        image.pixels.resize(static_cast<std::size_t>(width) * height * image.channels);
+
+        const int blocksX = (width + 3) / 4, blocksY = (height + 3) / 4;
+        const std::size_t blockBytes = BlockBytes(format);
+        for (int by = 0; by < blocksY; ++by) {
+            for (int bx = 0; bx < blocksX; ++bx) {
+                const std::uint8_t* in = blocks.data() + (static_cast<std::size_t>(by) * blocksX + bx) * blockBytes;
+                Texel texels[16];
+                switch (format) {
+                    case BlockFormat::BC1:
+                        DecodeColor(in, texels);
+                        for (Texel& t : texels) t[3] = 255;    // RGB DXT1: index 3 of three-color blocks is opaque black
+                        break;
+                    case BlockFormat::BC3:
+                        DecodeColor(in + 8, texels);
+                        DecodeChannel(in, texels, 3);
+                        break;
+                    case BlockFormat::BC4:
+                        DecodeChannel(in, texels, 0);
+                        break;
+                    case BlockFormat::BC5:
+                        DecodeChannel(in, texels, 0);
+                        DecodeChannel(in + 8, texels, 1);
+                        break;
+                    case BlockFormat::BC7:
+                        DecodeBc7(in, texels);
+                        break;
+                }
+                for (int y = 0; y < 4 && by * 4 + y < height; ++y)
+                    for (int x = 0; x < 4 && bx * 4 + x < width; ++x) {
+                        std::uint8_t* p = &image.pixels[(static_cast<std::size_t>(by * 4 + y) * width + bx * 4 + x) * image.channels];
+                        for (int c = 0; c < image.channels; ++c) p[c] = static_cast<std::uint8_t>(texels[y * 4 + x][c]);
+                    }
+            }
+        }
+        return image;
+    }
+
+    double Psnr(const Image& reference, const Image& decoded, const int channels) {
+        if (reference.width != decoded.width || reference.height != decoded.height)
+            throw std::runtime_error("ERROR::BLOCK_COMPRESSION::SIZE_MISMATCH");
+        const int compared = channels > 0 ? std::min(channels, decoded.channels) : decoded.channels;
+        const std::size_t texels = static_cast<std::size_t>(decoded.width) * decoded.height;
+        double squared = 0.0;
+        for (std::size_t i = 0; i < texels; ++i)
+            for (int c = 0; c < compared; ++c)
+                squared += Square(Sample(reference, i, c, decoded.channels) - decoded.pixels[i * decoded.channels + c]);
+        if (squared == 0.0) return std::numeric_limits<double>::infinity();
+        const double mse = squared / static_cast<double>(texels * compared);
+        return 10.0 * std::log10(255.0 * 255.0 / mse);
+    }
+
+    std::size_t BlockBytes(const BlockFormat format) {
+        return format == BlockFormat::BC1 || format == BlockFormat::BC4 ? 8 : 16;
+    }
+
+    std::size_t CompressedBytes(const BlockFormat format, const int width, const int height) {
+        return static_cast<std::size_t>((width + 3) / 4) * ((height + 3) / 4) * BlockBytes(format);
+    }
+
+    int BlockChannels(const BlockFormat format) {
+        return format == BlockFormat::BC4 ? 1 : format == BlockFormat::BC5 ? 2 : 4;
+    }
+
+    GLenum BlockInternalFormat(const BlockFormat format, const bool srgb) {
+        switch (format) {
+            case BlockFormat::BC1: return srgb ? GL_COMPRESSED_SRGB_S3TC_DXT1_EXT : GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+            case BlockFormat::BC3: return srgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+            case BlockFormat::BC4: return GL_COMPRESSED_RED_RGTC1;
+            case BlockFormat::BC5: return GL_COMPRESSED_RG_RGTC2;
+            default: return srgb ? GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM : GL_COMPRESSED_RGBA_BPTC_UNORM;
+        }
+    }
+
+    bool BlockFormatSupported(const BlockFormat format) {
+        const Caps& caps = Caps::Get();
+        switch (format) {
+            case BlockFormat::BC1:
+            case BlockFormat::BC3: return caps.textureCompressionS3TC;
+            case BlockFormat::BC4:
+            case BlockFormat::BC5: return caps.textureCompressionRGTC;
+            default: return caps.textureCompressionBPTC;
+        }
+    }
+
+    const char* ToString(const BlockFormat format) {
+        switch (format) {
+            case BlockFormat::BC1: return "BC1";
+            case BlockFormat::BC3: return "BC3";
+            case BlockFormat::BC4: return "BC4";
+            case BlockFormat::BC5: return "BC5";
+            default: return "BC7";
+        }
+    }
+
+}
@@ -0,0 +1,93 @@
+//
+// Created by niek on 11/10/2025.
+//
+
+#include "GLCore/Buffer.h"
+#include "GLCore/Caps.h"
+#include "GLCore/Debug.h"
+
+#include <utility>
+
+namespace GLCore {
+
+    namespace {
+        GLenum ToGL(const BufferUsage usage) {
+            switch (usage) {
+                case BufferUsage::Dynamic: return GL_DYNAMIC_DRAW;
+                case BufferUsage::Stream: return GL_STREAM_DRAW;
+                default: return GL_STATIC_DRAW;
+            }
+        }
+    }
+
+    Buffer::Buffer(const std::size_t size, const void* data, const BufferUsage usage, const std::string& label)
+        : mSize(size), mUsage(usage) {
+        if (Caps::Get().directStateAccess) {
+            glCreateBuffers(1, &mID);
+            glNamedBufferData(mID, static_cast<GLsizeiptr>(size), data, ToGL(usage));
+        } else {
+            glGenBuffers(1, &mID);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, mID);
+            glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(size), data, ToGL(usage));
+            glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        }
+        Debug::Label(GL_BUFFER, mID, label.empty() ? "Buffer" : label);
+    }
+
+    Buffer::~Buffer() {
+        if (mID) {
+            glDeleteBuffers(1, &mID);
+            mID = 0;
+        }
+    }
+
+    Buffer::Buffer(Buffer&& other) noexcept
+        : mID(std::exchange(other.mID, 0)), mSize(std::exchange(other.mSize, 0)), mUsage(other.mUsage) {}
+
+    Buffer& Buffer::operator=(Buffer&& other) noexcept {
+        if (this != &other) {
+            if (mID) glDeleteBuffers(1, &mID);
+            mID = std::exchange(other.mID, 0);
+            mSize = std::exchange(other.mSize, 0);
+            mUsage = other.mUsage;
+        }
+        return *this;
+    }
+
+    void Buffer::SetData(const std::size_t size, const void* data) {
+        mSize = size;
+        if (Caps::Get().directStateAccess) {
+            glNamedBufferData(mID, static_cast<GLsizeiptr>(size), data, ToGL(mUsage));
+            return;
+        }
+        glBindBuffer(GL_COPY_WRITE_BUFFER, mID);
+        glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(size), data, ToGL(mUsage));
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+
+    void Buffer::Update(const std::size_t offset, const std::size_t size, const void* data) const {
+        if (Caps::Get().directStateAccess) {
+            glNamedBufferSubData(mID, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
+            return;
+        }
+        glBindBuffer(GL_COPY_WRITE_BUFFER, mID);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+
+    void Buffer::CopyTo(const Buffer& destination, const std::size_t sourceOffset, const std::size_t destinationOffset,
+                        const std::size_t size) const {
+        if (Caps::Get().directStateAccess) {
+            glCopyNamedBufferSubData(mID, destination.mID, static_cast<GLintptr>(sourceOffset),
+                                     static_cast<GLintptr>(destinationOffset), static_cast<GLsizeiptr>(size));
+            return;
+        }
+        glBindBuffer(GL_COPY_READ_BUFFER, mID);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, destination.mID);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(sourceOffset),
+                            static_cast<GLintptr>(destinationOffset), static_cast<GLsizeiptr>(size));
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+
+}
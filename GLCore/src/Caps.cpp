@@ -0,0 +1,65 @@
+//
+// Created by niek on 11/9/2025.
+//
+
+#include "GLCore/Caps.h"
+
+#include "glad/glad.h"
+#include <GLFW/glfw3.h>
+
+namespace GLCore {
+
+    namespace {
+        Caps sCaps;
+
+        std::string GetString(const GLenum name) {
+            const auto* str = reinterpret_cast<const char*>(glGetString(name));
+            return str ? str : "";
+        }
+
+        int GetInt(const GLenum name) {
+            GLint value = 0;
+            glGetIntegerv(name, &value);
+            return value;
+        }
+    }
+
+    const Caps& Caps::Get() { return sCaps; }
+
+    void Caps::Load() {
+        Caps caps;
+        caps.major = GetInt(GL_MAJOR_VERSION);
+        caps.minor = GetInt(GL_MINOR_VERSION);
+        caps.vendor = GetString(GL_VENDOR);
+        caps.renderer = GetString(GL_RENDERER);
+        caps.version = GetString(GL_VERSION);
+
+        // glad loads entry points per core version, so gate on those rather than on extension strings
+        caps.directStateAccess = GLAD_GL_VERSION_4_5 && glad_glCreateBuffers && glad_glNamedBufferStorage;
+        caps.bufferStorage = GLAD_GL_VERSION_4_4 && glad_glBufferStorage;
+        caps.multiDrawIndirect = GLAD_GL_VERSION_4_3 && glad_glMultiDrawElementsIndirect;
+        caps.shaderStorageBuffers = GLAD_GL_VERSION_4_3 && glad_glShaderStorageBlockBinding;
+        caps.copyImage = GLAD_GL_VERSION_4_3 && glad_glCopyImageSubData;
+        caps.debugOutput = GLAD_GL_VERSION_4_3 || glfwExtensionSupported("GL_KHR_debug");
+        caps.baseInstance = GLAD_GL_VERSION_4_2 && glad_glDrawElementsInstancedBaseVertexBaseInstance;
+        caps.textureStorage = GLAD_GL_VERSION_4_2 && glad_glTexStorage2D;
+        caps.separateShaderObjects = GLAD_GL_VERSION_4_1 && glad_glProgramUniform1i;
+        caps.shaderDrawParameters = GLAD_GL_VERSION_4_6 || glfwExtensionSupported("GL_ARB_shader_draw_parameters");
+
+        caps.textureCompressionS3TC = glfwExtensionSupported("GL_EXT_texture_compression_s3tc");
+        caps.textureCompressionBPTC = GLAD_GL_VERSION_4_2 || glfwExtensionSupported("GL_ARB_texture_compression_bptc");
+        caps.anisotropicFiltering = GLAD_GL_VERSION_4_6 || glfwExtensionSupported("GL_EXT_texture_filter_anisotropic")
+                                    || glfwExtensionSupported("GL_ARB_texture_filter_anisotropic");
+
+        caps.maxTextureSize = GetInt(GL_MAX_TEXTURE_SIZE);
+        caps.maxArrayTextureLayers = GetInt(GL_MAX_ARRAY_TEXTURE_LAYERS);
+        caps.maxVertexAttribs = GetInt(GL_MAX_VERTEX_ATTRIBS);
+        caps.maxUniformBlockSize = GetInt(GL_MAX_UNIFORM_BLOCK_SIZE);
+        caps.maxTextureImageUnits = GetInt(GL_MAX_TEXTURE_IMAGE_UNITS);
+        if (caps.shaderStorageBuffers) caps.storageBufferOffsetAlignment = GetInt(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT);
+        if (caps.anisotropicFiltering) glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY, &caps.maxAnisotropy);
+
+        sCaps = std::move(caps);
+    }
+
+}
@@ -0,0 +1,206 @@
+//
+// Created by niek on 11/20/2025.
+//
+
+#include "GLCore/CookedMesh.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace GLCore {
+
+    namespace {
+        constexpr std::size_t kCullArrays = 8;
+
+        std::size_t AlignUp(const std::size_t value) {
+            return (value + CookedMeshHeader::kAlignment - 1) & ~(CookedMeshHeader::kAlignment - 1);
+        }
+
+        /** @brief Accumulates the file image: header placeholder first, then each section on an aligned offset. */
+        class Writer {
+        public:
+            Writer() : mBytes(sizeof(CookedMeshHeader)) {}
+
+            void Add(CookedMeshHeader& header, const CookedSection section, const void* data, const std::size_t size) {
+                const std::size_t offset = AlignUp(mBytes.size());
+                mBytes.resize(offset + size);
+                if (size) std::memcpy(mBytes.data() + offset, data, size);
+                header.sections[static_cast<std::size_t>(section)] = {offset, size};
+            }
+
+            template<class T>
+            void Add(CookedMeshHeader& header, const CookedSection section, const std::vector<T>& values) {
+                Add(header, section, values.data(), values.size() * sizeof(T));
+            }
+
+            void Save(const CookedMeshHeader& header, const std::string& path) {
+                std::memcpy(mBytes.data(), &header, sizeof(header));
+                std::ofstream file(path, std::ios::binary);
+                if (!file.write(reinterpret_cast<const char*>(mBytes.data()), static_cast<std::streamsize>(mBytes.size())))
+                    throw std::runtime_error("ERROR::COOKED_MESH::FILE_NOT_WRITABLE: " + path);
+            }
+
+        private:
+            std::vector<std::byte> mBytes;
+        };
+    }
+
+    void CookMesh(const MeshData& source, const std::string& path, const CookSettings& settings) {
+        MeshData mesh = source;
+        std::vector<MeshLod> lods = LodsFromGroups(mesh);
+        if (lods.empty() && settings.maxLods > 1 && !mesh.indices.empty()) {
+            // GenerateLods replaces the groups; the original ones still describe LOD 0
+            const std::vector<MeshGroup> groups = mesh.groups;
+            lods = GenerateLods(mesh, LodSettings{.maxLods = settings.maxLods});
+            mesh.groups = groups;
+        }
+
+        CookedMeshHeader header;
+        header.headerSize = sizeof(CookedMeshHeader);
+        header.vertexCount = static_cast<std::uint32_t>(mesh.vertices.size());
+        header.indexCount = static_cast<std::uint32_t>(mesh.indices.size());
+        header.groupCount = static_cast<std::uint32_t>(mesh.groups.size());
+        header.lodCount = static_cast<std::uint32_t>(lods.size());
+
+        if (!mesh.vertices.empty()) header.boundsMin = header.boundsMax = mesh.vertices[0].position;
+        for (const MeshVertex& v : mesh.vertices) {
+            header.boundsMin = glm::min(header.boundsMin, v.position);
+            header.boundsMax = glm::max(header.boundsMax, v.position);
+        }
+        header.bounds.center = (header.boundsMin + header.boundsMax) * 0.5f;
+        for (const MeshVertex& v : mesh.vertices)
+            header.bounds.radius = std::max(header.bounds.radius, glm::length(v.position - header.bounds.center));
+
+        MeshletMesh meshlets;
+        if (settings.meshlets && !mesh.indices.empty()) {
+            const std::span<const std::uint32_t> lod0(mesh.indices.data(), lods.empty() ? mesh.indices.size() : lods[0].indexCount);
+            meshlets = BuildMeshlets(lod0, mesh.vertices.data(), header.vertexCount, sizeof(MeshVertex), settings.meshletSettings);
+            header.meshletCount = static_cast<std::uint32_t>(meshlets.meshlets.size());
+            header.meshletIndexCount = static_cast<std::uint32_t>(meshlets.indices.size());
+            header.meshletCullStride = static_cast<std::uint32_t>(meshlets.cullData.centerX.size());
+        }
+
+        Writer writer;
+        if (settings.packVertices) {
+            const PackedMesh packed = VertexPacking::PackMesh(mesh);
+            header.vertexFormat = CookedVertexFormat::Packed;
+            header.vertexStride = sizeof(PackedMeshVertex);
+            header.position = packed.position;
+            header.uv = packed.uv;
+            writer.Add(header, CookedSection::Vertices, packed.vertices);
+        } else {
+            header.vertexFormat = CookedVertexFormat::Full;
+            header.vertexStride = sizeof(MeshVertex);
+            writer.Add(header, CookedSection::Vertices, mesh.vertices);
+        }
+        writer.Add(header, CookedSection::Indices, mesh.indices);
+
+        std::vector<CookedGroup> groups;
+        std::string names;
+        for (const MeshGroup& group : mesh.groups) {
+            groups.push_back({group.firstIndex, group.indexCount, static_cast<std::uint32_t>(names.size()),
+                              static_cast<std::uint32_t>(group.name.size())});
+            names += group.name;
+        }
+        writer.Add(header, CookedSection::Groups, groups);
+        writer.Add(header, CookedSection::GroupNames, names.data(), names.size());
+        writer.Add(header, CookedSection::Lods, lods);
+        writer.Add(header, CookedSection::Meshlets, meshlets.meshlets);
+        writer.Add(header, CookedSection::MeshletIndices, meshlets.indices);
+
+        const MeshletCullData& cull = meshlets.cullData;
+        std::vector<float> cullArrays;
+        cullArrays.reserve(kCullArrays * header.meshletCullStride);
+        for (const std::vector<float>* array : {&cull.centerX, &cull.centerY, &cull.centerZ, &cull.radius,
+                                                &cull.axisX, &cull.axisY, &cull.axisZ, &cull.cutoff})
+            cullArrays.insert(cullArrays.end(), array->begin(), array->end());
+        writer.Add(header, CookedSection::MeshletCull, cullArrays);
+
+        writer.Save(header, path);
+    }
+
+    CookedMesh::CookedMesh(const std::string& path) {
+        try {
+            mFile = MappedFile(path);
+        } catch (const std::runtime_error&) {
+            throw std::runtime_error("ERROR::COOKED_MESH::FILE_NOT_FOUND: " + path);
+        }
+        const auto fail = [&path](const char* what) { return std::runtime_error(std::string("ERROR::COOKED_MESH::") + what + ": " + path); };
+
+        if (mFile.Size() < sizeof(CookedMeshHeader)) throw fail("TRUNCATED");
+        mHeader = reinterpret_cast<const CookedMeshHeader*>(mFile.Data());
+        const CookedMeshHeader& header = *mHeader;
+        if (header.magic != CookedMeshHeader::kMagic) throw fail("INVALID_MAGIC");
+        if (header.version != CookedMeshHeader::kVersion || header.headerSize != sizeof(CookedMeshHeader))
+            throw fail("UNSUPPORTED_VERSION");
+
+        const bool packed = header.vertexFormat == CookedVertexFormat::Packed;
+        if ((!packed && header.vertexFormat != CookedVertexFormat::Full)
+            || header.vertexStride != (packed ? sizeof(PackedMeshVertex) : sizeof(MeshVertex)))
+            throw fail("INVALID_VERTEX_FORMAT");
+        if (header.meshletCullStride % 4 != 0 || header.meshletCullStride < header.meshletCount
+            || header.meshletCullStride >= header.meshletCount + 4)
+            throw fail("INVALID_MESHLETS");
+
+        // Every section: aligned, inside the file, exactly the size its count implies
+        const std::uint64_t expected[static_cast<std::size_t>(CookedSection::Count)] = {
+            std::uint64_t{header.vertexCount} * header.vertexStride,
+            std::uint64_t{header.indexCount} * sizeof(std::uint32_t),
+            std::uint64_t{header.groupCount} * sizeof(CookedGroup),
+            header.sections[static_cast<std::size_t>(CookedSection::GroupNames)].size,
+            std::uint64_t{header.lodCount} * sizeof(MeshLod),
+            std::uint64_t{header.meshletCount} * sizeof(Meshlet),
+            std::uint64_t{header.meshletIndexCount} * sizeof(std::uint32_t),
+            std::uint64_t{header.meshletCullStride} * kCullArrays * sizeof(float),
+        };
+        for (std::size_t s = 0; s < static_cast<std::size_t>(CookedSection::Count); ++s) {
+            const CookedMeshHeader::Section& section = header.sections[s];
+            if (section.offset % CookedMeshHeader::kAlignment != 0 || section.offset > mFile.Size()
+                || section.size > mFile.Size() - section.offset)
+                throw fail("SECTION_OUT_OF_RANGE");
+            if (section.size != expected[s]) throw fail("SECTION_SIZE_MISMATCH");
+        }
+
+        // Ranges into other sections (small tables; the index data itself is not scanned)
+        const std::uint64_t nameBytes = header.sections[static_cast<std::size_t>(CookedSection::GroupNames)].size;
+        for (const CookedGroup& group : Groups())
+            if (std::uint64_t{group.firstIndex} + group.indexCount > header.indexCount
+                || std::uint64_t{group.nameOffset} + group.nameLength > nameBytes)
+                throw fail("INVALID_GROUP");
+        for (const MeshLod& lod : Lods())
+            if (std::uint64_t{lod.firstIndex} + lod.indexCount > header.indexCount) throw fail("INVALID_LOD");
+        for (const Meshlet& meshlet : Meshlets())
+            if (std::uint64_t{meshlet.firstIndex} + meshlet.indexCount > header.meshletIndexCount) throw fail("INVALID_MESHLETS");
+    }
+
+    VertexFormat CookedMesh::Format() const {
+        return mHeader->vertexFormat == CookedVertexFormat::Packed ? VertexFormat::Of<PackedMeshVertex>() : VertexFormat::Of<MeshVertex>();
+    }
+
+    std::string_view CookedMesh::GroupName(const std::size_t group) const {
+        const CookedGroup& record = Groups()[group];
+        const std::span<const char> names = View<char>(CookedSection::GroupNames);
+        return {names.data() + record.nameOffset, record.nameLength};
+    }
+
+    MeshletMesh CookedMesh::ToMeshletMesh() const {
+        MeshletMesh mesh;
+        const std::span<const Meshlet> meshlets = Meshlets();
+        const std::span<const std::uint32_t> indices = MeshletIndices();
+        mesh.meshlets.assign(meshlets.begin(), meshlets.end());
+        mesh.indices.assign(indices.begin(), indices.end());
+        mesh.bounds = mHeader->bounds;
+
+        const std::span<const float> cull = View<float>(CookedSection::MeshletCull);
+        const std::size_t stride = mHeader->meshletCullStride;
+        std::vector<float>* arrays[kCullArrays] = {&mesh.cullData.centerX, &mesh.cullData.centerY, &mesh.cullData.centerZ,
+                                                   &mesh.cullData.radius, &mesh.cullData.axisX, &mesh.cullData.axisY,
+                                                   &mesh.cullData.axisZ, &mesh.cullData.cutoff};
+        for (std::size_t a = 0; a < kCullArrays; ++a)
+            arrays[a]->assign(cull.begin() + static_cast<std::ptrdiff_t>(a * stride),
+                              cull.begin() + static_cast<std::ptrdiff_t>((a + 1) * stride));
+        return mesh;
+    }
+
+}
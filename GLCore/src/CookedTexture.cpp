@@ -0,0 +1,176 @@
+//
+// Created by niek on 11/23/2025.
+//
+
+#include "GLCore/CookedTexture.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace GLCore {
+
+    namespace {
+        std::size_t AlignUp(const std::size_t value) {
+            return (value + CookedTextureHeader::kAlignment - 1) & ~(CookedTextureHeader::kAlignment - 1);
+        }
+
+        bool ValidFormat(const CookedTextureFormat format) {
+            return static_cast<std::uint32_t>(format) <= static_cast<std::uint32_t>(CookedTextureFormat::BC7_SRGB);
+        }
+
+        std::optional<BlockFormat> Compression(const CookedTextureFormat format) {
+            switch (format) {
+                case CookedTextureFormat::BC1:
+                case CookedTextureFormat::BC1_SRGB: return BlockFormat::BC1;
+                case CookedTextureFormat::BC3:
+                case CookedTextureFormat::BC3_SRGB: return BlockFormat::BC3;
+                case CookedTextureFormat::BC4: return BlockFormat::BC4;
+                case CookedTextureFormat::BC5: return BlockFormat::BC5;
+                case CookedTextureFormat::BC7:
+                case CookedTextureFormat::BC7_SRGB: return BlockFormat::BC7;
+                default: return std::nullopt;
+            }
+        }
+
+        CookedTextureFormat CookedFormat(const BlockFormat format, const bool srgb) {
+            switch (format) {
+                case BlockFormat::BC1: return srgb ? CookedTextureFormat::BC1_SRGB : CookedTextureFormat::BC1;
+                case BlockFormat::BC3: return srgb ? CookedTextureFormat::BC3_SRGB : CookedTextureFormat::BC3;
+                case BlockFormat::BC4: return CookedTextureFormat::BC4;
+                case BlockFormat::BC5: return CookedTextureFormat::BC5;
+                default: return srgb ? CookedTextureFormat::BC7_SRGB : CookedTextureFormat::BC7;
+            }
+        }
+
+        std::uint64_t LevelBytes(const CookedTextureFormat format, const std::uint32_t width, const std::uint32_t height, const int level) {
+            const int w = static_cast<int>(std::max(1u, width >> level)), h = static_cast<int>(std::max(1u, height >> level));
+            if (const std::optional<BlockFormat> blocks = Compression(format)) return CompressedBytes(*blocks, w, h);
+            return static_cast<std::uint64_t>(w) * h * static_cast<std::uint64_t>(CookedTexture::Channels(format));
+        }
+    }
+
+    void CookTexture(const std::span<const Image> levels, const std::string& path, const TextureCookSettings& settings, ThreadPool& pool) {
+        const auto fail = [&path](const char* what) { return std::runtime_error(std::string("ERROR::COOKED_TEXTURE::") + what + ": " + path); };
+        if (levels.empty() || levels.size() > CookedTextureHeader::kMaxLevels) throw fail("INVALID_LEVEL_COUNT");
+
+        const Image& base = levels[0];
+        CookedTextureHeader header;
+        header.headerSize = sizeof(CookedTextureHeader);
+        header.width = static_cast<std::uint32_t>(base.width);
+        header.height = static_cast<std::uint32_t>(base.height);
+        header.levelCount = static_cast<std::uint32_t>(levels.size());
+        header.flags = base.channels <= 2 ? CookedTextureHeader::kGreyscale : 0;
+        switch (base.channels) {
+            case 1: header.format = CookedTextureFormat::R8; break;
+            case 2: header.format = CookedTextureFormat::RG8; break;
+            case 4: header.format = settings.srgb ? CookedTextureFormat::SRGB8_ALPHA8 : CookedTextureFormat::RGBA8; break;
+            default: throw fail("UNSUPPORTED_CHANNELS");
+        }
+        if (settings.compression) header.format = CookedFormat(*settings.compression, settings.srgb);
+        if (base.width <= 0 || base.height <= 0) throw fail("INVALID_IMAGE");
+
+        std::vector<std::byte> bytes(sizeof(CookedTextureHeader));
+        for (std::size_t i = 0; i < levels.size(); ++i) {
+            const Image& level = levels[i];
+            if (level.channels != base.channels || level.width != std::max(base.width >> i, 1) || level.height != std::max(base.height >> i, 1)
+                || level.pixels.size() != static_cast<std::size_t>(level.width) * level.height * level.channels)
+                throw fail("INVALID_MIP_CHAIN");
+
+            std::vector<std::uint8_t> blocks;
+            std::span<const std::uint8_t> data = level.pixels;
+            if (settings.compression) {
+                blocks = CompressImage(level, *settings.compression, settings.quality, pool);
+                data = blocks;
+            }
+            const std::size_t offset = AlignUp(bytes.size());
+            bytes.resize(offset + data.size());
+            std::memcpy(bytes.data() + offset, data.data(), data.size());
+            header.levels[i] = {offset, data.size()};
+        }
+        std::memcpy(bytes.data(), &header, sizeof(header));
+
+        std::ofstream file(path, std::ios::binary);
+        if (!file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size())))
+            throw fail("FILE_NOT_WRITABLE");
+    }
+
+    CookedTexture::CookedTexture(const std::string& path) {
+        try {
+            mFile = MappedFile(path);
+        } catch (const std::runtime_error&) {
+            throw std::runtime_error("ERROR::COOKED_TEXTURE::FILE_NOT_FOUND: " + path);
+        }
+        const auto fail = [&path](const char* what) { return std::runtime_error(std::string("ERROR::COOKED_TEXTURE::") + what + ": " + path); };
+
+        if (mFile.Size() < sizeof(CookedTextureHeader)) throw fail("TRUNCATED");
+        mHeader = reinterpret_cast<const CookedTextureHeader*>(mFile.Data());
+        const CookedTextureHeader& header = *mHeader;
+        if (header.magic != CookedTextureHeader::kMagic) throw fail("INVALID_MAGIC");
+        if (header.version != CookedTextureHeader::kVersion || header.headerSize != sizeof(CookedTextureHeader))
+            throw fail("UNSUPPORTED_VERSION");
+        if (!ValidFormat(header.format)) throw fail("INVALID_FORMAT");
+        if (header.width == 0 || header.height == 0 || header.levelCount == 0 || header.levelCount > CookedTextureHeader::kMaxLevels
+            || header.levelCount > static_cast<std::uint32_t>(std::bit_width(std::max(header.width, header.height))))
+            throw fail("INVALID_SIZE");
+
+        for (std::uint32_t i = 0; i < header.levelCount; ++i) {
+            const CookedTextureHeader::Level& level = header.levels[i];
+            if (level.offset % CookedTextureHeader::kAlignment != 0 || level.offset > mFile.Size()
+                || level.size > mFile.Size() - level.offset)
+                throw fail("LEVEL_OUT_OF_RANGE");
+            if (level.size != LevelBytes(header.format, header.width, header.height, static_cast<int>(i)))
+                throw fail("LEVEL_SIZE_MISMATCH");
+        }
+    }
+
+    int CookedTexture::Channels(const CookedTextureFormat format) {
+        switch (format) {
+            case CookedTextureFormat::R8:
+            case CookedTextureFormat::BC4: return 1;
+            case CookedTextureFormat::RG8:
+            case CookedTextureFormat::BC5: return 2;
+            default: return 4;
+        }
+    }
+
+    std::optional<BlockFormat> CookedTexture::Compression() const {
+        return GLCore::Compression(mHeader->format);
+    }
+
+    int CookedTexture::Channels() const {
+        return Channels(mHeader->format);
+    }
+
+    GLenum CookedTexture::InternalFormat() const {
+        switch (mHeader->format) {
+            case CookedTextureFormat::R8: return GL_R8;
+            case CookedTextureFormat::RG8: return GL_RG8;
+            case CookedTextureFormat::RGBA8: return GL_RGBA8;
+            case CookedTextureFormat::SRGB8_ALPHA8: return GL_SRGB8_ALPHA8;
+            default: {
+                const CookedTextureFormat format = mHeader->format;
+                const bool srgb = format == CookedTextureFormat::BC1_SRGB || format == CookedTextureFormat::BC3_SRGB
+                                  || format == CookedTextureFormat::BC7_SRGB;
+                return BlockInternalFormat(*Compression(), srgb);
+            }
+        }
+    }
+
+    GLenum CookedTexture::ClientFormat() const {
+        switch (mHeader->format) {
+            case CookedTextureFormat::R8: return GL_RED;
+            case CookedTextureFormat::RG8: return GL_RG;
+            default: return GL_RGBA;
+        }
+    }
+
+    std::span<const std::byte> CookedTexture::Level(const int level) const {
+        const CookedTextureHeader::Level& range = mHeader->levels[level];
+        return {mFile.Data() + range.offset, static_cast<std::size_t>(range.size)};
+    }
+
+}
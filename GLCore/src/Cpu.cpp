@@ -0,0 +1,49 @@
+//
+// Created by niek on 11/23/2025.
+//
+
+#include "GLCore/Cpu.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace GLCore {
+
+    namespace {
+        SimdLevel Detect() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return SimdLevel::AVX2;
+            if (__builtin_cpu_supports("sse2")) return SimdLevel::SSE2;
+            return SimdLevel::Scalar;
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+            int info[4];
+            __cpuid(info, 1);
+            const bool fma = info[2] & (1 << 12);
+            const bool osSavesYmm = (info[2] & (1 << 27)) && (_xgetbv(0) & 6) == 6;   // OSXSAVE, XMM + YMM state
+            const bool sse2 = info[3] & (1 << 26);
+            __cpuidex(info, 7, 0);
+            if (fma && osSavesYmm && (info[1] & (1 << 5))) return SimdLevel::AVX2;
+            return sse2 ? SimdLevel::SSE2 : SimdLevel::Scalar;
+#else
+            return SimdLevel::Scalar;
+#endif
+        }
+    }
+
+    SimdLevel DetectSimdLevel() {
+        static const SimdLevel level = Detect();
+        return level;
+    }
+
+    const char* ToString(const SimdLevel level) {
+        switch (level) {
+            case SimdLevel::SSE2: return "SSE2";
+            case SimdLevel::AVX2: return "AVX2";
+            default: return "scalar";
+        }
+    }
+
+}
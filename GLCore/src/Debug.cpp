@@ -0,0 +1,122 @@
+//
+// Created by niek on 11/8/2025.
+//
+
+#include "GLCore/Debug.h"
+
+#include <GLFW/glfw3.h>
+
+#include <cstdint>
+#include <iostream>
+#include <unordered_set>
+
+namespace GLCore::Debug {
+
+    namespace {
+
+        struct State {
+            const void* context = nullptr;   // the context the callback was installed on
+            MessageCounters frame{};
+            MessageCounters lastFrame{};
+            MessageCounters total{};
+            std::unordered_set<std::uint64_t> seen;
+        };
+
+        State& GetState() {
+            static State state;
+            return state;
+        }
+
+        const char* TypeName(const GLenum type) {
+            switch (type) {
+                case GL_DEBUG_TYPE_ERROR: return "ERROR";
+                case GL_DEBUG_TYPE_PERFORMANCE: return "PERFORMANCE";
+                case GL_DEBUG_TYPE_PORTABILITY: return "PORTABILITY";
+                case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "DEPRECATED";
+                case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR: return "UNDEFINED_BEHAVIOR";
+                default: return "OTHER";
+            }
+        }
+
+        void Count(MessageCounters& counters, const GLenum type) {
+            switch (type) {
+                case GL_DEBUG_TYPE_ERROR: ++counters.errors; break;
+                case GL_DEBUG_TYPE_PERFORMANCE: ++counters.performance; break;
+                case GL_DEBUG_TYPE_PORTABILITY: ++counters.portability; break;
+                case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: ++counters.deprecated; break;
+                case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR: ++counters.undefinedBehavior; break;
+                default: ++counters.other; break;
+            }
+        }
+
+        void APIENTRY OnDebugMessage(const GLenum source, const GLenum type, const GLuint id, const GLenum severity,
+                                     GLsizei, const GLchar* message, const void*) {
+            State& state = GetState();
+            Count(state.frame, type);
+            Count(state.total, type);
+
+            // Deduplicate by (source, type, id); drivers repeat the same warning every frame
+            const std::uint64_t key = static_cast<std::uint64_t>(id) << 32 | (source & 0xFFFFu) << 16 | (type & 0xFFFFu);
+            if (!state.seen.insert(key).second) return;
+
+            const char* level = severity == GL_DEBUG_SEVERITY_HIGH ? "HIGH" : severity == GL_DEBUG_SEVERITY_MEDIUM ? "MEDIUM" : "LOW";
+            std::cerr << "GL::DEBUG::" << TypeName(type) << "::" << level << " (" << id << "): " << message << std::endl;
+        }
+
+        // A 3.3 context can still expose KHR_debug; glad only loads the entry points for 4.3+
+        bool LoadEntryPoints() {
+            if (glad_glDebugMessageCallback && glad_glDebugMessageControl && glad_glObjectLabel) return true;
+            if (!glfwExtensionSupported("GL_KHR_debug")) return false;
+
+            glad_glDebugMessageCallback = reinterpret_cast<PFNGLDEBUGMESSAGECALLBACKPROC>(glfwGetProcAddress("glDebugMessageCallback"));
+            glad_glDebugMessageControl = reinterpret_cast<PFNGLDEBUGMESSAGECONTROLPROC>(glfwGetProcAddress("glDebugMessageControl"));
+            glad_glObjectLabel = reinterpret_cast<PFNGLOBJECTLABELPROC>(glfwGetProcAddress("glObjectLabel"));
+            return glad_glDebugMessageCallback && glad_glDebugMessageControl;
+        }
+
+    }
+
+    bool Enable() {
+        State& state = GetState();
+        const void* context = glfwGetCurrentContext();
+        if (state.context && state.context == context) return true;
+        if (!LoadEntryPoints()) {
+            std::cerr << "ERROR::DEBUG::KHR_DEBUG_UNAVAILABLE" << std::endl;
+            return false;
+        }
+
+        glEnable(GL_DEBUG_OUTPUT);
+        glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+        glDebugMessageCallback(OnDebugMessage, nullptr);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr, GL_TRUE);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);
+        state.context = context;
+        return true;
+    }
+
+    bool IsEnabled() {
+        const State& state = GetState();
+        return state.context && state.context == glfwGetCurrentContext();
+    }
+
+    void OnContextDestroyed(const void* context) {
+        State& state = GetState();
+        if (state.context == context) state.context = nullptr;
+    }
+
+    void EndFrame() {
+        State& state = GetState();
+        state.lastFrame = state.frame;
+        state.frame = {};
+    }
+
+    MessageCounters GetFrameCounters() { return GetState().lastFrame; }
+    MessageCounters GetTotalCounters() { return GetState().total; }
+    std::size_t GetUniqueMessageCount() { return GetState().seen.size(); }
+
+    void Label(const GLenum identifier, const unsigned int name, const std::string& label) {
+        if (!glad_glObjectLabel || name == 0) return;
+        glObjectLabel(identifier, name, static_cast<GLsizei>(label.size()), label.c_str());
+    }
+
+}
@@ -0,0 +1,27 @@
+//
+// Created by niek on 11/14/2025.
+//
+
+#include "GLCore/Frustum.h"
+
+namespace GLCore {
+
+    Frustum::Frustum(const glm::mat4& viewProjection) {
+        // Gribb/Hartmann: each plane is row 3 +/- row i of the matrix (GLM is column-major)
+        const auto row = [&viewProjection](const int i) {
+            return glm::vec4(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]);
+        };
+        const glm::vec4 r0 = row(0), r1 = row(1), r2 = row(2), r3 = row(3);
+        mPlanes = {r3 + r0, r3 - r0, r3 + r1, r3 - r1, r3 + r2, r3 - r2};
+
+        for (glm::vec4& plane : mPlanes)
+            plane /= glm::length(glm::vec3(plane));
+    }
+
+    bool Frustum::Intersects(const BoundingSphere& sphere) const {
+        for (const glm::vec4& plane : mPlanes)
+            if (glm::dot(glm::vec3(plane), sphere.center) + plane.w < -sphere.radius) return false;
+        return true;
+    }
+
+}
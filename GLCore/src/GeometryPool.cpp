@@ -0,0 +1,174 @@
+//
+// Created by niek on 11/12/2025.
+//
+
+#include "GLCore/GeometryPool.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+namespace GLCore {
+
+    GeometryPool::GeometryPool(const VertexFormat& format, const std::uint32_t vertexCapacity,
+                               const std::uint32_t indexCapacity, const std::string& label)
+        : mFormat(format),
+          mLabel(label.empty() ? "GeometryPool" : label),
+          mVertices(static_cast<std::size_t>(vertexCapacity) * format.stride, nullptr, BufferUsage::Static, mLabel + " vertices"),
+          mIndices(static_cast<std::size_t>(indexCapacity) * sizeof(std::uint32_t), nullptr, BufferUsage::Static, mLabel + " indices"),
+          mVertexArray(mLabel + " VAO"),
+          mVertexAllocator(vertexCapacity),
+          mIndexAllocator(indexCapacity) {
+        AttachBuffers();
+    }
+
+    void GeometryPool::AttachBuffers() {
+        mVertexArray.SetVertexBuffer(0, mVertices, mFormat);
+        mVertexArray.SetIndexBuffer(mIndices, GL_UNSIGNED_INT);
+    }
+
+    MeshHandle GeometryPool::Add(const void* vertices, const std::uint32_t vertexCount,
+                                 const std::uint32_t* indices, const std::uint32_t indexCount) {
+        if (vertexCount == 0 || indexCount == 0) return {};
+
+        OffsetAllocator::Allocation vertexAllocation = mVertexAllocator.Allocate(vertexCount);
+        OffsetAllocator::Allocation indexAllocation = mIndexAllocator.Allocate(indexCount);
+        if (!vertexAllocation.Valid() || !indexAllocation.Valid()) {
+            mVertexAllocator.Free(vertexAllocation);
+            mIndexAllocator.Free(indexAllocation);
+
+            // Grow geometrically; the rebuild also packs the live meshes
+            const std::uint32_t vertexCapacity = std::max(mVertexAllocator.Capacity() * 2, mVerticesUsed + vertexCount);
+            const std::uint32_t indexCapacity = std::max(mIndexAllocator.Capacity() * 2, mIndicesUsed + indexCount);
+            Rebuild(vertexCapacity, indexCapacity);
+            ++mGrowCount;
+
+            vertexAllocation = mVertexAllocator.Allocate(vertexCount);
+            indexAllocation = mIndexAllocator.Allocate(indexCount);
+            if (!vertexAllocation.Valid() || !indexAllocation.Valid())
+                throw std::runtime_error("GeometryPool: allocation failed after growth");
+        }
+
+        mVertices.Update(static_cast<std::size_t>(vertexAllocation.offset) * mFormat.stride,
+                         static_cast<std::size_t>(vertexCount) * mFormat.stride, vertices);
+        mIndices.Update(static_cast<std::size_t>(indexAllocation.offset) * sizeof(std::uint32_t),
+                        static_cast<std::size_t>(indexCount) * sizeof(std::uint32_t), indices);
+
+        std::uint32_t id;
+        if (!mFreeSlots.empty()) {
+            id = mFreeSlots.back();
+            mFreeSlots.pop_back();
+        } else {
+            id = static_cast<std::uint32_t>(mSlots.size());
+            mSlots.emplace_back();
+        }
+
+        Slot& slot = mSlots[id];
+        slot.range = {static_cast<std::int32_t>(vertexAllocation.offset), vertexCount, indexAllocation.offset, indexCount};
+        slot.vertexAllocation = vertexAllocation;
+        slot.indexAllocation = indexAllocation;
+        slot.live = true;
+        mVerticesUsed += vertexCount;
+        mIndicesUsed += indexCount;
+        return {id};
+    }
+
+    void GeometryPool::Remove(const MeshHandle mesh) {
+        if (!mesh.Valid() || mesh.id >= mSlots.size() || !mSlots[mesh.id].live) return;
+
+        Slot& slot = mSlots[mesh.id];
+        mVertexAllocator.Free(slot.vertexAllocation);
+        mIndexAllocator.Free(slot.indexAllocation);
+        mVerticesUsed -= slot.range.vertexCount;
+        mIndicesUsed -= slot.range.indexCount;
+        slot = Slot{};
+        mFreeSlots.push_back(mesh.id);
+    }
+
+    const MeshRange& GeometryPool::GetRange(const MeshHandle mesh) const {
+        return mSlots.at(mesh.id).range;
+    }
+
+    void GeometryPool::Defragment() {
+        Rebuild(mVertexAllocator.Capacity(), mIndexAllocator.Capacity());
+        ++mDefragmentCount;
+    }
+
+    void GeometryPool::Rebuild(const std::uint32_t vertexCapacity, const std::uint32_t indexCapacity) {
+        // Keep the current vertex order so neighbouring meshes stay neighbours
+        std::vector<std::uint32_t> order;
+        order.reserve(mSlots.size());
+        for (std::uint32_t i = 0; i < mSlots.size(); ++i)
+            if (mSlots[i].live) order.push_back(i);
+        std::ranges::sort(order, {}, [this](const std::uint32_t i) { return mSlots[i].range.baseVertex; });
+
+        // Place every mesh before touching anything, so a failure leaves the pool as it was
+        OffsetAllocator vertexAllocator(vertexCapacity);
+        OffsetAllocator indexAllocator(indexCapacity);
+        std::vector<std::pair<OffsetAllocator::Allocation, OffsetAllocator::Allocation>> allocations;
+        allocations.reserve(order.size());
+        for (const std::uint32_t i : order) {
+            const OffsetAllocator::Allocation vertexAllocation = vertexAllocator.Allocate(mSlots[i].range.vertexCount);
+            const OffsetAllocator::Allocation indexAllocation = indexAllocator.Allocate(mSlots[i].range.indexCount);
+            if (!vertexAllocation.Valid() || !indexAllocation.Valid())
+                throw std::runtime_error("GeometryPool: live meshes do not fit the rebuilt buffers");
+            allocations.emplace_back(vertexAllocation, indexAllocation);
+        }
+
+        Buffer vertices(static_cast<std::size_t>(vertexCapacity) * mFormat.stride, nullptr, BufferUsage::Static, mLabel + " vertices");
+        Buffer indices(static_cast<std::size_t>(indexCapacity) * sizeof(std::uint32_t), nullptr, BufferUsage::Static, mLabel + " indices");
+        for (std::size_t n = 0; n < order.size(); ++n) {
+            Slot& slot = mSlots[order[n]];
+            const auto [vertexAllocation, indexAllocation] = allocations[n];
+
+            mVertices.CopyTo(vertices,
+                             static_cast<std::size_t>(slot.range.baseVertex) * mFormat.stride,
+                             static_cast<std::size_t>(vertexAllocation.offset) * mFormat.stride,
+                             static_cast<std::size_t>(slot.range.vertexCount) * mFormat.stride);
+            mIndices.CopyTo(indices,
+                            static_cast<std::size_t>(slot.range.firstIndex) * sizeof(std::uint32_t),
+                            static_cast<std::size_t>(indexAllocation.offset) * sizeof(std::uint32_t),
+                            static_cast<std::size_t>(slot.range.indexCount) * sizeof(std::uint32_t));
+
+            slot.range.baseVertex = static_cast<std::int32_t>(vertexAllocation.offset);
+            slot.range.firstIndex = indexAllocation.offset;
+            slot.vertexAllocation = vertexAllocation;
+            slot.indexAllocation = indexAllocation;
+        }
+
+        mVertexAllocator = std::move(vertexAllocator);
+        mIndexAllocator = std::move(indexAllocator);
+        mVertices = std::move(vertices);
+        mIndices = std::move(indices);
+        AttachBuffers();
+    }
+
+    void GeometryPool::Bind() const {
+        mVertexArray.Bind();
+    }
+
+    void GeometryPool::Draw(const MeshHandle mesh, const GLenum mode) const {
+        const MeshRange& range = GetRange(mesh);
+        glDrawElementsBaseVertex(mode, static_cast<GLsizei>(range.indexCount), GL_UNSIGNED_INT,
+                                 reinterpret_cast<const void*>(static_cast<std::uintptr_t>(range.firstIndex) * sizeof(std::uint32_t)),
+                                 range.baseVertex);
+    }
+
+    GeometryPool::Stats GeometryPool::GetStats() const {
+        Stats stats{};
+        stats.meshes = static_cast<std::uint32_t>(mSlots.size() - mFreeSlots.size());
+        stats.vertexCapacity = mVertexAllocator.Capacity();
+        stats.verticesUsed = mVerticesUsed;
+        stats.indexCapacity = mIndexAllocator.Capacity();
+        stats.indicesUsed = mIndicesUsed;
+        stats.growCount = mGrowCount;
+        stats.defragmentCount = mDefragmentCount;
+
+        const OffsetAllocator::StorageReport report = mVertexAllocator.GetStorageReport();
+        if (report.totalFree > 0)
+            stats.fragmentation = 1.0f - static_cast<float>(report.largestFree) / static_cast<float>(report.totalFree);
+        return stats;
+    }
+
+}
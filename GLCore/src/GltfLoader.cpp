@@ -0,0 +1,500 @@
+//
+// Created by niek on 11/18/2025.
+//
+
+#include "GLCore/GltfLoader.h"
+#include "GLCore/MappedFile.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <nholann/json.hpp>
+#include <gtc/matrix_transform.hpp>
+#include <gtc/quaternion.hpp>
+#include <gtc/type_ptr.hpp>
+
+namespace GLCore {
+
+    namespace {
+        using Json = nlohmann::json;
+        using Clock = std::chrono::steady_clock;
+
+        constexpr std::uint32_t kGlbMagic = 0x46546C67;     // "glTF"
+        constexpr std::uint32_t kGlbChunkJson = 0x4E4F534A; // "JSON"
+        constexpr std::uint32_t kGlbChunkBin = 0x004E4942;  // "BIN\0"
+        constexpr std::uint32_t kSliceElements = 65536;
+
+        enum ComponentType : int {
+            kByte = 5120, kUnsignedByte = 5121, kShort = 5122, kUnsignedShort = 5123, kUnsignedInt = 5125, kFloat = 5126
+        };
+        constexpr int kModeTriangles = 4;
+
+        std::runtime_error Error(const std::string& what, const std::string& detail) {
+            return std::runtime_error("ERROR::GLTF::" + what + ": " + detail);
+        }
+
+        float Elapsed(const Clock::time_point start) {
+            return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+        }
+
+        std::uint32_t ReadU32(const std::byte* bytes) {
+            std::uint32_t value;
+            std::memcpy(&value, bytes, sizeof(value));
+            return value;
+        }
+
+        std::string PercentDecode(const std::string_view uri) {
+            std::string decoded;
+            decoded.reserve(uri.size());
+            for (std::size_t i = 0; i < uri.size(); ++i) {
+                if (uri[i] == '%' && i + 2 < uri.size()) {
+                    decoded.push_back(static_cast<char>(std::stoi(std::string(uri.substr(i + 1, 2)), nullptr, 16)));
+                    i += 2;
+                } else {
+                    decoded.push_back(uri[i]);
+                }
+            }
+            return decoded;
+        }
+
+        std::vector<std::byte> DecodeBase64(const std::string_view text) {
+            const auto value = [](const char c) -> int {
+                if (c >= 'A' && c <= 'Z') return c - 'A';
+                if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+                if (c >= '0' && c <= '9') return c - '0' + 52;
+                if (c == '+' || c == '-') return 62;
+                if (c == '/' || c == '_') return 63;
+                return -1;
+            };
+
+            std::vector<std::byte> bytes;
+            bytes.reserve(text.size() / 4 * 3);
+            std::uint32_t accumulator = 0;
+            int bits = 0;
+            for (const char c : text) {
+                const int v = value(c);
+                if (v < 0) continue;   // padding, whitespace
+                accumulator = (accumulator << 6) | static_cast<std::uint32_t>(v);
+                bits += 6;
+                if (bits >= 8) {
+                    bits -= 8;
+                    bytes.push_back(static_cast<std::byte>((accumulator >> bits) & 0xFFu));
+                }
+            }
+            return bytes;
+        }
+
+        int ComponentCount(const std::string& type) {
+            if (type == "SCALAR") return 1;
+            if (type == "VEC2") return 2;
+            if (type == "VEC3") return 3;
+            if (type == "VEC4") return 4;
+            if (type == "MAT4") return 16;
+            return 0;
+        }
+
+        std::size_t ComponentSize(const int componentType) {
+            switch (componentType) {
+                case kByte: case kUnsignedByte: return 1;
+                case kShort: case kUnsignedShort: return 2;
+                case kUnsignedInt: case kFloat: return 4;
+                default: return 0;
+            }
+        }
+
+        /** @brief A resolved accessor: where element i starts is data + i * stride; data is null for all-zero accessors. */
+        struct Accessor {
+            const std::byte* data = nullptr;
+            std::size_t stride = 0;
+            std::uint32_t count = 0;
+            int componentType = kFloat;
+            int components = 0;
+            bool normalized = false;
+        };
+
+        Accessor ResolveAccessor(const Json& document, const std::vector<std::span<const std::byte>>& buffers,
+                                 const std::size_t index, const std::string& path) {
+            const Json& accessors = document.at("accessors");
+            if (index >= accessors.size()) throw Error("BAD_ACCESSOR", path + " accessor " + std::to_string(index));
+            const Json& json = accessors[index];
+            if (json.contains("sparse")) throw Error("UNSUPPORTED", path + " sparse accessor " + std::to_string(index));
+
+            Accessor accessor;
+            accessor.count = json.at("count").get<std::uint32_t>();
+            accessor.componentType = json.at("componentType").get<int>();
+            accessor.components = ComponentCount(json.at("type").get<std::string>());
+            accessor.normalized = json.value("normalized", false);
+            const std::size_t elementSize = ComponentSize(accessor.componentType) * static_cast<std::size_t>(accessor.components);
+            if (elementSize == 0) throw Error("BAD_ACCESSOR", path + " accessor " + std::to_string(index));
+            if (!json.contains("bufferView")) return accessor;
+
+            const Json& view = document.at("bufferViews").at(json.at("bufferView").get<std::size_t>());
+            const std::size_t buffer = view.at("buffer").get<std::size_t>();
+            if (buffer >= buffers.size()) throw Error("BAD_BUFFER", path + " buffer " + std::to_string(buffer));
+            const std::size_t viewOffset = view.value("byteOffset", std::size_t{0});
+            const std::size_t viewLength = view.at("byteLength").get<std::size_t>();
+            const std::size_t offset = json.value("byteOffset", std::size_t{0});
+            accessor.stride = view.value("byteStride", elementSize);
+
+            const std::size_t needed = accessor.count == 0 ? 0 : offset + accessor.stride * (accessor.count - 1) + elementSize;
+            if (viewOffset + viewLength > buffers[buffer].size() || needed > viewLength)
+                throw Error("BAD_ACCESSOR", path + " accessor " + std::to_string(index) + " reads past its buffer");
+            accessor.data = buffers[buffer].data() + viewOffset + offset;
+            return accessor;
+        }
+
+        float ReadComponent(const std::byte* element, const int componentType, const bool normalized, const int component) {
+            switch (componentType) {
+                case kFloat: {
+                    float v;
+                    std::memcpy(&v, element + component * 4, 4);
+                    return v;
+                }
+                case kUnsignedByte: {
+                    const auto v = static_cast<float>(std::to_integer<std::uint8_t>(element[component]));
+                    return normalized ? v / 255.0f : v;
+                }
+                case kByte: {
+                    const auto v = static_cast<float>(static_cast<std::int8_t>(std::to_integer<std::uint8_t>(element[component])));
+                    return normalized ? std::max(v / 127.0f, -1.0f) : v;
+                }
+                case kUnsignedShort: {
+                    std::uint16_t v;
+                    std::memcpy(&v, element + component * 2, 2);
+                    return normalized ? static_cast<float>(v) / 65535.0f : static_cast<float>(v);
+                }
+                case kShort: {
+                    std::int16_t v;
+                    std::memcpy(&v, element + component * 2, 2);
+                    return normalized ? std::max(static_cast<float>(v) / 32767.0f, -1.0f) : static_cast<float>(v);
+                }
+                default:
+                    return 0.0f;
+            }
+        }
+
+        // Writes N floats per element into a float member of each destination vertex
+        template<int N>
+        void DecodeAttribute(const Accessor& accessor, const std::uint32_t begin, const std::uint32_t end,
+                             MeshVertex* vertices, const std::size_t memberOffset) {
+            if (!accessor.data) return;   // zero-initialized already
+            auto* destination = reinterpret_cast<std::byte*>(vertices) + memberOffset;
+            const int components = std::min(N, accessor.components);
+
+            if (accessor.componentType == kFloat && components == N) {
+                for (std::uint32_t i = begin; i < end; ++i)
+                    std::memcpy(destination + i * sizeof(MeshVertex), accessor.data + i * accessor.stride, N * sizeof(float));
+                return;
+            }
+            for (std::uint32_t i = begin; i < end; ++i) {
+                float values[N] = {};
+                const std::byte* element = accessor.data + i * accessor.stride;
+                for (int c = 0; c < components; ++c)
+                    values[c] = ReadComponent(element, accessor.componentType, accessor.normalized, c);
+                std::memcpy(destination + i * sizeof(MeshVertex), values, sizeof(values));
+            }
+        }
+
+        void DecodeIndices(const Accessor& accessor, const std::uint32_t begin, const std::uint32_t end,
+                           std::uint32_t* indices, const std::uint32_t firstVertex) {
+            switch (accessor.componentType) {
+                case kUnsignedByte:
+                    for (std::uint32_t i = begin; i < end; ++i)
+                        indices[i] = firstVertex + std::to_integer<std::uint32_t>(accessor.data[i * accessor.stride]);
+                    break;
+                case kUnsignedShort:
+                    for (std::uint32_t i = begin; i < end; ++i) {
+                        std::uint16_t v;
+                        std::memcpy(&v, accessor.data + i * accessor.stride, sizeof(v));
+                        indices[i] = firstVertex + v;
+                    }
+                    break;
+                default:
+                    for (std::uint32_t i = begin; i < end; ++i) {
+                        std::uint32_t v;
+                        std::memcpy(&v, accessor.data + i * accessor.stride, sizeof(v));
+                        indices[i] = firstVertex + v;
+                    }
+                    break;
+            }
+        }
+
+        glm::mat4 LocalTransform(const Json& node) {
+            if (node.contains("matrix")) {
+                const std::vector<float> m = node["matrix"].get<std::vector<float>>();
+                if (m.size() == 16) return glm::make_mat4(m.data());
+            }
+            glm::mat4 transform(1.0f);
+            if (node.contains("translation")) {
+                const std::vector<float> t = node["translation"].get<std::vector<float>>();
+                transform = glm::translate(transform, glm::vec3(t.at(0), t.at(1), t.at(2)));
+            }
+            if (node.contains("rotation")) {
+                const std::vector<float> r = node["rotation"].get<std::vector<float>>();
+                transform *= glm::mat4_cast(glm::quat(r.at(3), r.at(0), r.at(1), r.at(2)));
+            }
+            if (node.contains("scale")) {
+                const std::vector<float> s = node["scale"].get<std::vector<float>>();
+                transform = glm::scale(transform, glm::vec3(s.at(0), s.at(1), s.at(2)));
+            }
+            return transform;
+        }
+
+        struct DecodeJob {
+            enum class Kind { Position, Normal, TexCoord, Indices, Sequential } kind;
+            std::uint32_t primitive;
+            Accessor accessor;
+            std::uint32_t begin;
+            std::uint32_t end;
+        };
+    }
+
+    GltfModel LoadGltf(const std::string& path, ThreadPool& pool) {
+        const auto start = Clock::now();
+        const std::filesystem::path filePath(path);
+        const std::filesystem::path directory = filePath.parent_path();
+
+        GltfModel model;
+        const MappedFile file(filePath);
+
+        // GLB: 12-byte header, then a JSON chunk and an optional BIN chunk; anything else is plain JSON
+        std::string_view jsonText = file.Text();
+        std::span<const std::byte> glbBinary;
+        if (file.Size() >= 12 && ReadU32(file.Data()) == kGlbMagic) {
+            const std::size_t length = std::min<std::size_t>(ReadU32(file.Data() + 8), file.Size());
+            jsonText = {};
+            for (std::size_t offset = 12; offset + 8 <= length;) {
+                const std::uint32_t chunkLength = ReadU32(file.Data() + offset);
+                const std::uint32_t chunkType = ReadU32(file.Data() + offset + 4);
+                if (offset + 8 + chunkLength > length) throw Error("BAD_GLB", path + " truncated chunk");
+                if (chunkType == kGlbChunkJson)
+                    jsonText = {reinterpret_cast<const char*>(file.Data() + offset + 8), chunkLength};
+                else if (chunkType == kGlbChunkBin && glbBinary.empty())
+                    glbBinary = file.Bytes().subspan(offset + 8, chunkLength);
+                offset += 8 + ((chunkLength + 3u) & ~3u);
+            }
+            if (jsonText.empty()) throw Error("BAD_GLB", path + " has no JSON chunk");
+        }
+
+        const auto parseStart = Clock::now();
+        Json document;
+        try {
+            document = Json::parse(jsonText.begin(), jsonText.end());
+        } catch (const Json::exception& e) {
+            throw Error("PARSE_FAILED", path + ": " + e.what());
+        }
+        model.stats.bytes = jsonText.size();
+
+        // Buffers stay mapped (or decoded, for data URIs) until every accessor has been read
+        std::vector<MappedFile> mappedBuffers;
+        std::vector<std::vector<std::byte>> embeddedBuffers;
+        std::vector<std::span<const std::byte>> buffers;
+        for (const Json& buffer : document.value("buffers", Json::array())) {
+            std::span<const std::byte> bytes;
+            if (!buffer.contains("uri")) {
+                bytes = glbBinary;
+            } else {
+                const std::string uri = buffer["uri"].get<std::string>();
+                if (uri.starts_with("data:")) {
+                    const std::size_t comma = uri.find(',');
+                    if (comma == std::string::npos || uri.find(";base64") > comma)
+                        throw Error("UNSUPPORTED", path + " non-base64 data URI");
+                    bytes = embeddedBuffers.emplace_back(DecodeBase64(std::string_view(uri).substr(comma + 1)));
+                } else {
+                    bytes = mappedBuffers.emplace_back(directory / PercentDecode(uri)).Bytes();
+                }
+            }
+            const std::size_t byteLength = buffer.at("byteLength").get<std::size_t>();
+            if (bytes.size() < byteLength) throw Error("BAD_BUFFER", path + " buffer shorter than its byteLength");
+            buffers.push_back(bytes.first(byteLength));
+            model.stats.bytes += byteLength;
+        }
+
+        // Lay out every triangle primitive back to back and queue its accessors in slices
+        std::vector<DecodeJob> jobs;
+        const auto queue = [&jobs](const DecodeJob::Kind kind, const std::uint32_t primitive, const Accessor& accessor,
+                                   const std::uint32_t count) {
+            for (std::uint32_t begin = 0; begin < count; begin += kSliceElements)
+                jobs.push_back({kind, primitive, accessor, begin, std::min(count, begin + kSliceElements)});
+        };
+
+        std::uint32_t vertexTotal = 0, indexTotal = 0;
+        const Json meshes = document.value("meshes", Json::array());
+        for (std::size_t m = 0; m < meshes.size(); ++m) {
+            GltfMesh& mesh = model.meshes.emplace_back();
+            mesh.name = meshes[m].value("name", "mesh" + std::to_string(m));
+            mesh.firstPrimitive = static_cast<std::uint32_t>(model.primitives.size());
+
+            for (const Json& json : meshes[m].value("primitives", Json::array())) {
+                if (json.value("mode", kModeTriangles) != kModeTriangles) continue;
+                const Json& attributes = json.at("attributes");
+                if (!attributes.contains("POSITION")) continue;
+
+                const auto primitiveIndex = static_cast<std::uint32_t>(model.primitives.size());
+                const Accessor position = ResolveAccessor(document, buffers, attributes["POSITION"].get<std::size_t>(), path);
+                GltfPrimitive& primitive = model.primitives.emplace_back();
+                primitive.mesh = static_cast<std::uint32_t>(m);
+                primitive.material = json.value("material", -1);
+                primitive.firstVertex = vertexTotal;
+                primitive.vertexCount = position.count;
+                queue(DecodeJob::Kind::Position, primitiveIndex, position, position.count);
+                ++model.stats.accessors;
+
+                const Json& positionJson = document["accessors"][attributes["POSITION"].get<std::size_t>()];
+                if (positionJson.contains("min") && positionJson.contains("max")) {
+                    const std::vector<float> lo = positionJson["min"].get<std::vector<float>>();
+                    const std::vector<float> hi = positionJson["max"].get<std::vector<float>>();
+                    if (lo.size() >= 3 && hi.size() >= 3) {
+                        primitive.boundsMin = {lo[0], lo[1], lo[2]};
+                        primitive.boundsMax = {hi[0], hi[1], hi[2]};
+                    }
+                }
+
+                for (const auto& [name, kind] : {std::pair{"NORMAL", DecodeJob::Kind::Normal},
+                                                 std::pair{"TEXCOORD_0", DecodeJob::Kind::TexCoord}}) {
+                    if (!attributes.contains(name)) continue;
+                    const Accessor accessor = ResolveAccessor(document, buffers, attributes[name].get<std::size_t>(), path);
+                    if (accessor.count != position.count) throw Error("BAD_ACCESSOR", path + " " + name + " count mismatch");
+                    queue(kind, primitiveIndex, accessor, accessor.count);
+                    ++model.stats.accessors;
+                }
+
+                primitive.firstIndex = indexTotal;
+                if (json.contains("indices")) {
+                    const Accessor indices = ResolveAccessor(document, buffers, json["indices"].get<std::size_t>(), path);
+                    if (indices.components != 1 || indices.componentType == kFloat || indices.componentType == kByte
+                        || indices.componentType == kShort)
+                        throw Error("BAD_ACCESSOR", path + " index accessor is not unsigned scalar");
+                    if (!indices.data) throw Error("BAD_ACCESSOR", path + " index accessor without buffer view");
+                    primitive.indexCount = indices.count;
+                    queue(DecodeJob::Kind::Indices, primitiveIndex, indices, indices.count);
+                    ++model.stats.accessors;
+                } else {
+                    primitive.indexCount = position.count;
+                    queue(DecodeJob::Kind::Sequential, primitiveIndex, Accessor{}, position.count);
+                }
+                primitive.indexCount -= primitive.indexCount % 3;
+
+                if (vertexTotal > std::numeric_limits<std::uint32_t>::max() - primitive.vertexCount
+                    || indexTotal > std::numeric_limits<std::uint32_t>::max() - primitive.indexCount)
+                    throw Error("TOO_LARGE", path);
+                vertexTotal += primitive.vertexCount;
+                indexTotal += primitive.indexCount;
+                model.geometry.groups.push_back({mesh.name + "/" + std::to_string(primitiveIndex - mesh.firstPrimitive),
+                                                 primitive.firstIndex, primitive.indexCount});
+            }
+            mesh.primitiveCount = static_cast<std::uint32_t>(model.primitives.size()) - mesh.firstPrimitive;
+        }
+        model.stats.parseMs = Elapsed(parseStart);
+
+        // Every job owns a disjoint slice of the output, so workers write without locks
+        const auto decodeStart = Clock::now();
+        model.geometry.vertices.resize(vertexTotal);
+        model.geometry.indices.resize(indexTotal);
+        MeshVertex* vertices = model.geometry.vertices.data();
+        std::uint32_t* indices = model.geometry.indices.data();
+        pool.ParallelFor(jobs.size(), [&](const std::size_t j) {
+            const DecodeJob& job = jobs[j];
+            const GltfPrimitive& primitive = model.primitives[job.primitive];
+            MeshVertex* primitiveVertices = vertices + primitive.firstVertex;
+            std::uint32_t* primitiveIndices = indices + primitive.firstIndex;
+            const std::uint32_t indexEnd = std::min(job.end, primitive.indexCount);
+
+            switch (job.kind) {
+                case DecodeJob::Kind::Position:
+                    DecodeAttribute<3>(job.accessor, job.begin, job.end, primitiveVertices, offsetof(MeshVertex, position));
+                    break;
+                case DecodeJob::Kind::Normal:
+                    DecodeAttribute<3>(job.accessor, job.begin, job.end, primitiveVertices, offsetof(MeshVertex, normal));
+                    break;
+                case DecodeJob::Kind::TexCoord:
+                    DecodeAttribute<2>(job.accessor, job.begin, job.end, primitiveVertices, offsetof(MeshVertex, uv));
+                    break;
+                case DecodeJob::Kind::Indices:
+                    if (job.begin >= indexEnd) break;
+                    DecodeIndices(job.accessor, job.begin, indexEnd, primitiveIndices, primitive.firstVertex);
+                    // Reject out-of-range indices rather than hand the GPU a buffer overrun
+                    for (std::uint32_t i = job.begin; i < indexEnd; ++i)
+                        if (primitiveIndices[i] - primitive.firstVertex >= primitive.vertexCount)
+                            throw Error("BAD_ACCESSOR", path + " index out of range");
+                    break;
+                case DecodeJob::Kind::Sequential:
+                    for (std::uint32_t i = job.begin; i < indexEnd; ++i) primitiveIndices[i] = primitive.firstVertex + i;
+                    break;
+            }
+        });
+        model.stats.jobs = static_cast<std::uint32_t>(jobs.size());
+        model.stats.threads = pool.ThreadCount() + 1;
+        model.stats.decodeMs = Elapsed(decodeStart);
+
+        // Bounds for primitives whose POSITION accessor had no min/max
+        for (GltfPrimitive& primitive : model.primitives) {
+            if (primitive.boundsMin != glm::vec3(0.0f) || primitive.boundsMax != glm::vec3(0.0f) || primitive.vertexCount == 0)
+                continue;
+            primitive.boundsMin = primitive.boundsMax = vertices[primitive.firstVertex].position;
+            for (std::uint32_t v = 1; v < primitive.vertexCount; ++v) {
+                primitive.boundsMin = glm::min(primitive.boundsMin, vertices[primitive.firstVertex + v].position);
+                primitive.boundsMax = glm::max(primitive.boundsMax, vertices[primitive.firstVertex + v].position);
+            }
+        }
+
+        for (const Json& json : document.value("materials", Json::array())) {
+            GltfMaterial& material = model.materials.emplace_back();
+            material.name = json.value("name", std::string{});
+            const Json pbr = json.value("pbrMetallicRoughness", Json::object());
+            if (pbr.contains("baseColorFactor")) {
+                const std::vector<float> factor = pbr["baseColorFactor"].get<std::vector<float>>();
+                if (factor.size() == 4) material.baseColorFactor = {factor[0], factor[1], factor[2], factor[3]};
+            }
+            if (pbr.contains("baseColorTexture")) {
+                const Json& texture = document.at("textures").at(pbr["baseColorTexture"].at("index").get<std::size_t>());
+                if (texture.contains("source")) {
+                    const Json& image = document.at("images").at(texture["source"].get<std::size_t>());
+                    const std::string uri = image.value("uri", std::string{});
+                    if (!uri.empty() && !uri.starts_with("data:"))
+                        material.baseColorTexture = (directory / PercentDecode(uri)).string();
+                }
+            }
+        }
+
+        // Flatten the default scene (or every root node when there are no scenes) with world transforms
+        const Json nodes = document.value("nodes", Json::array());
+        std::vector<std::pair<std::size_t, glm::mat4>> stack;
+        const Json scenes = document.value("scenes", Json::array());
+        if (!scenes.empty()) {
+            const Json& scene = scenes.at(document.value("scene", std::size_t{0}));
+            for (const Json& root : scene.value("nodes", Json::array())) stack.emplace_back(root.get<std::size_t>(), glm::mat4(1.0f));
+        } else {
+            std::vector<bool> isChild(nodes.size(), false);
+            for (const Json& node : nodes)
+                for (const Json& child : node.value("children", Json::array())) isChild.at(child.get<std::size_t>()) = true;
+            for (std::size_t n = nodes.size(); n-- > 0;)
+                if (!isChild[n]) stack.emplace_back(n, glm::mat4(1.0f));
+        }
+        std::size_t visited = 0;
+        while (!stack.empty()) {
+            const auto [index, parent] = stack.back();
+            stack.pop_back();
+            if (index >= nodes.size() || ++visited > nodes.size()) throw Error("BAD_NODE", path);
+
+            const Json& json = nodes[index];
+            GltfNode& node = model.nodes.emplace_back();
+            node.name = json.value("name", std::string{});
+            node.world = parent * LocalTransform(json);
+            node.mesh = json.value("mesh", -1);
+            for (const Json& child : json.value("children", Json::array())) stack.emplace_back(child.get<std::size_t>(), node.world);
+        }
+
+        model.stats.totalMs = Elapsed(start);
+        model.stats.megabytesPerSecond = model.stats.totalMs > 0.0f
+            ? static_cast<float>(static_cast<double>(model.stats.bytes) / (1024.0 * 1024.0) / (model.stats.totalMs / 1000.0))
+            : 0.0f;
+        return model;
+    }
+
+}
@@ -0,0 +1,51 @@
+//
+// Created by niek on 11/23/2025.
+//
+
+#include "GLCore/Image.h"
+#include "GLCore/MappedFile.h"
+#include "GLCore/Qoi.h"
+
+#include "stb_image.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+namespace GLCore {
+
+    Image LoadImageFile(const std::string& path, const bool flipVertically) {
+        MappedFile file;
+        try {
+            file = MappedFile(path);
+        } catch (const std::runtime_error&) {
+            throw std::runtime_error("ERROR::IMAGE::FILE_NOT_FOUND: " + path);
+        }
+        return DecodeImage(file.Bytes(), flipVertically, path);
+    }
+
+    Image DecodeImage(const std::span<const std::byte> encoded, const bool flipVertically, const std::string& name) {
+        if (IsQoi(encoded)) return DecodeQoi(encoded, flipVertically, name);
+
+        const auto* data = reinterpret_cast<const stbi_uc*>(encoded.data());
+        const int length = static_cast<int>(std::min<std::size_t>(encoded.size(), INT_MAX));
+
+        Image image;
+        if (!stbi_info_from_memory(data, length, &image.width, &image.height, &image.channels))
+            throw std::runtime_error("ERROR::IMAGE::DECODE_FAILED: " + name + " (" + stbi_failure_reason() + ")");
+        const int wanted = image.channels <= 2 ? image.channels : 4;
+
+        stbi_set_flip_vertically_on_load_thread(flipVertically ? 1 : 0);
+        const std::unique_ptr<stbi_uc, void (*)(void*)> pixels(
+            stbi_load_from_memory(data, length, &image.width, &image.height, &image.channels, wanted), stbi_image_free);
+        if (!pixels) throw std::runtime_error("ERROR::IMAGE::DECODE_FAILED: " + name + " (" + stbi_failure_reason() + ")");
+
+        image.channels = wanted;
+        image.pixels.resize(static_cast<std::size_t>(image.width) * image.height * wanted);
+        std::memcpy(image.pixels.data(), pixels.get(), image.pixels.size());
+        return image;
+    }
+
+}
@@ -0,0 +1,176 @@
+//
+// Created by niek on 11/14/2025.
+//
+
+#include "GLCore/IndirectDrawList.h"
+#include "GLCore/Caps.h"
+
+#include <chrono>
+#include <cstring>
+#include <numeric>
+#include <utility>
+
+namespace GLCore {
+
+    namespace {
+        constexpr std::size_t kCommandAlignment = 4;
+
+        bool UseIndirect() {
+            return Caps::Get().multiDrawIndirect && Caps::Get().shaderStorageBuffers;
+        }
+
+        std::size_t StreamSize(const std::size_t drawDataSize, const std::uint32_t maxDraws) {
+            // Commands and data share one region. Slack: up to 3 bytes to align the commands to 4 (all
+            // glMultiDrawElementsIndirect needs) and up to alignment - 1 to align the data block for glBindBufferRange
+            if (!UseIndirect()) return 256;
+            return static_cast<std::size_t>(maxDraws) * (sizeof(DrawElementsIndirectCommand) + drawDataSize)
+                   + static_cast<std::size_t>(Caps::Get().storageBufferOffsetAlignment) + kCommandAlignment;
+        }
+
+        std::vector<std::uint32_t> Iota(const std::uint32_t count) {
+            std::vector<std::uint32_t> ids(count);
+            std::iota(ids.begin(), ids.end(), 0u);
+            return ids;
+        }
+    }
+
+    IndirectDrawList::IndirectDrawList(const std::size_t drawDataSize, const std::uint32_t maxDrawsPerFrame,
+                                       const unsigned int dataBinding, const std::string& label)
+        : mDrawDataSize(drawDataSize),
+          mMaxDraws(maxDrawsPerFrame),
+          mDataBinding(dataBinding),
+          mIndirect(UseIndirect()),
+          mStream(StreamSize(drawDataSize, maxDrawsPerFrame), 3, StreamStrategy::Auto,
+                  (label.empty() ? "IndirectDrawList" : label) + " commands"),
+          mDrawIDs(mIndirect ? maxDrawsPerFrame * sizeof(std::uint32_t) : sizeof(std::uint32_t),
+                   mIndirect ? Iota(maxDrawsPerFrame).data() : nullptr, BufferUsage::Static,
+                   (label.empty() ? "IndirectDrawList" : label) + " draw IDs") {}
+
+    void IndirectDrawList::AttachDrawID(VertexArray& vertexArray, const unsigned int location, const unsigned int binding) const {
+        if (!mIndirect) return;
+        vertexArray.SetVertexBuffer(binding, mDrawIDs, VertexFormat::Of<DrawID>(), location, 0, 1);
+    }
+
+    void IndirectDrawList::BeginFrame() {
+        mStats = {};
+        for (Bucket& bucket : mBuckets) {
+            bucket.commands.clear();
+            bucket.data.clear();
+        }
+        if (mIndirect) mStream.BeginFrame();
+    }
+
+    void IndirectDrawList::Begin(const Frustum& frustum) {
+        BeginFrame();
+        mFrustum = frustum;
+        mCull = true;
+    }
+
+    void IndirectDrawList::Begin() {
+        BeginFrame();
+        mCull = false;
+    }
+
+    bool IndirectDrawList::Add(const std::uint32_t bucket, const MeshRange& range, const BoundingSphere& bounds,
+                               const void* drawData) {
+        ++mStats.candidates;
+        if (mCull && !mFrustum.Intersects(bounds)) {
+            ++mStats.culled;
+            return false;
+        }
+        if (mStats.draws >= mMaxDraws) {
+            ++mStats.dropped;
+            return false;
+        }
+
+        if (bucket >= mBuckets.size()) mBuckets.resize(bucket + 1);
+        Bucket& target = mBuckets[bucket];
+        target.commands.push_back({range.indexCount, 1, range.firstIndex, range.baseVertex, 0});
+        if (drawData) {
+            const auto* bytes = static_cast<const std::byte*>(drawData);
+            target.data.insert(target.data.end(), bytes, bytes + mDrawDataSize);
+        } else {
+            target.data.resize(target.data.size() + mDrawDataSize);   // zero-filled
+        }
+        ++mStats.draws;
+        return true;
+    }
+
+    bool IndirectDrawList::Add(const std::uint32_t bucket, const MeshRange& range, const void* drawData) {
+        const bool cull = std::exchange(mCull, false);
+        const bool added = Add(bucket, range, BoundingSphere{}, drawData);
+        mCull = cull;
+        return added;
+    }
+
+    void IndirectDrawList::Upload() {
+        const auto start = std::chrono::steady_clock::now();
+
+        // Buckets are laid out back to back, so a command's global index is its draw ID
+        std::uint32_t draw = 0;
+        for (Bucket& bucket : mBuckets) {
+            bucket.firstDraw = draw;
+            draw += static_cast<std::uint32_t>(bucket.commands.size());
+            if (!bucket.commands.empty()) ++mStats.buckets;
+        }
+
+        if (mIndirect && draw > 0) {
+            const StreamAllocation commands = mStream.Allocate(draw * sizeof(DrawElementsIndirectCommand), kCommandAlignment);
+            const StreamAllocation data = mStream.Allocate(draw * mDrawDataSize,
+                                                           static_cast<std::size_t>(Caps::Get().storageBufferOffsetAlignment));
+            if (commands && data) {
+                auto* command = static_cast<DrawElementsIndirectCommand*>(commands.data);
+                auto* bytes = static_cast<std::byte*>(data.data);
+                for (const Bucket& bucket : mBuckets) {
+                    for (std::uint32_t i = 0; i < bucket.commands.size(); ++i) {
+                        *command = bucket.commands[i];
+                        command->baseInstance = bucket.firstDraw + i;
+                        ++command;
+                    }
+                    if (!bucket.data.empty()) std::memcpy(bytes, bucket.data.data(), bucket.data.size());
+                    bytes += bucket.data.size();
+                }
+                mStream.Flush();
+                mCommandOffset = commands.offset;
+                glBindBufferRange(GL_SHADER_STORAGE_BUFFER, mDataBinding, mStream.ID(),
+                                  static_cast<GLintptr>(data.offset), static_cast<GLsizeiptr>(draw * mDrawDataSize));
+            } else {
+                // Only if Upload() runs more than once a frame (StreamSize() covers one upload of maxDrawsPerFrame);
+                // drop the frame rather than draw stale commands
+                mStats.dropped += draw;
+                for (Bucket& bucket : mBuckets) bucket.commands.clear();
+            }
+        }
+
+        mStats.uploadMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    void IndirectDrawList::Submit(const std::uint32_t bucket, const GLenum mode, const PerDrawCallback& perDraw) {
+        if (bucket >= mBuckets.size() || mBuckets[bucket].commands.empty()) return;
+        const Bucket& source = mBuckets[bucket];
+
+        if (mIndirect) {
+            glBindBuffer(GL_DRAW_INDIRECT_BUFFER, mStream.ID());
+            const std::size_t offset = mCommandOffset + source.firstDraw * sizeof(DrawElementsIndirectCommand);
+            glMultiDrawElementsIndirect(mode, GL_UNSIGNED_INT, reinterpret_cast<const void*>(offset),
+                                        static_cast<GLsizei>(source.commands.size()), 0);
+            glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+            ++mStats.submitCalls;
+            return;
+        }
+
+        for (std::uint32_t i = 0; i < source.commands.size(); ++i) {
+            const DrawElementsIndirectCommand& command = source.commands[i];
+            if (perDraw) perDraw(source.firstDraw + i, source.data.data() + i * mDrawDataSize);
+            glDrawElementsBaseVertex(mode, static_cast<GLsizei>(command.count), GL_UNSIGNED_INT,
+                                     reinterpret_cast<const void*>(static_cast<std::uintptr_t>(command.firstIndex) * sizeof(std::uint32_t)),
+                                     command.baseVertex);
+            ++mStats.submitCalls;
+        }
+    }
+
+    void IndirectDrawList::End() {
+        if (mIndirect) mStream.EndFrame();
+    }
+
+}
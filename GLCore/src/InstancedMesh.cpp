@@ -0,0 +1,97 @@
+//
+// Created by niek on 11/14/2025.
+//
+
+#include "GLCore/InstancedMesh.h"
+#include "GLCore/Caps.h"
+
+namespace GLCore {
+
+    namespace {
+        constexpr std::size_t kTransformSize = sizeof(glm::mat4);
+        constexpr std::size_t kColorSize = sizeof(glm::u8vec4);
+        constexpr std::size_t kLayerSize = sizeof(std::uint32_t);
+        constexpr std::size_t kInstanceSize = kTransformSize + kColorSize + kLayerSize;
+    }
+
+    InstancedMesh::InstancedMesh(const void* vertices, const std::uint32_t vertexCount, const VertexFormat& format,
+                                 const std::uint32_t* indices, const std::uint32_t indexCount,
+                                 const std::uint32_t maxInstancesPerFrame, const std::string& label)
+        : mVertices(static_cast<std::size_t>(vertexCount) * format.stride, vertices, BufferUsage::Static,
+                    (label.empty() ? "InstancedMesh" : label) + " vertices"),
+          mIndices(static_cast<std::size_t>(indexCount) * sizeof(std::uint32_t), indices, BufferUsage::Static,
+                   (label.empty() ? "InstancedMesh" : label) + " indices"),
+          mIndexCount(indexCount),
+          mInstanceLocation(static_cast<std::uint32_t>(format.attributes.size())),
+          mMaxInstances(maxInstancesPerFrame),
+          mStream(static_cast<std::size_t>(maxInstancesPerFrame) * kInstanceSize + kTransformSize, 3,
+                  StreamStrategy::Auto, (label.empty() ? "InstancedMesh" : label) + " instances"),
+          mVertexArray((label.empty() ? "InstancedMesh" : label) + " VAO") {
+        mVertexArray.SetVertexBuffer(0, mVertices, format);
+        mVertexArray.SetIndexBuffer(mIndices, GL_UNSIGNED_INT);
+        mVertexArray.SetVertexFormat(kTransformBinding, VertexFormat::Of<TransformColumns>(), mInstanceLocation, 1);
+        mVertexArray.SetVertexFormat(kColorBinding, VertexFormat::Of<InstanceColor>(), mInstanceLocation + 4, 1);
+        mVertexArray.SetVertexFormat(kLayerBinding, VertexFormat::Of<InstanceLayer>(), mInstanceLocation + 5, 1);
+    }
+
+    void InstancedMesh::BeginFrame() {
+        mStats = {};
+        mCursor = 0;
+        mStream.BeginFrame();
+
+        // One SoA block per frame; each stream starts at a fixed place so baseInstance addresses both
+        const std::size_t blockSize = static_cast<std::size_t>(mMaxInstances) * kInstanceSize;
+        mBlock = mStream.Allocate(blockSize, kTransformSize);
+        mStream.SkipFlush();   // Draw() uploads each range on its own
+        if (mBlock) {
+            mVertexArray.RebindVertexBuffer(kTransformBinding, mStream.ID(), mBlock.offset);
+            mVertexArray.RebindVertexBuffer(kColorBinding, mStream.ID(), mBlock.offset + mMaxInstances * kTransformSize);
+            mVertexArray.RebindVertexBuffer(kLayerBinding, mStream.ID(),
+                                            mBlock.offset + mMaxInstances * (kTransformSize + kColorSize));
+        }
+    }
+
+    void InstancedMesh::EndFrame() {
+        mStream.EndFrame();
+        mBlock = {};
+    }
+
+    InstancedMesh::InstanceRange InstancedMesh::Allocate(const std::uint32_t count) {
+        if (!mBlock || count == 0 || mCursor + count > mMaxInstances) return {};
+
+        auto* transforms = static_cast<glm::mat4*>(mBlock.data);
+        auto* colors = reinterpret_cast<glm::u8vec4*>(static_cast<std::byte*>(mBlock.data) + mMaxInstances * kTransformSize);
+        auto* layers = reinterpret_cast<std::uint32_t*>(static_cast<std::byte*>(mBlock.data) + mMaxInstances * (kTransformSize + kColorSize));
+        InstanceRange range{mCursor, count, {transforms + mCursor, count}, {colors + mCursor, count}, {layers + mCursor, count}};
+        mCursor += count;
+        return range;
+    }
+
+    void InstancedMesh::Draw(const InstanceRange& range, const GLenum mode) {
+        if (range.count == 0) return;
+
+        // The block is allocated up front, so a cursor-based Flush() would publish it whole at the first draw
+        // and miss ranges filled after that: upload this range's slice of all three streams instead
+        const std::size_t colors = mBlock.offset + mMaxInstances * kTransformSize;
+        const std::size_t layers = colors + mMaxInstances * kColorSize;
+        mStream.FlushRange(mBlock.offset + range.first * kTransformSize, range.count * kTransformSize);
+        mStream.FlushRange(colors + range.first * kColorSize, range.count * kColorSize);
+        mStream.FlushRange(layers + range.first * kLayerSize, range.count * kLayerSize);
+        mVertexArray.Bind();
+
+        if (Caps::Get().baseInstance) {
+            glDrawElementsInstancedBaseVertexBaseInstance(mode, static_cast<GLsizei>(mIndexCount), GL_UNSIGNED_INT, nullptr,
+                                                          static_cast<GLsizei>(range.count), 0, range.first);
+        } else {
+            mVertexArray.RebindVertexBuffer(kTransformBinding, mStream.ID(), mBlock.offset + range.first * kTransformSize);
+            mVertexArray.RebindVertexBuffer(kColorBinding, mStream.ID(), colors + range.first * kColorSize);
+            mVertexArray.RebindVertexBuffer(kLayerBinding, mStream.ID(), layers + range.first * kLayerSize);
+            mVertexArray.Bind();
+            glDrawElementsInstanced(mode, static_cast<GLsizei>(mIndexCount), GL_UNSIGNED_INT, nullptr,
+                                    static_cast<GLsizei>(range.count));
+        }
+        mStats.instances += range.count;
+        ++mStats.drawCalls;
+    }
+
+}
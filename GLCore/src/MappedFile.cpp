@@ -0,0 +1,131 @@
+//
+// Created by niek on 11/18/2025.
+//
+
+#include "GLCore/MappedFile.h"
+
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace GLCore {
+
+#ifdef _WIN32
+    MappedFile::MappedFile(const std::filesystem::path& path) {
+        const HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            throw std::runtime_error("ERROR::MAPPED_FILE::OPEN_FAILED: " + path.string());
+        mFile = file;
+        mOpen = true;
+
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file, &size)) {
+            Close();
+            throw std::runtime_error("ERROR::MAPPED_FILE::OPEN_FAILED: " + path.string());
+        }
+        mSize = static_cast<std::size_t>(size.QuadPart);
+        if (mSize == 0) return;
+
+        mMapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        const void* view = mMapping ? MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (!view) {
+            Close();
+            throw std::runtime_error("ERROR::MAPPED_FILE::MAP_FAILED: " + path.string());
+        }
+        mData = static_cast<const std::byte*>(view);
+    }
+
+    void MappedFile::Close() {
+        if (mData) UnmapViewOfFile(mData);
+        if (mMapping) CloseHandle(mMapping);
+        if (mFile) CloseHandle(mFile);
+        mData = nullptr;
+        mMapping = nullptr;
+        mFile = nullptr;
+        mSize = 0;
+        mOpen = false;
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : mData(std::exchange(other.mData, nullptr)), mSize(std::exchange(other.mSize, 0)),
+          mOpen(std::exchange(other.mOpen, false)), mFile(std::exchange(other.mFile, nullptr)),
+          mMapping(std::exchange(other.mMapping, nullptr)) {}
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            Close();
+            mData = std::exchange(other.mData, nullptr);
+            mSize = std::exchange(other.mSize, 0);
+            mOpen = std::exchange(other.mOpen, false);
+            mFile = std::exchange(other.mFile, nullptr);
+            mMapping = std::exchange(other.mMapping, nullptr);
+        }
+        return *this;
+    }
+#else
+    MappedFile::MappedFile(const std::filesystem::path& path) {
+        const int file = open(path.c_str(), O_RDONLY);
+        if (file < 0) throw std::runtime_error("ERROR::MAPPED_FILE::OPEN_FAILED: " + path.string());
+
+        struct stat info{};
+        if (fstat(file, &info) != 0) {
+            close(file);
+            throw std::runtime_error("ERROR::MAPPED_FILE::OPEN_FAILED: " + path.string());
+        }
+        mSize = static_cast<std::size_t>(info.st_size);
+        mOpen = true;
+
+        if (mSize > 0) {
+            void* view = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, file, 0);
+            if (view == MAP_FAILED) {
+                close(file);
+                mSize = 0;
+                mOpen = false;
+                throw std::runtime_error("ERROR::MAPPED_FILE::MAP_FAILED: " + path.string());
+            }
+            madvise(view, mSize, MADV_WILLNEED);
+            mData = static_cast<const std::byte*>(view);
+        }
+        // The mapping keeps its own reference to the file
+        close(file);
+    }
+
+    void MappedFile::Close() {
+        if (mData) munmap(const_cast<std::byte*>(mData), mSize);
+        mData = nullptr;
+        mSize = 0;
+        mOpen = false;
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : mData(std::exchange(other.mData, nullptr)), mSize(std::exchange(other.mSize, 0)),
+          mOpen(std::exchange(other.mOpen, false)) {}
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            Close();
+            mData = std::exchange(other.mData, nullptr);
+            mSize = std::exchange(other.mSize, 0);
+            mOpen = std::exchange(other.mOpen, false);
+        }
+        return *this;
+    }
+#endif
+
+    MappedFile::~MappedFile() {
+        Close();
+    }
+
+}
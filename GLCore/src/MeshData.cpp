@@ -0,0 +1,39 @@
+//
+// Created by niek on 11/15/2025.
+//
+
+#include "GLCore/MeshData.h"
+#include "GLCore/ObjLoader.h"
+
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+namespace GLCore {
+
+    MeshData LoadObj(const std::string& path) {
+        return LoadObj(path, ThreadPool::Shared());
+    }
+
+    void SaveObj(const MeshData& mesh, const std::string& path) {
+        std::ofstream file(path);
+        if (!file) throw std::runtime_error("ERROR::MESH::FILE_NOT_WRITABLE: " + path);
+
+        file.precision(std::numeric_limits<float>::max_digits10);
+        for (const MeshVertex& v : mesh.vertices) file << "v " << v.position.x << ' ' << v.position.y << ' ' << v.position.z << '\n';
+        for (const MeshVertex& v : mesh.vertices) file << "vt " << v.uv.x << ' ' << v.uv.y << '\n';
+        for (const MeshVertex& v : mesh.vertices) file << "vn " << v.normal.x << ' ' << v.normal.y << ' ' << v.normal.z << '\n';
+        std::size_t group = 0;
+        for (std::size_t i = 0; i + 2 < mesh.indices.size(); i += 3) {
+            while (group < mesh.groups.size() && mesh.groups[group].firstIndex <= i) file << "g " << mesh.groups[group++].name << '\n';
+            file << 'f';
+            for (std::size_t c = 0; c < 3; ++c) {
+                const std::uint32_t index = mesh.indices[i + c] + 1;
+                file << ' ' << index << '/' << index << '/' << index;
+            }
+            file << '\n';
+        }
+        if (!file) throw std::runtime_error("ERROR::MESH::WRITE_FAILED: " + path);
+    }
+
+}
@@ -0,0 +1,95 @@
+//
+// Created by niek on 11/16/2025.
+//
+
+#include "GLCore/MeshLod.h"
+#include "GLCore/MeshOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace GLCore {
+
+    std::vector<MeshLod> GenerateLods(MeshData& mesh, const LodSettings& settings) {
+        const auto vertexCount = static_cast<std::uint32_t>(mesh.vertices.size());
+        const std::vector<std::uint32_t> base = mesh.indices;
+
+        glm::vec3 lo(0.0f), hi(0.0f);
+        if (!mesh.vertices.empty()) lo = hi = mesh.vertices[0].position;
+        for (const MeshVertex& v : mesh.vertices) {
+            lo = glm::min(lo, v.position);
+            hi = glm::max(hi, v.position);
+        }
+        const float extent = std::max({hi.x - lo.x, hi.y - lo.y, hi.z - lo.z});
+
+        std::vector<MeshLod> lods{{0, static_cast<std::uint32_t>(base.size()), 0.0f}};
+        std::size_t previousCount = base.size();
+        while (lods.size() < settings.maxLods) {
+            const std::size_t target = static_cast<std::size_t>(static_cast<float>(previousCount) * settings.reduction) / 3 * 3;
+            if (target / 3 < settings.minTriangles) break;
+
+            float error = 0.0f;
+            std::vector<std::uint32_t> lod = MeshOptimizer::Simplify(base, mesh.vertices.data(), vertexCount, sizeof(MeshVertex),
+                                                                      target, settings.maxError, &error);
+            if (lod.size() > previousCount * 9 / 10) break;
+            lod = MeshOptimizer::OptimizeVertexCache(lod, vertexCount);
+
+            lods.push_back({static_cast<std::uint32_t>(mesh.indices.size()), static_cast<std::uint32_t>(lod.size()), error * extent});
+            mesh.indices.insert(mesh.indices.end(), lod.begin(), lod.end());
+            previousCount = lod.size();
+        }
+
+        mesh.groups.clear();
+        for (std::size_t i = 0; i < lods.size(); ++i) {
+            char name[64];
+            std::snprintf(name, sizeof(name), "lod%zu error=%.9g", i, static_cast<double>(lods[i].error));
+            mesh.groups.push_back({name, lods[i].firstIndex, lods[i].indexCount});
+        }
+        return lods;
+    }
+
+    std::vector<MeshLod> LodsFromGroups(const MeshData& mesh) {
+        std::vector<MeshLod> lods;
+        for (const MeshGroup& group : mesh.groups) {
+            if (!group.name.starts_with("lod")) continue;
+            const std::size_t error = group.name.find("error=");
+            lods.push_back({group.firstIndex, group.indexCount,
+                            error == std::string::npos ? 0.0f : std::strtof(group.name.c_str() + error + 6, nullptr)});
+        }
+        return lods;
+    }
+
+    LodSelector::LodSelector(const float pixelThreshold, const float hysteresis)
+        : mPixelThreshold(pixelThreshold), mHysteresis(hysteresis) {}
+
+    void LodSelector::SetProjection(const float fovY, const float viewportHeight) {
+        mPixelsPerUnit = viewportHeight / (2.0f * std::tan(fovY * 0.5f));
+    }
+
+    std::uint32_t LodSelector::Select(const std::span<const MeshLod> lods, const float distance, const float scale,
+                                      const std::uint32_t currentLod) {
+        if (lods.empty()) return 0;
+        const float pixelsPerMeshUnit = scale * mPixelsPerUnit / std::max(distance, 1e-4f);
+        const auto projected = [&](const std::uint32_t lod) { return lods[lod].error * pixelsPerMeshUnit; };
+        const auto coarsest = [&](const float threshold) {
+            std::uint32_t lod = 0;
+            while (lod + 1 < lods.size() && projected(lod + 1) <= threshold) ++lod;
+            return lod;
+        };
+
+        const std::uint32_t current = std::min<std::uint32_t>(currentLod, static_cast<std::uint32_t>(lods.size() - 1));
+        std::uint32_t selected = current;
+        if (projected(current) > mPixelThreshold * (1.0f + mHysteresis)) selected = coarsest(mPixelThreshold);
+        else if (const std::uint32_t coarser = coarsest(mPixelThreshold * (1.0f - mHysteresis)); coarser > current) selected = coarser;
+
+        ++mStats.objects;
+        mStats.switches += selected != currentLod;
+        mStats.trianglesFull += lods[0].indexCount / 3;
+        mStats.trianglesSelected += lods[selected].indexCount / 3;
+        return selected;
+    }
+
+}
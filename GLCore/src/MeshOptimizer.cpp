@@ -0,0 +1,441 @@
+//
+// Created by niek on 11/15/2025.
+//
+
+#include "GLCore/MeshOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <unordered_map>
+#include <unordered_set>
+#include <glm.hpp>
+
+namespace GLCore::MeshOptimizer {
+
+    namespace {
+        // FIFO post-transform cache, the model the ACMR numbers are quoted against
+        class FifoCache {
+        public:
+            FifoCache(const std::uint32_t vertexCount, const std::uint32_t size)
+                : mTimestamps(vertexCount, 0), mSize(size) {}
+
+            // Returns true on a miss
+            bool Access(const std::uint32_t vertex) {
+                if (mTime - mTimestamps[vertex] < mSize && mTimestamps[vertex] != 0) return false;
+                mTimestamps[vertex] = ++mTime;
+                return true;
+            }
+
+            void Clear() { mTime += mSize + 1; }
+
+        private:
+            std::vector<std::uint32_t> mTimestamps;
+            std::uint32_t mSize;
+            std::uint32_t mTime = 0;
+        };
+
+        // Triangles per vertex in CSR form
+        struct Adjacency {
+            std::vector<std::uint32_t> offsets;
+            std::vector<std::uint32_t> triangles;
+            std::vector<std::uint32_t> counts;
+
+            Adjacency(const std::span<const std::uint32_t> indices, const std::uint32_t vertexCount)
+                : offsets(vertexCount + 1, 0), triangles(indices.size()), counts(vertexCount, 0) {
+                for (const std::uint32_t v : indices) ++counts[v];
+                for (std::uint32_t v = 0; v < vertexCount; ++v) offsets[v + 1] = offsets[v] + counts[v];
+                std::vector<std::uint32_t> fill(offsets.begin(), offsets.end() - 1);
+                for (std::uint32_t i = 0; i < indices.size(); ++i) triangles[fill[indices[i]]++] = i / 3;
+            }
+        };
+
+        // Symmetric 4x4 error quadric (Garland & Heckbert); Error() is the weighted mean squared plane distance
+        struct Quadric {
+            double a00 = 0, a01 = 0, a02 = 0, a11 = 0, a12 = 0, a22 = 0;
+            double b0 = 0, b1 = 0, b2 = 0, c = 0, weight = 0;
+
+            void AddPlane(const glm::dvec3& n, const double d, const double w) {
+                a00 += w * n.x * n.x; a01 += w * n.x * n.y; a02 += w * n.x * n.z;
+                a11 += w * n.y * n.y; a12 += w * n.y * n.z; a22 += w * n.z * n.z;
+                b0 += w * n.x * d; b1 += w * n.y * d; b2 += w * n.z * d;
+                c += w * d * d;
+                weight += w;
+            }
+
+            Quadric& operator+=(const Quadric& o) {
+                a00 += o.a00; a01 += o.a01; a02 += o.a02; a11 += o.a11; a12 += o.a12; a22 += o.a22;
+                b0 += o.b0; b1 += o.b1; b2 += o.b2; c += o.c; weight += o.weight;
+                return *this;
+            }
+
+            double Error(const glm::dvec3& p) const {
+                const double e = p.x * (a00 * p.x + 2.0 * (a01 * p.y + a02 * p.z + b0))
+                                 + p.y * (a11 * p.y + 2.0 * (a12 * p.z + b1))
+                                 + p.z * (a22 * p.z + 2.0 * b2) + c;
+                return weight > 0.0 ? std::max(e, 0.0) / weight : 0.0;
+            }
+        };
+
+        enum class VertexKind : std::uint8_t { Manifold, Border, Locked };
+
+        struct PositionKey {
+            std::uint32_t x, y, z;
+
+            bool operator==(const PositionKey&) const = default;
+        };
+
+        struct PositionKeyHash {
+            std::size_t operator()(const PositionKey& k) const {
+                return (k.x * 73856093u) ^ (k.y * 19349663u) ^ (k.z * 83492791u);
+            }
+        };
+
+        std::uint64_t EdgeKey(const std::uint32_t a, const std::uint32_t b) {
+            return static_cast<std::uint64_t>(a) << 32 | b;
+        }
+    }
+
+    VertexCacheStats AnalyzeVertexCache(const std::span<const std::uint32_t> indices, const std::uint32_t vertexCount,
+                                        const std::uint32_t cacheSize) {
+        if (indices.size() < 3 || vertexCount == 0) return {};
+
+        FifoCache cache(vertexCount, cacheSize);
+        std::vector<bool> referenced(vertexCount, false);
+        std::uint32_t misses = 0, unique = 0;
+        for (const std::uint32_t v : indices) {
+            misses += cache.Access(v);
+            if (!referenced[v]) {
+                referenced[v] = true;
+                ++unique;
+            }
+        }
+        return {static_cast<float>(misses) / static_cast<float>(indices.size() / 3),
+                static_cast<float>(misses) / static_cast<float>(unique)};
+    }
+
+    std::vector<std::uint32_t> OptimizeVertexCache(const std::span<const std::uint32_t> indices, const std::uint32_t vertexCount,
+                                                   const std::uint32_t cacheSize) {
+        const std::uint32_t triangleCount = static_cast<std::uint32_t>(indices.size() / 3);
+        std::vector<std::uint32_t> result;
+        result.reserve(triangleCount * 3);
+        if (triangleCount == 0) return result;
+
+        const Adjacency adjacency(indices, vertexCount);
+        std::vector<std::uint32_t> live = adjacency.counts;      // triangles left per vertex
+        std::vector<std::uint32_t> cacheTime(vertexCount, 0);     // when the vertex entered the cache
+        std::vector<bool> emitted(triangleCount, false);
+        std::vector<std::uint32_t> deadEnd;                       // recently used vertices, for restarts
+        std::vector<std::uint32_t> candidates;
+        std::uint32_t time = cacheSize + 1;
+        std::uint32_t cursor = 0;
+
+        const auto inCache = [&](const std::uint32_t v) { return time - cacheTime[v] <= cacheSize; };
+
+        std::int64_t fan = 0;
+        while (fan >= 0) {
+            const auto fanning = static_cast<std::uint32_t>(fan);
+            candidates.clear();
+
+            // Emit every remaining triangle around the fanning vertex
+            for (std::uint32_t a = adjacency.offsets[fanning]; a < adjacency.offsets[fanning + 1]; ++a) {
+                const std::uint32_t triangle = adjacency.triangles[a];
+                if (emitted[triangle]) continue;
+                emitted[triangle] = true;
+                for (std::uint32_t c = 0; c < 3; ++c) {
+                    const std::uint32_t v = indices[triangle * 3 + c];
+                    result.push_back(v);
+                    deadEnd.push_back(v);
+                    candidates.push_back(v);
+                    --live[v];
+                    if (!inCache(v)) cacheTime[v] = time++;
+                }
+            }
+
+            // Next fanning vertex: the candidate that stays in cache longest while still having work left
+            fan = -1;
+            std::int64_t bestPriority = -1;
+            for (const std::uint32_t v : candidates) {
+                if (live[v] == 0) continue;
+                std::int64_t priority = 0;
+                if (time - cacheTime[v] + 2 * live[v] <= cacheSize) priority = time - cacheTime[v];
+                if (priority > bestPriority) {
+                    bestPriority = priority;
+                    fan = v;
+                }
+            }
+
+            if (fan < 0) {
+                // Dead end: prefer a recently touched vertex, then the next unfinished vertex in input order
+                while (!deadEnd.empty() && fan < 0) {
+                    const std::uint32_t v = deadEnd.back();
+                    deadEnd.pop_back();
+                    if (live[v] > 0) fan = v;
+                }
+                while (fan < 0 && cursor < vertexCount) {
+                    if (live[cursor] > 0) fan = cursor;
+                    ++cursor;
+                }
+            }
+        }
+        return result;
+    }
+
+    std::vector<std::uint32_t> OptimizeOverdraw(const std::span<const std::uint32_t> indices, const void* vertices,
+                                                const std::uint32_t vertexCount, const std::size_t vertexStride,
+                                                const std::uint32_t cacheSize, const float threshold) {
+        const std::uint32_t triangleCount = static_cast<std::uint32_t>(indices.size() / 3);
+        if (triangleCount == 0) return {indices.begin(), indices.end()};
+
+        const auto* bytes = static_cast<const std::byte*>(vertices);
+        const auto position = [&](const std::uint32_t v) {
+            glm::vec3 p;
+            std::memcpy(&p, bytes + v * vertexStride, sizeof(glm::vec3));
+            return p;
+        };
+
+        // Hard boundaries: triangles that miss the cache on all three vertices start a new cluster
+        std::vector<std::uint32_t> hard;
+        {
+            FifoCache cache(vertexCount, cacheSize);
+            for (std::uint32_t t = 0; t < triangleCount; ++t) {
+                std::uint32_t misses = 0;
+                for (std::uint32_t c = 0; c < 3; ++c) misses += cache.Access(indices[t * 3 + c]);
+                if (t == 0 || misses == 3) hard.push_back(t);
+            }
+            hard.push_back(triangleCount);
+        }
+
+        // Soft boundaries: split a hard cluster wherever its running ACMR is already within threshold of the whole
+        std::vector<std::uint32_t> clusters;
+        for (std::size_t h = 0; h + 1 < hard.size(); ++h) {
+            const std::uint32_t begin = hard[h], end = hard[h + 1];
+            const float clusterAcmr = AnalyzeVertexCache(indices.subspan(begin * 3, (end - begin) * 3), vertexCount, cacheSize).acmr;
+
+            FifoCache cache(vertexCount, cacheSize);
+            std::uint32_t start = begin, misses = 0;
+            clusters.push_back(begin);
+            for (std::uint32_t t = begin; t < end; ++t) {
+                for (std::uint32_t c = 0; c < 3; ++c) misses += cache.Access(indices[t * 3 + c]);
+                const float runningAcmr = static_cast<float>(misses) / static_cast<float>(t - start + 1);
+                if (t + 1 < end && runningAcmr <= clusterAcmr * threshold) {
+                    clusters.push_back(t + 1);
+                    start = t + 1;
+                    misses = 0;
+                    cache.Clear();
+                }
+            }
+        }
+        clusters.push_back(triangleCount);
+
+        // Sort key: how far the cluster sits outward along its own average normal
+        glm::vec3 meshCenter{0.0f};
+        for (std::uint32_t t = 0; t < triangleCount; ++t)
+            meshCenter += position(indices[t * 3]) + position(indices[t * 3 + 1]) + position(indices[t * 3 + 2]);
+        meshCenter /= static_cast<float>(triangleCount * 3);
+
+        const std::size_t clusterCount = clusters.size() - 1;
+        std::vector<float> keys(clusterCount);
+        for (std::size_t i = 0; i < clusterCount; ++i) {
+            glm::vec3 center{0.0f}, normal{0.0f};
+            float area = 0.0f;
+            for (std::uint32_t t = clusters[i]; t < clusters[i + 1]; ++t) {
+                const glm::vec3 a = position(indices[t * 3]), b = position(indices[t * 3 + 1]), c = position(indices[t * 3 + 2]);
+                const glm::vec3 n = glm::cross(b - a, c - a);   // length = 2 x area
+                const float weight = glm::length(n);
+                center += (a + b + c) * (weight / 3.0f);
+                normal += n;
+                area += weight;
+            }
+            if (area > 0.0f) center /= area;
+            const float length = glm::length(normal);
+            keys[i] = length > 0.0f ? glm::dot(center - meshCenter, normal / length) : 0.0f;
+        }
+
+        std::vector<std::uint32_t> order(clusterCount);
+        std::iota(order.begin(), order.end(), 0u);
+        std::ranges::stable_sort(order, [&keys](const std::uint32_t a, const std::uint32_t b) { return keys[a] > keys[b]; });
+
+        std::vector<std::uint32_t> result;
+        result.reserve(indices.size());
+        for (const std::uint32_t i : order)
+            result.insert(result.end(), indices.begin() + clusters[i] * 3, indices.begin() + clusters[i + 1] * 3);
+        return result;
+    }
+
+    std::vector<std::uint32_t> Simplify(const std::span<const std::uint32_t> indices, const void* vertices,
+                                        const std::uint32_t vertexCount, const std::size_t vertexStride,
+                                        const std::size_t targetIndexCount, const float targetError, float* resultError) {
+        constexpr double kBorderWeight = 10.0;
+        std::vector<std::uint32_t> result(indices.begin(), indices.end());
+        if (resultError) *resultError = 0.0f;
+        if (result.size() <= targetIndexCount || vertexCount == 0) return result;
+
+        // Work in a unit box so errors are relative to the mesh extent
+        const auto* bytes = static_cast<const std::byte*>(vertices);
+        std::vector<glm::vec3> raw(vertexCount);
+        for (std::uint32_t v = 0; v < vertexCount; ++v) std::memcpy(&raw[v], bytes + v * vertexStride, sizeof(glm::vec3));
+        glm::vec3 lo = raw[0], hi = raw[0];
+        for (const glm::vec3& p : raw) {
+            lo = glm::min(lo, p);
+            hi = glm::max(hi, p);
+        }
+        const float extent = std::max({hi.x - lo.x, hi.y - lo.y, hi.z - lo.z, 1e-20f});
+        std::vector<glm::dvec3> positions(vertexCount);
+        for (std::uint32_t v = 0; v < vertexCount; ++v) positions[v] = glm::dvec3((raw[v] - lo) / extent);
+
+        // Vertices sharing a position (attribute seams) share one canonical id for topology and quadrics
+        std::vector<std::uint32_t> canonical(vertexCount);
+        std::vector<std::uint32_t> groupSize(vertexCount, 0);
+        {
+            std::unordered_map<PositionKey, std::uint32_t, PositionKeyHash> first;
+            first.reserve(vertexCount);
+            for (std::uint32_t v = 0; v < vertexCount; ++v) {
+                PositionKey key;
+                std::memcpy(&key, &raw[v], sizeof(key));
+                canonical[v] = first.try_emplace(key, v).first->second;
+                ++groupSize[canonical[v]];
+            }
+        }
+
+        // Border edges exist in one direction only
+        std::unordered_set<std::uint64_t> directed;
+        directed.reserve(result.size());
+        for (std::size_t i = 0; i < result.size(); i += 3)
+            for (std::size_t c = 0; c < 3; ++c)
+                directed.insert(EdgeKey(canonical[result[i + c]], canonical[result[i + (c + 1) % 3]]));
+        const auto isBorderEdge = [&](const std::uint32_t a, const std::uint32_t b) {
+            return directed.contains(EdgeKey(canonical[a], canonical[b])) != directed.contains(EdgeKey(canonical[b], canonical[a]));
+        };
+
+        std::vector<Quadric> quadrics(vertexCount);
+        std::vector<bool> onBorder(vertexCount, false);
+        for (std::size_t i = 0; i < result.size(); i += 3) {
+            const std::uint32_t tri[3] = {result[i], result[i + 1], result[i + 2]};
+            const glm::dvec3 p0 = positions[tri[0]], p1 = positions[tri[1]], p2 = positions[tri[2]];
+            glm::dvec3 normal = glm::cross(p1 - p0, p2 - p0);
+            const double area2 = glm::length(normal);
+            if (area2 <= 0.0) continue;
+            normal /= area2;
+            for (const std::uint32_t v : tri) quadrics[canonical[v]].AddPlane(normal, -glm::dot(normal, p0), area2 * 0.5);
+
+            // Borders get a perpendicular plane so they keep their silhouette
+            for (int c = 0; c < 3; ++c) {
+                const std::uint32_t a = tri[c], b = tri[(c + 1) % 3];
+                if (!directed.contains(EdgeKey(canonical[b], canonical[a]))) {
+                    const glm::dvec3 edge = positions[b] - positions[a];
+                    const double length = glm::length(edge);
+                    if (length <= 0.0) continue;
+                    const glm::dvec3 plane = glm::normalize(glm::cross(edge, normal));
+                    const double d = -glm::dot(plane, positions[a]);
+                    quadrics[canonical[a]].AddPlane(plane, d, length * length * kBorderWeight);
+                    quadrics[canonical[b]].AddPlane(plane, d, length * length * kBorderWeight);
+                    onBorder[canonical[a]] = onBorder[canonical[b]] = true;
+                }
+            }
+        }
+
+        std::vector<VertexKind> kinds(vertexCount);
+        for (std::uint32_t v = 0; v < vertexCount; ++v)
+            kinds[v] = groupSize[canonical[v]] > 1 ? VertexKind::Locked : onBorder[canonical[v]] ? VertexKind::Border : VertexKind::Manifold;
+
+        struct Collapse {
+            std::uint32_t from, to;
+            double cost;
+        };
+        const double errorLimit = static_cast<double>(targetError) * targetError;
+        double maxError = 0.0;
+        std::vector<Collapse> collapses;
+        std::vector<std::uint32_t> remap(vertexCount);
+        std::vector<bool> locked(vertexCount);
+
+        // Passes of independent collapses, cheapest first, until the target or the error limit is hit
+        while (result.size() > targetIndexCount) {
+            const Adjacency adjacency(result, vertexCount);
+            collapses.clear();
+            for (std::size_t i = 0; i < result.size(); i += 3) {
+                for (std::size_t c = 0; c < 3; ++c) {
+                    const std::uint32_t a = result[i + c], b = result[i + (c + 1) % 3];
+                    for (const auto& [from, to] : {std::pair{a, b}, std::pair{b, a}}) {
+                        if (kinds[from] == VertexKind::Locked) continue;
+                        if (kinds[from] == VertexKind::Border && !isBorderEdge(from, to)) continue;
+                        Quadric q = quadrics[canonical[from]];
+                        q += quadrics[canonical[to]];
+                        const double cost = q.Error(positions[to]);
+                        if (cost <= errorLimit) collapses.push_back({from, to, cost});
+                    }
+                }
+            }
+            std::ranges::sort(collapses, {}, &Collapse::cost);
+
+            std::iota(remap.begin(), remap.end(), 0u);
+            std::fill(locked.begin(), locked.end(), false);
+            const std::size_t trianglesToRemove = (result.size() - targetIndexCount) / 3;
+            std::size_t removed = 0, applied = 0;
+
+            for (const Collapse& collapse : collapses) {
+                if (removed >= trianglesToRemove) break;
+                if (locked[collapse.from] || locked[collapse.to]) continue;
+
+                // Reject collapses that flip or squash a surviving triangle
+                bool valid = true;
+                std::size_t degenerate = 0;
+                for (std::uint32_t a = adjacency.offsets[collapse.from]; a < adjacency.offsets[collapse.from + 1] && valid; ++a) {
+                    const std::uint32_t* tri = &result[adjacency.triangles[a] * 3];
+                    if (tri[0] == collapse.to || tri[1] == collapse.to || tri[2] == collapse.to) {
+                        ++degenerate;
+                        continue;
+                    }
+                    glm::dvec3 p[3] = {positions[tri[0]], positions[tri[1]], positions[tri[2]]};
+                    const glm::dvec3 before = glm::cross(p[1] - p[0], p[2] - p[0]);
+                    for (int c = 0; c < 3; ++c)
+                        if (tri[c] == collapse.from) p[c] = positions[collapse.to];
+                    const glm::dvec3 after = glm::cross(p[1] - p[0], p[2] - p[0]);
+                    valid = glm::dot(before, after) > 0.25 * glm::length(before) * glm::length(after);
+                }
+                if (!valid) continue;
+
+                remap[collapse.from] = collapse.to;
+                quadrics[canonical[collapse.to]] += quadrics[canonical[collapse.from]];
+                for (std::uint32_t a = adjacency.offsets[collapse.from]; a < adjacency.offsets[collapse.from + 1]; ++a)
+                    for (int c = 0; c < 3; ++c) locked[result[adjacency.triangles[a] * 3 + c]] = true;
+                removed += degenerate;
+                maxError = std::max(maxError, collapse.cost);
+                ++applied;
+            }
+            if (applied == 0) break;
+
+            std::size_t write = 0;
+            for (std::size_t i = 0; i < result.size(); i += 3) {
+                const std::uint32_t a = remap[result[i]], b = remap[result[i + 1]], c = remap[result[i + 2]];
+                if (a == b || b == c || a == c) continue;
+                result[write++] = a;
+                result[write++] = b;
+                result[write++] = c;
+            }
+            result.resize(write);
+        }
+
+        if (resultError) *resultError = static_cast<float>(std::sqrt(maxError));
+        return result;
+    }
+
+    std::uint32_t OptimizeVertexFetch(void* vertices, const std::uint32_t vertexCount, const std::size_t vertexStride,
+                                      const std::span<std::uint32_t> indices) {
+        constexpr std::uint32_t kUnused = 0xFFFFFFFFu;
+        std::vector<std::uint32_t> remap(vertexCount, kUnused);
+        std::uint32_t next = 0;
+        for (std::uint32_t& index : indices) {
+            if (remap[index] == kUnused) remap[index] = next++;
+            index = remap[index];
+        }
+
+        auto* bytes = static_cast<std::byte*>(vertices);
+        std::vector<std::byte> copy(bytes, bytes + vertexCount * vertexStride);
+        for (std::uint32_t v = 0; v < vertexCount; ++v)
+            if (remap[v] != kUnused) std::memcpy(bytes + remap[v] * vertexStride, copy.data() + v * vertexStride, vertexStride);
+        return next;
+    }
+
+}
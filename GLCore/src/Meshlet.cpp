@@ -0,0 +1,353 @@
+//
+// Created by niek on 11/17/2025.
+//
+
+#include "GLCore/Meshlet.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GLCORE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace GLCore {
+
+    namespace {
+        constexpr std::uint32_t kNone = 0xFFFFFFFFu;
+
+        // Ritter's bounding sphere: start from the most distant of the axis-extreme pairs, grow to include stragglers
+        BoundingSphere ComputeSphere(const std::vector<glm::vec3>& positions, std::span<const std::uint32_t> points) {
+            if (points.empty()) return {};
+
+            std::uint32_t minIndex[3] = {points[0], points[0], points[0]};
+            std::uint32_t maxIndex[3] = {points[0], points[0], points[0]};
+            for (const std::uint32_t p : points) {
+                for (int axis = 0; axis < 3; ++axis) {
+                    if (positions[p][axis] < positions[minIndex[axis]][axis]) minIndex[axis] = p;
+                    if (positions[p][axis] > positions[maxIndex[axis]][axis]) maxIndex[axis] = p;
+                }
+            }
+
+            int widest = 0;
+            float widestDistance = -1.0f;
+            for (int axis = 0; axis < 3; ++axis) {
+                const glm::vec3 span = positions[maxIndex[axis]] - positions[minIndex[axis]];
+                const float distance = glm::dot(span, span);
+                if (distance > widestDistance) {
+                    widestDistance = distance;
+                    widest = axis;
+                }
+            }
+
+            glm::vec3 center = (positions[minIndex[widest]] + positions[maxIndex[widest]]) * 0.5f;
+            float radius = std::sqrt(widestDistance) * 0.5f;
+            for (const std::uint32_t p : points) {
+                const float distance = glm::length(positions[p] - center);
+                if (distance > radius) {
+                    const float grown = (radius + distance) * 0.5f;
+                    center += (positions[p] - center) * ((grown - radius) / distance);
+                    radius = grown;
+                }
+            }
+            return {center, radius};
+        }
+
+        glm::vec3 LoadPosition(const void* vertices, const std::size_t stride, const std::uint32_t i) {
+            glm::vec3 position;
+            std::memcpy(&position, static_cast<const std::byte*>(vertices) + i * stride, sizeof(position));
+            return position;
+        }
+    }
+
+    MeshletMesh BuildMeshlets(const std::span<const std::uint32_t> indices, const void* vertices,
+                              const std::uint32_t vertexCount, const std::size_t stride, const MeshletSettings& settings) {
+        const std::uint32_t maxVertices = std::max(settings.maxVertices, 3u);
+        const std::uint32_t maxTriangles = std::max(settings.maxTriangles, 1u);
+        const float coneWeight = std::clamp(settings.coneWeight, 0.0f, 1.0f);
+        const auto triangleCount = static_cast<std::uint32_t>(indices.size() / 3);
+
+        MeshletMesh result;
+        result.indices.reserve(triangleCount * 3);
+
+        std::vector<glm::vec3> positions(vertexCount);
+        for (std::uint32_t v = 0; v < vertexCount; ++v) positions[v] = LoadPosition(vertices, stride, v);
+
+        // Per-triangle centroid and unit normal (zero for degenerate triangles), plus the mean edge length for scoring
+        std::vector<glm::vec3> centroids(triangleCount), normals(triangleCount);
+        double edgeSum = 0.0;
+        for (std::uint32_t t = 0; t < triangleCount; ++t) {
+            const glm::vec3& a = positions[indices[t * 3 + 0]];
+            const glm::vec3& b = positions[indices[t * 3 + 1]];
+            const glm::vec3& c = positions[indices[t * 3 + 2]];
+            centroids[t] = (a + b + c) / 3.0f;
+            const glm::vec3 normal = glm::cross(b - a, c - a);
+            const float length = glm::length(normal);
+            normals[t] = length > 0.0f ? normal / length : glm::vec3(0.0f);
+            edgeSum += glm::length(b - a) + glm::length(c - b) + glm::length(a - c);
+        }
+        const float meanEdge = triangleCount > 0 ? static_cast<float>(edgeSum / (triangleCount * 3.0)) : 1.0f;
+
+        // Vertex -> triangle adjacency (CSR)
+        std::vector<std::uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+        for (const std::uint32_t index : indices.first(triangleCount * 3)) ++adjacencyOffsets[index + 1];
+        for (std::uint32_t v = 0; v < vertexCount; ++v) adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+        std::vector<std::uint32_t> adjacency(triangleCount * 3);
+        {
+            std::vector<std::uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+            for (std::uint32_t t = 0; t < triangleCount; ++t)
+                for (int k = 0; k < 3; ++k) adjacency[fill[indices[t * 3 + k]]++] = t;
+        }
+
+        std::vector<bool> emitted(triangleCount, false);
+        std::vector<std::uint32_t> liveTriangles(vertexCount);                 // not yet emitted, per vertex
+        for (std::uint32_t v = 0; v < vertexCount; ++v) liveTriangles[v] = adjacencyOffsets[v + 1] - adjacencyOffsets[v];
+        std::vector<std::uint32_t> vertexStamp(vertexCount, kNone);      // meshlet that already holds the vertex
+        std::vector<std::uint32_t> candidateStamp(triangleCount, kNone); // meshlet whose candidate list holds it
+        std::vector<std::uint32_t> candidates, meshletVertices, meshletTriangles;
+        std::uint32_t emittedCount = 0, seedCursor = 0;
+
+        while (emittedCount < triangleCount) {
+            const auto id = static_cast<std::uint32_t>(result.meshlets.size());
+
+            // Seed next to the previous meshlet when possible so consecutive meshlets stay spatially coherent
+            std::uint32_t seed = kNone;
+            for (const std::uint32_t c : candidates)
+                if (!emitted[c]) { seed = c; break; }
+            if (seed == kNone) {
+                while (emitted[seedCursor]) ++seedCursor;
+                seed = seedCursor;
+            }
+            candidates.clear();
+            meshletVertices.clear();
+            meshletTriangles.clear();
+
+            glm::vec3 centroidSum(0.0f), normalSum(0.0f);
+            const auto addTriangle = [&](const std::uint32_t t) {
+                emitted[t] = true;
+                ++emittedCount;
+                meshletTriangles.push_back(t);
+                centroidSum += centroids[t];
+                normalSum += normals[t];
+                for (int k = 0; k < 3; ++k) {
+                    const std::uint32_t v = indices[t * 3 + k];
+                    --liveTriangles[v];
+                    if (vertexStamp[v] == id) continue;
+                    vertexStamp[v] = id;
+                    meshletVertices.push_back(v);
+                    for (std::uint32_t a = adjacencyOffsets[v]; a < adjacencyOffsets[v + 1]; ++a) {
+                        const std::uint32_t neighbour = adjacency[a];
+                        if (emitted[neighbour] || candidateStamp[neighbour] == id) continue;
+                        candidateStamp[neighbour] = id;
+                        candidates.push_back(neighbour);
+                    }
+                }
+            };
+            addTriangle(seed);
+
+            while (meshletTriangles.size() < maxTriangles) {
+                std::erase_if(candidates, [&emitted](const std::uint32_t c) { return emitted[c]; });
+
+                const float count = static_cast<float>(meshletTriangles.size());
+                const glm::vec3 center = centroidSum / count;
+                const float normalLength = glm::length(normalSum);
+                const glm::vec3 axis = normalLength > 0.0f ? normalSum / normalLength : glm::vec3(0.0f);
+                const float extent = std::max(meanEdge * std::sqrt(count), 1e-6f);
+
+                std::uint32_t best = kNone, bestNew = 4;
+                float bestScore = std::numeric_limits<float>::max();
+                for (const std::uint32_t c : candidates) {
+                    std::uint32_t added = 0, closing = 0;
+                    for (int k = 0; k < 3; ++k) {
+                        const std::uint32_t v = indices[c * 3 + k];
+                        added += vertexStamp[v] != id ? 1u : 0u;
+                        closing += liveTriangles[v] == 1 ? 1u : 0u;
+                    }
+                    if (meshletVertices.size() + added > maxVertices || added > bestNew) continue;
+
+                    // Finishing off vertices whose last triangle this is avoids stranding tiny leftover meshlets
+                    const float spatial = glm::length(centroids[c] - center) / extent;
+                    const float cone = 1.0f - glm::dot(normals[c], axis);
+                    const float score = (1.0f - coneWeight) * spatial + coneWeight * cone - static_cast<float>(closing);
+                    if (added < bestNew || score < bestScore) {
+                        best = c;
+                        bestNew = added;
+                        bestScore = score;
+                    }
+                }
+                if (best == kNone) break;
+                addTriangle(best);
+            }
+
+            // Emit the triangles and the bounds
+            Meshlet& meshlet = result.meshlets.emplace_back();
+            meshlet.firstIndex = static_cast<std::uint32_t>(result.indices.size());
+            meshlet.indexCount = static_cast<std::uint32_t>(meshletTriangles.size() * 3);
+            meshlet.vertexCount = static_cast<std::uint32_t>(meshletVertices.size());
+            for (const std::uint32_t t : meshletTriangles)
+                result.indices.insert(result.indices.end(), indices.begin() + t * 3, indices.begin() + t * 3 + 3);
+            meshlet.bounds = ComputeSphere(positions, meshletVertices);
+
+            // Normal cone: cos of the widest deviation from the mean normal turned into the backface cutoff
+            // (sin of that angle); cones wider than ~84 degrees never reject anything and are disabled
+            const float normalLength = glm::length(normalSum);
+            if (normalLength > 1e-6f) {
+                meshlet.coneAxis = normalSum / normalLength;
+                float minDot = 1.0f;
+                for (const std::uint32_t t : meshletTriangles)
+                    if (normals[t] != glm::vec3(0.0f)) minDot = std::min(minDot, glm::dot(normals[t], meshlet.coneAxis));
+                meshlet.coneCutoff = minDot > 0.1f ? std::sqrt(1.0f - minDot * minDot) : 1.0f;
+            }
+        }
+
+        // Whole-mesh sphere over every referenced vertex
+        std::vector<std::uint32_t> used;
+        used.reserve(vertexCount);
+        std::vector<bool> seen(vertexCount, false);
+        for (const std::uint32_t index : result.indices) {
+            if (seen[index]) continue;
+            seen[index] = true;
+            used.push_back(index);
+        }
+        result.bounds = ComputeSphere(positions, used);
+
+        MeshletCullData& cull = result.cullData;
+        const std::size_t padded = (result.meshlets.size() + 3) & ~std::size_t{3};
+        for (std::vector<float>* lane : {&cull.centerX, &cull.centerY, &cull.centerZ, &cull.radius,
+                                         &cull.axisX, &cull.axisY, &cull.axisZ, &cull.cutoff})
+            lane->assign(padded, 0.0f);
+        for (std::size_t i = 0; i < result.meshlets.size(); ++i) {
+            const Meshlet& meshlet = result.meshlets[i];
+            cull.centerX[i] = meshlet.bounds.center.x;
+            cull.centerY[i] = meshlet.bounds.center.y;
+            cull.centerZ[i] = meshlet.bounds.center.z;
+            cull.radius[i] = meshlet.bounds.radius;
+            cull.axisX[i] = meshlet.coneAxis.x;
+            cull.axisY[i] = meshlet.coneAxis.y;
+            cull.axisZ[i] = meshlet.coneAxis.z;
+            cull.cutoff[i] = meshlet.coneCutoff;
+        }
+        return result;
+    }
+
+    MeshletMesh BuildMeshlets(const MeshData& mesh, const MeshletSettings& settings) {
+        return BuildMeshlets(mesh.indices, mesh.vertices.data(), static_cast<std::uint32_t>(mesh.vertices.size()),
+                             sizeof(MeshVertex), settings);
+    }
+
+    void MeshletCuller::Begin(const Frustum& frustum, const glm::vec3& eye) {
+        mFrustum = frustum;
+        mEye = eye;
+        mStats = {};
+    }
+
+    std::uint32_t MeshletCuller::Cull(const MeshletMesh& mesh, const MeshRange& range, const glm::mat4& model,
+                                      IndirectDrawList& drawList, const std::uint32_t bucket, const void* drawData) {
+        const auto start = std::chrono::steady_clock::now();
+        const auto count = static_cast<std::uint32_t>(mesh.meshlets.size());
+        ++mStats.instances;
+        mStats.trianglesTotal += mesh.indices.size() / 3;
+
+        const float scale = std::max({glm::length(glm::vec3(model[0])), glm::length(glm::vec3(model[1])),
+                                      glm::length(glm::vec3(model[2]))});
+        if (!mFrustum.Intersects({glm::vec3(model * glm::vec4(mesh.bounds.center, 1.0f)), mesh.bounds.radius * scale})) {
+            ++mStats.instancesCulled;
+            mStats.cullMs += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+            return 0;
+        }
+
+        // Planes pulled back into mesh space still measure world distances, so radii are scaled rather than the planes
+        // renormalized; the eye moves into mesh space where the cone test only needs angles
+        std::array<glm::vec4, 6> planes{};
+        for (std::size_t p = 0; p < planes.size(); ++p) planes[p] = glm::transpose(model) * mFrustum.Planes()[p];
+        const glm::vec3 eye = glm::vec3(glm::inverse(model) * glm::vec4(mEye, 1.0f));
+
+        const MeshletCullData& cull = mesh.cullData;
+        mVisible.resize(cull.radius.size());
+        std::uint32_t frustumCulled = 0, backfaceCulled = 0;
+        std::uint32_t i = 0;
+#if defined(GLCORE_SSE2)
+        const __m128 scale4 = _mm_set1_ps(scale);
+        const __m128 eyeX = _mm_set1_ps(eye.x), eyeY = _mm_set1_ps(eye.y), eyeZ = _mm_set1_ps(eye.z);
+        for (; i + 4 <= cull.radius.size(); i += 4) {
+            const __m128 cx = _mm_loadu_ps(&cull.centerX[i]);
+            const __m128 cy = _mm_loadu_ps(&cull.centerY[i]);
+            const __m128 cz = _mm_loadu_ps(&cull.centerZ[i]);
+            const __m128 radius = _mm_loadu_ps(&cull.radius[i]);
+            const __m128 negativeWorldRadius = _mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(radius, scale4));
+
+            __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+            for (const glm::vec4& plane : planes) {
+                const __m128 distance = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(cx, _mm_set1_ps(plane.x)), _mm_mul_ps(cy, _mm_set1_ps(plane.y))),
+                    _mm_add_ps(_mm_mul_ps(cz, _mm_set1_ps(plane.z)), _mm_set1_ps(plane.w)));
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, negativeWorldRadius));
+            }
+
+            const __m128 dx = _mm_sub_ps(cx, eyeX), dy = _mm_sub_ps(cy, eyeY), dz = _mm_sub_ps(cz, eyeZ);
+            const __m128 along = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, _mm_loadu_ps(&cull.axisX[i])),
+                                                       _mm_mul_ps(dy, _mm_loadu_ps(&cull.axisY[i]))),
+                                            _mm_mul_ps(dz, _mm_loadu_ps(&cull.axisZ[i])));
+            const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz)));
+            const __m128 backface = _mm_cmpge_ps(along, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&cull.cutoff[i]), length), radius));
+
+            const int insideMask = _mm_movemask_ps(inside);
+            const int visibleMask = _mm_movemask_ps(_mm_andnot_ps(backface, inside));
+            for (int lane = 0; lane < 4; ++lane) {
+                if (i + lane >= count) break;
+                const bool laneInside = (insideMask >> lane) & 1;
+                mVisible[i + lane] = static_cast<std::uint8_t>((visibleMask >> lane) & 1);
+                frustumCulled += laneInside ? 0 : 1;
+                backfaceCulled += laneInside && !mVisible[i + lane] ? 1 : 0;
+            }
+        }
+#endif
+        for (; i < count; ++i) {
+            const glm::vec3 center(cull.centerX[i], cull.centerY[i], cull.centerZ[i]);
+            bool inside = true;
+            for (const glm::vec4& plane : planes)
+                inside = inside && glm::dot(glm::vec3(plane), center) + plane.w >= -cull.radius[i] * scale;
+
+            const glm::vec3 toCenter = center - eye;
+            const bool backface = glm::dot(toCenter, glm::vec3(cull.axisX[i], cull.axisY[i], cull.axisZ[i]))
+                                  >= cull.cutoff[i] * glm::length(toCenter) + cull.radius[i];
+            mVisible[i] = inside && !backface ? 1 : 0;
+            frustumCulled += inside ? 0 : 1;
+            backfaceCulled += inside && backface ? 1 : 0;
+        }
+
+        mStats.meshlets += count;
+        mStats.frustumCulled += frustumCulled;
+        mStats.backfaceCulled += backfaceCulled;
+
+        // Meshlets are stored back to back, so each run of visible ones is a single index range
+        std::uint32_t kept = 0;
+        for (std::uint32_t first = 0; first < count;) {
+            if (!mVisible[first]) {
+                ++first;
+                continue;
+            }
+            std::uint32_t last = first;
+            while (last + 1 < count && mVisible[last + 1]) ++last;
+
+            const std::uint32_t firstIndex = mesh.meshlets[first].firstIndex;
+            const std::uint32_t indexCount = mesh.meshlets[last].firstIndex + mesh.meshlets[last].indexCount - firstIndex;
+            const MeshRange run{range.baseVertex, range.vertexCount, range.firstIndex + firstIndex, indexCount};
+            if (drawList.Add(bucket, run, drawData)) {
+                ++mStats.draws;
+                mStats.trianglesSubmitted += indexCount / 3;
+                kept += last - first + 1;
+            }
+            first = last + 1;
+        }
+
+        mStats.cullMs += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return kept;
+    }
+
+}
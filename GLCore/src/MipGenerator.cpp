@@ -0,0 +1,443 @@
+//
+// Created by niek on 11/23/2025.
+//
+
+#include "GLCore/MipGenerator.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GLCORE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// AVX2 kernels are compiled for every x86 build and only called when DetectSimdLevel() reports support
+#if defined(GLCORE_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#define GLCORE_AVX2 1
+#define GLCORE_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#include <immintrin.h>
+#elif defined(GLCORE_SSE2) && defined(_MSC_VER)
+#define GLCORE_AVX2 1
+#define GLCORE_TARGET_AVX2
+#include <immintrin.h>
+#endif
+
+namespace GLCore {
+
+    namespace {
+        constexpr int kBandRows = 16;
+        constexpr int kMaxTaps = 12;
+
+        /** @brief 2:1 decimation kernel; tap k of destination pixel d reads source pixel 2d - (taps / 2 - 1) + k. */
+        struct Kernel {
+            int taps = 2;
+            std::array<float, kMaxTaps> weights{};
+
+            int Pad() const { return taps / 2 - 1; }
+        };
+
+        double Sinc(const double x) {
+            if (std::abs(x) < 1e-9) return 1.0;
+            const double px = 3.14159265358979323846 * x;
+            return std::sin(px) / px;
+        }
+
+        double BesselI0(const double x) {
+            double sum = 1.0, term = 1.0;
+            for (int k = 1; k < 32; ++k) {
+                term *= (x / (2.0 * k)) * (x / (2.0 * k));
+                sum += term;
+            }
+            return sum;
+        }
+
+        Kernel MakeKernel(const MipFilter filter) {
+            const double radius = filter == MipFilter::Box ? 0.5 : filter == MipFilter::Kaiser ? 2.0 : 3.0;
+            constexpr double kKaiserAlpha = 4.0;
+
+            Kernel kernel;
+            kernel.taps = static_cast<int>(radius * 4.0);
+            double sum = 0.0;
+            std::array<double, kMaxTaps> weights{};
+            for (int k = 0; k < kernel.taps; ++k) {
+                // Distance from the destination pixel center, in destination pixels
+                const double x = (k - kernel.Pad() - 0.5) / 2.0;
+                const double t = x / radius;
+                switch (filter) {
+                    case MipFilter::Box: weights[k] = 1.0; break;
+                    case MipFilter::Kaiser: weights[k] = Sinc(x) * BesselI0(kKaiserAlpha * std::sqrt(std::max(0.0, 1.0 - t * t))) / BesselI0(kKaiserAlpha); break;
+                    case MipFilter::Lanczos3: weights[k] = Sinc(x) * Sinc(t); break;
+                }
+                sum += weights[k];
+            }
+            for (int k = 0; k < kernel.taps; ++k) kernel.weights[k] = static_cast<float>(weights[k] / sum);
+            return kernel;
+        }
+
+        // ---- sRGB <-> linear -------------------------------------------------------------------------------------
+
+        double SrgbToLinear(const double s) {
+            return s <= 0.04045 ? s / 12.92 : std::pow((s + 0.055) / 1.055, 2.4);
+        }
+
+        double LinearToSrgb(const double l) {
+            return l <= 0.0031308 ? l * 12.92 : 1.055 * std::pow(l, 1.0 / 2.4) - 0.055;
+        }
+
+        /**
+         * Exactly rounded linear -> 8-bit sRGB without pow:
+         * - thresholds[k] is the smallest float that encodes to k.
+         * - bucket[] maps the exponent and top 8 mantissa bits of x in [2^-13, 1) to the code at the bucket's lower
+         *   edge. Buckets are narrower than the closest pair of thresholds, so one compare finishes the job.
+         */
+        struct SrgbTables {
+            static constexpr std::uint32_t kMinBits = 114u << 23;     // 2^-13, below the first threshold
+            static constexpr std::uint32_t kShift = 15;
+            static constexpr std::uint32_t kBuckets = (127u << 23 >> kShift) - (kMinBits >> kShift);
+
+            std::array<float, 256> toLinear{};
+            std::array<float, 257> thresholds{};
+            std::array<std::uint8_t, kBuckets> bucket{};
+
+            SrgbTables() {
+                for (int i = 0; i < 256; ++i) toLinear[i] = static_cast<float>(SrgbToLinear(i / 255.0));
+
+                const auto exact = [](const float l) { return static_cast<int>(std::floor(LinearToSrgb(l) * 255.0 + 0.5)); };
+                thresholds[0] = -std::numeric_limits<float>::infinity();
+                thresholds[256] = std::numeric_limits<float>::infinity();
+                for (int k = 1; k < 256; ++k) {
+                    float t = static_cast<float>(SrgbToLinear((k - 0.5) / 255.0));
+                    while (exact(t) < k) t = std::nextafter(t, 2.0f);
+                    while (exact(std::nextafter(t, -1.0f)) >= k) t = std::nextafter(t, -1.0f);
+                    thresholds[k] = t;
+                }
+                for (std::uint32_t i = 0; i < kBuckets; ++i) {
+                    const float lower = std::bit_cast<float>(((kMinBits >> kShift) + i) << kShift);
+                    int code = 0;
+                    while (code < 255 && thresholds[code + 1] <= lower) ++code;
+                    bucket[i] = static_cast<std::uint8_t>(code);
+                }
+            }
+
+            // Branchless: clamping into [2^-13, 1) keeps the ends right (0 and 255) and maps NaN to 0
+            std::uint8_t Encode(float l) const {
+                l = std::min(std::max(std::bit_cast<float>(kMinBits), l), std::bit_cast<float>(0x3F7FFFFFu));
+                const int code = bucket[(std::bit_cast<std::uint32_t>(l) >> kShift) - (kMinBits >> kShift)];
+                return static_cast<std::uint8_t>(code + (l >= thresholds[code + 1] ? 1 : 0));
+            }
+        };
+
+        const SrgbTables& Srgb() {
+            static const SrgbTables tables;
+            return tables;
+        }
+
+        std::uint8_t EncodeUnorm(const float v) {
+            return static_cast<std::uint8_t>(std::clamp(v, 0.0f, 1.0f) * 255.0f + 0.5f);
+        }
+
+        // ---- Per-row work ----------------------------------------------------------------------------------------
+
+        /** @brief What the row helpers need to know about the image's channels. */
+        struct Format {
+            int channels = 4;
+            int alpha = -1;           // alpha channel index, -1 without alpha
+            bool srgb = true;
+            bool premultiply = false;
+            bool wrap = false;
+        };
+
+        int Resolve(const int i, const int size, const bool wrap) {
+            if (wrap) return ((i % size) + size) % size;
+            return std::clamp(i, 0, size - 1);
+        }
+
+        void LinearizeRow(const std::uint8_t* src, const int width, const Format& format, float* out) {
+            const SrgbTables& srgb = Srgb();
+            const int c = format.channels;
+            if (c == 4 && format.srgb) {
+                // The common case without per-channel branches
+                for (int x = 0; x < width; ++x) {
+                    const std::uint8_t* in = src + x * 4;
+                    const float alpha = in[3] * (1.0f / 255.0f);
+                    const float scale = format.premultiply ? alpha : 1.0f;
+                    out[x * 4 + 0] = srgb.toLinear[in[0]] * scale;
+                    out[x * 4 + 1] = srgb.toLinear[in[1]] * scale;
+                    out[x * 4 + 2] = srgb.toLinear[in[2]] * scale;
+                    out[x * 4 + 3] = alpha;
+                }
+                return;
+            }
+            for (int x = 0; x < width; ++x) {
+                const std::uint8_t* in = src + x * c;
+                float* o = out + x * c;
+                const float alpha = format.alpha >= 0 ? in[format.alpha] * (1.0f / 255.0f) : 1.0f;
+                const float scale = format.premultiply ? alpha : 1.0f;
+                for (int k = 0; k < c; ++k) {
+                    if (k == format.alpha) o[k] = alpha;
+                    else o[k] = (format.srgb ? srgb.toLinear[in[k]] : in[k] * (1.0f / 255.0f)) * scale;
+                }
+            }
+        }
+
+        void EncodeRow(const float* src, const int width, const Format& format, std::uint8_t* out) {
+            const SrgbTables& srgb = Srgb();
+            const int c = format.channels;
+            if (c == 4 && format.srgb) {
+                for (int x = 0; x < width; ++x) {
+                    const float* in = src + x * 4;
+                    const float alpha = in[3];
+                    const float scale = format.premultiply ? (alpha > 0.0f ? 1.0f / alpha : 0.0f) : 1.0f;
+                    out[x * 4 + 0] = srgb.Encode(in[0] * scale);
+                    out[x * 4 + 1] = srgb.Encode(in[1] * scale);
+                    out[x * 4 + 2] = srgb.Encode(in[2] * scale);
+                    out[x * 4 + 3] = EncodeUnorm(alpha);
+                }
+                return;
+            }
+            for (int x = 0; x < width; ++x) {
+                const float* in = src + x * c;
+                std::uint8_t* o = out + x * c;
+                const float alpha = format.alpha >= 0 ? in[format.alpha] : 1.0f;
+                const float scale = format.premultiply ? (alpha > 0.0f ? 1.0f / alpha : 0.0f) : 1.0f;
+                for (int k = 0; k < c; ++k) {
+                    if (k == format.alpha) o[k] = EncodeUnorm(alpha);
+                    else o[k] = format.srgb ? srgb.Encode(in[k] * scale) : EncodeUnorm(in[k] * scale);
+                }
+            }
+        }
+
+        // `padded` pixel i is source pixel i - kernel.Pad() (clamped or wrapped); dstWidth * 2 + taps pixels long
+        void HorizontalScalar(const float* padded, const int dstWidth, const int channels, const Kernel& kernel, float* out) {
+            for (int d = 0; d < dstWidth; ++d) {
+                for (int c = 0; c < channels; ++c) {
+                    float sum = 0.0f;
+                    for (int k = 0; k < kernel.taps; ++k) sum += kernel.weights[k] * padded[(2 * d + k) * channels + c];
+                    out[d * channels + c] = sum;
+                }
+            }
+        }
+
+        void VerticalScalar(const float* const* rows, const Kernel& kernel, const int count, float* out) {
+            for (int i = 0; i < count; ++i) {
+                float sum = 0.0f;
+                for (int k = 0; k < kernel.taps; ++k) sum += kernel.weights[k] * rows[k][i];
+                out[i] = std::clamp(sum, 0.0f, 1.0f);
+            }
+        }
+
+#ifdef GLCORE_SSE2
+        // RGBA only: one pixel per register
+        void HorizontalSse2(const float* padded, const int dstWidth, const Kernel& kernel, float* out) {
+            for (int d = 0; d < dstWidth; ++d) {
+                __m128 sum = _mm_setzero_ps();
+                for (int k = 0; k < kernel.taps; ++k)
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(kernel.weights[k]), _mm_loadu_ps(padded + (2 * d + k) * 4)));
+                _mm_storeu_ps(out + d * 4, sum);
+            }
+        }
+
+        void VerticalSse2(const float* const* rows, const Kernel& kernel, const int count, float* out) {
+            const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f);
+            int i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128 sum = _mm_setzero_ps();
+                for (int k = 0; k < kernel.taps; ++k)
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(kernel.weights[k]), _mm_loadu_ps(rows[k] + i)));
+                _mm_storeu_ps(out + i, _mm_min_ps(_mm_max_ps(sum, zero), one));
+            }
+            for (; i < count; ++i) {
+                float sum = 0.0f;
+                for (int k = 0; k < kernel.taps; ++k) sum += kernel.weights[k] * rows[k][i];
+                out[i] = std::clamp(sum, 0.0f, 1.0f);
+            }
+        }
+#endif
+
+#ifdef GLCORE_AVX2
+        // RGBA only: destination pixels d and d + 1 per register. A 256-bit load at source pixel 2d + j holds pixel
+        // 2d + j (tap j of d) and pixel 2(d + 1) + j - 1 (tap j - 1 of d + 1), so each load gets a split weight.
+        GLCORE_TARGET_AVX2 void HorizontalAvx2(const float* padded, const int dstWidth, const Kernel& kernel, float* out) {
+            __m256 weights[kMaxTaps + 1];
+            for (int j = 0; j <= kernel.taps; ++j) {
+                const float low = j < kernel.taps ? kernel.weights[j] : 0.0f;
+                const float high = j > 0 ? kernel.weights[j - 1] : 0.0f;
+                weights[j] = _mm256_setr_ps(low, low, low, low, high, high, high, high);
+            }
+            int d = 0;
+            for (; d + 2 <= dstWidth; d += 2) {
+                __m256 sum = _mm256_setzero_ps();
+                for (int j = 0; j <= kernel.taps; ++j) sum = _mm256_fmadd_ps(weights[j], _mm256_loadu_ps(padded + (2 * d + j) * 4), sum);
+                _mm256_storeu_ps(out + d * 4, sum);
+            }
+            for (; d < dstWidth; ++d) {
+                __m128 sum = _mm_setzero_ps();
+                for (int k = 0; k < kernel.taps; ++k)
+                    sum = _mm_fmadd_ps(_mm_set1_ps(kernel.weights[k]), _mm_loadu_ps(padded + (2 * d + k) * 4), sum);
+                _mm_storeu_ps(out + d * 4, sum);
+            }
+        }
+
+        GLCORE_TARGET_AVX2 void VerticalAvx2(const float* const* rows, const Kernel& kernel, const int count, float* out) {
+            const __m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1.0f);
+            int i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256 sum = _mm256_setzero_ps();
+                for (int k = 0; k < kernel.taps; ++k) sum = _mm256_fmadd_ps(_mm256_set1_ps(kernel.weights[k]), _mm256_loadu_ps(rows[k] + i), sum);
+                _mm256_storeu_ps(out + i, _mm256_min_ps(_mm256_max_ps(sum, zero), one));
+            }
+            for (; i < count; ++i) {
+                float sum = 0.0f;
+                for (int k = 0; k < kernel.taps; ++k) sum = std::fma(kernel.weights[k], rows[k][i], sum);
+                out[i] = std::clamp(sum, 0.0f, 1.0f);
+            }
+        }
+#endif
+
+        /** @brief The kernels one GenerateMips() call dispatches to. */
+        struct Kernels {
+            SimdLevel level = SimdLevel::Scalar;
+
+            void Horizontal(const float* padded, const int dstWidth, const int channels, const Kernel& kernel, float* out) const {
+#ifdef GLCORE_AVX2
+                if (level == SimdLevel::AVX2 && channels == 4) return HorizontalAvx2(padded, dstWidth, kernel, out);
+#endif
+#ifdef GLCORE_SSE2
+                if (level != SimdLevel::Scalar && channels == 4) return HorizontalSse2(padded, dstWidth, kernel, out);
+#endif
+                HorizontalScalar(padded, dstWidth, channels, kernel, out);
+            }
+
+            void Vertical(const float* const* rows, const Kernel& kernel, const int count, float* out) const {
+#ifdef GLCORE_AVX2
+                if (level == SimdLevel::AVX2) return VerticalAvx2(rows, kernel, count, out);
+#endif
+#ifdef GLCORE_SSE2
+                if (level != SimdLevel::Scalar) return VerticalSse2(rows, kernel, count, out);
+#endif
+                VerticalScalar(rows, kernel, count, out);
+            }
+        };
+
+        /** @brief Per-thread scratch rows, reused across bands, levels and images. */
+        struct Scratch {
+            std::vector<float> linear;     // one source row, unpadded (level 0 only)
+            std::vector<float> padded;
+            std::vector<float> filtered;   // horizontally filtered source rows of one band
+            std::vector<float> row;        // one finished destination row
+        };
+
+        /**
+         * Destination rows [y0, y1) of one level: horizontally filter the source rows they need, then combine them
+         * vertically, write the float row for the next level (if any) and encode it to 8-bit.
+         * - Level 0 reads 8-bit pixels (linearized per row); later levels read the previous level's float plane.
+         */
+        void FilterBand(const std::uint8_t* source8, const float* sourceF, const int srcWidth, const int srcHeight,
+                        const int dstWidth, const int y0, const int y1, const Format& format, const Kernel& kernel,
+                        const Kernels& kernels, float* nextF, std::uint8_t* out8) {
+            thread_local Scratch scratch;
+            const int c = format.channels;
+            const int pad = kernel.Pad();
+            const int paddedPixels = dstWidth * 2 + kernel.taps;
+            const int firstRow = 2 * y0 - pad;
+            const int rowCount = 2 * (y1 - y0) + kernel.taps - 2;
+            const std::size_t dstRowFloats = static_cast<std::size_t>(dstWidth) * c;
+
+            scratch.linear.resize(static_cast<std::size_t>(srcWidth) * c);
+            scratch.padded.resize(static_cast<std::size_t>(paddedPixels) * c);
+            scratch.filtered.resize(static_cast<std::size_t>(rowCount) * dstRowFloats);
+            scratch.row.resize(dstRowFloats);
+
+            for (int r = 0; r < rowCount; ++r) {
+                const int sy = Resolve(firstRow + r, srcHeight, format.wrap);
+                const float* line;
+                if (source8) {
+                    LinearizeRow(source8 + static_cast<std::size_t>(sy) * srcWidth * c, srcWidth, format, scratch.linear.data());
+                    line = scratch.linear.data();
+                } else {
+                    line = sourceF + static_cast<std::size_t>(sy) * srcWidth * c;
+                }
+
+                // Pad by copying runs: the middle is one memcpy, edges repeat or wrap pixel by pixel
+                float* padded = scratch.padded.data();
+                const int middleEnd = std::min(paddedPixels, pad + srcWidth);
+                for (int i = 0; i < paddedPixels; ++i) {
+                    if (i == pad && middleEnd > pad) {
+                        std::memcpy(padded + i * c, line, static_cast<std::size_t>(middleEnd - pad) * c * sizeof(float));
+                        i = middleEnd - 1;
+                        continue;
+                    }
+                    std::memcpy(padded + i * c, line + Resolve(i - pad, srcWidth, format.wrap) * c, c * sizeof(float));
+                }
+                kernels.Horizontal(padded, dstWidth, c, kernel, scratch.filtered.data() + r * dstRowFloats);
+            }
+
+            std::array<const float*, kMaxTaps> rows{};
+            for (int y = y0; y < y1; ++y) {
+                for (int k = 0; k < kernel.taps; ++k) rows[k] = scratch.filtered.data() + (2 * (y - y0) + k) * dstRowFloats;
+                float* row = nextF ? nextF + static_cast<std::size_t>(y) * dstRowFloats : scratch.row.data();
+                kernels.Vertical(rows.data(), kernel, static_cast<int>(dstRowFloats), row);
+                EncodeRow(row, dstWidth, format, out8 + static_cast<std::size_t>(y) * dstRowFloats);
+            }
+        }
+    }
+
+    std::vector<Image> GenerateMips(const Image& source, const MipSettings& settings, ThreadPool& pool) {
+        if (source.channels != 1 && source.channels != 2 && source.channels != 4)
+            throw std::runtime_error("ERROR::MIP_GENERATOR::UNSUPPORTED_CHANNELS: " + std::to_string(source.channels));
+        if (source.width <= 0 || source.height <= 0 || source.pixels.size() != static_cast<std::size_t>(source.width) * source.height * source.channels)
+            throw std::runtime_error("ERROR::MIP_GENERATOR::INVALID_IMAGE");
+
+        Format format;
+        format.channels = source.channels;
+        format.alpha = source.channels == 4 ? 3 : source.channels == 2 ? 1 : -1;
+        format.srgb = settings.srgb;
+        format.premultiply = settings.premultiplyAlpha && format.alpha >= 0;
+        format.wrap = settings.wrap;
+        const Kernel kernel = MakeKernel(settings.filter);
+        const Kernels kernels{std::min(DetectSimdLevel(), settings.maxSimd)};
+
+        const int fullChain = std::bit_width(static_cast<unsigned int>(std::max(source.width, source.height)));
+        const int levelCount = settings.maxLevels > 0 ? std::min(settings.maxLevels, fullChain) : fullChain;
+
+        std::vector<Image> chain;
+        chain.reserve(levelCount);
+        chain.push_back(source);
+
+        std::vector<float> previous, next;
+        for (int level = 1; level < levelCount; ++level) {
+            Image& dst = chain.emplace_back();
+            const Image& from = chain[level - 1];   // no reallocation: reserved above
+            dst.width = std::max(from.width / 2, 1);
+            dst.height = std::max(from.height / 2, 1);
+            dst.channels = source.channels;
+            dst.pixels.resize(static_cast<std::size_t>(dst.width) * dst.height * dst.channels);
+            const bool last = level + 1 == levelCount;
+            next.resize(last ? 0 : dst.pixels.size());
+
+            const std::uint8_t* source8 = level == 1 ? from.pixels.data() : nullptr;
+            const float* sourceF = level == 1 ? nullptr : previous.data();
+            const int bands = (dst.height + kBandRows - 1) / kBandRows;
+            pool.ParallelFor(static_cast<std::size_t>(bands), [&](const std::size_t band) {
+                const int y0 = static_cast<int>(band) * kBandRows;
+                FilterBand(source8, sourceF, from.width, from.height, dst.width, y0, std::min(y0 + kBandRows, dst.height),
+                           format, kernel, kernels, last ? nullptr : next.data(), dst.pixels.data());
+            });
+            std::swap(previous, next);
+        }
+        return chain;
+    }
+
+    std::vector<std::vector<Image>> GenerateMips(const std::span<const Image> sources, const MipSettings& settings, ThreadPool& pool) {
+        std::vector<std::vector<Image>> chains(sources.size());
+        pool.ParallelFor(sources.size(), [&](const std::size_t i) { chains[i] = GenerateMips(sources[i], settings, pool); });
+        return chains;
+    }
+
+}
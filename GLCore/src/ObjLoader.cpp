@@ -0,0 +1,347 @@
+//
+// Created by niek on 11/19/2025.
+//
+
+#include "GLCore/ObjLoader.h"
+#include "GLCore/MappedFile.h"
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+
+namespace GLCore {
+
+    namespace {
+        using Clock = std::chrono::steady_clock;
+
+        constexpr std::uint32_t kAbsent = 0xFFFFFFFFu;
+        constexpr std::size_t kMinChunkBytes = std::size_t{1} << 20;
+        constexpr std::uint32_t kVertexSlice = 65536;
+
+        float Elapsed(const Clock::time_point start) {
+            return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+        }
+
+        /** @brief Resolved 0-based position / uv / normal indices of one face corner; uv and normal may be kAbsent. */
+        struct Corner {
+            std::uint32_t position = kAbsent, uv = kAbsent, normal = kAbsent;
+
+            bool operator==(const Corner&) const = default;
+        };
+
+        /**
+         * Insert-only open-addressing map Corner -> uint32 with linear probing, sized up front for `expected` keys.
+         * Slots with position == kAbsent are empty (every real corner has a position).
+         */
+        class CornerTable {
+        public:
+            explicit CornerTable(const std::size_t expected)
+                : mMask(std::bit_ceil(std::max<std::size_t>(expected * 2, 16)) - 1),
+                  mKeys(mMask + 1), mValues(mMask + 1) {}
+
+            // Returns the value stored for `corner`, inserting `value` first when it is new
+            std::pair<std::uint32_t, bool> Insert(const Corner& corner, const std::uint32_t value) {
+                for (std::size_t slot = Hash(corner) & mMask;; slot = (slot + 1) & mMask) {
+                    if (mKeys[slot].position == kAbsent) {
+                        mKeys[slot] = corner;
+                        mValues[slot] = value;
+                        return {value, true};
+                    }
+                    if (mKeys[slot] == corner) return {mValues[slot], false};
+                }
+            }
+
+        private:
+            static std::size_t Hash(const Corner& c) {
+                std::uint64_t h = c.position * 0x9E3779B97F4A7C15ull ^ c.uv * 0xC2B2AE3D27D4EB4Full ^ c.normal * 0x165667B19E3779F9ull;
+                h ^= h >> 29;
+                h *= 0xBF58476D1CE4E5B9ull;
+                return static_cast<std::size_t>(h ^ (h >> 32));
+            }
+
+            std::size_t mMask;
+            std::vector<Corner> mKeys;
+            std::vector<std::uint32_t> mValues;
+        };
+
+        /**
+         * Everything one line-aligned slice of the file contributes.
+         * Face indices are stored as read: `absolute` 0-based, or chunk-`local` for negative OBJ indices (bit set in
+         * `relative`), because the number of attributes in earlier chunks is unknown until all chunks are parsed.
+         */
+        struct Chunk {
+            struct Group {
+                std::string name;
+                std::uint32_t firstTriangle = 0;   // chunk-local
+            };
+
+            std::vector<glm::vec3> positions, normals;
+            std::vector<glm::vec2> uvs;
+            std::vector<std::int64_t> rawCorners;   // 3 per corner; -1 with no relative bit = absent
+            std::vector<std::uint8_t> relative;     // per corner: bit 0 position, 1 uv, 2 normal
+            std::vector<std::uint32_t> polygonSizes;
+            std::vector<Group> groups;
+            std::uint32_t triangles = 0;
+
+            // Filled by the merge passes
+            std::vector<std::uint32_t> localIndices;    // per corner, into `uniques`
+            std::vector<Corner> uniques;                // first-use order within the chunk
+            std::vector<std::uint32_t> remap;           // uniques -> global vertex
+            std::uint32_t positionBase = 0, uvBase = 0, normalBase = 0, triangleBase = 0;
+        };
+
+        bool IsBlank(const char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+        const char* SkipBlanks(const char* cursor, const char* end) {
+            while (cursor < end && IsBlank(*cursor)) ++cursor;
+            return cursor;
+        }
+
+        // Reads up to N floats; missing or malformed components stay 0 (strtof behaviour)
+        template<int N>
+        glm::vec<N, float> ParseFloats(const char* cursor, const char* end) {
+            glm::vec<N, float> value(0.0f);
+            for (int i = 0; i < N; ++i) {
+                cursor = SkipBlanks(cursor, end);
+                if (cursor < end && *cursor == '+') ++cursor;
+                const auto [next, error] = std::from_chars(cursor, end, value[i]);
+                if (error != std::errc{}) break;
+                cursor = next;
+            }
+            return value;
+        }
+
+        bool ParseIndex(const char*& cursor, const char* end, std::int64_t& value) {
+            const auto [next, error] = std::from_chars(cursor, end, value);
+            if (error != std::errc{}) return false;
+            cursor = next;
+            return true;
+        }
+
+        void ParseChunk(const char* cursor, const char* end, Chunk& chunk) {
+            while (cursor < end) {
+                const auto* newline = static_cast<const char*>(std::memchr(cursor, '\n', static_cast<std::size_t>(end - cursor)));
+                const char* lineEnd = newline ? newline : end;
+                const char* line = SkipBlanks(cursor, lineEnd);
+                cursor = newline ? newline + 1 : end;
+                if (lineEnd - line < 2) continue;
+
+                const char kind = line[0];
+                if (kind == 'v') {
+                    if (IsBlank(line[1])) chunk.positions.push_back(ParseFloats<3>(line + 1, lineEnd));
+                    else if (line[1] == 't' && lineEnd - line > 2 && IsBlank(line[2])) chunk.uvs.push_back(ParseFloats<2>(line + 2, lineEnd));
+                    else if (line[1] == 'n' && lineEnd - line > 2 && IsBlank(line[2])) chunk.normals.push_back(ParseFloats<3>(line + 2, lineEnd));
+                } else if (kind == 'f' && IsBlank(line[1])) {
+                    const std::int64_t counts[3] = {static_cast<std::int64_t>(chunk.positions.size()),
+                                                    static_cast<std::int64_t>(chunk.uvs.size()),
+                                                    static_cast<std::int64_t>(chunk.normals.size())};
+                    std::uint32_t corners = 0;
+                    const char* at = line + 1;
+                    for (;;) {
+                        at = SkipBlanks(at, lineEnd);
+                        std::int64_t raw[3] = {0, 0, 0};
+                        if (!ParseIndex(at, lineEnd, raw[0])) break;
+                        if (at < lineEnd && *at == '/') {
+                            ++at;
+                            if (at < lineEnd && *at != '/') ParseIndex(at, lineEnd, raw[1]);
+                            if (at < lineEnd && *at == '/') {
+                                ++at;
+                                ParseIndex(at, lineEnd, raw[2]);
+                            }
+                        }
+
+                        std::uint8_t relative = 0;
+                        for (int a = 0; a < 3; ++a) {
+                            if (raw[a] > 0) {
+                                chunk.rawCorners.push_back(raw[a] - 1);
+                            } else if (raw[a] < 0) {
+                                chunk.rawCorners.push_back(counts[a] + raw[a]);
+                                relative |= static_cast<std::uint8_t>(1u << a);
+                            } else {
+                                chunk.rawCorners.push_back(-1);
+                            }
+                        }
+                        chunk.relative.push_back(relative);
+                        ++corners;
+                    }
+                    chunk.polygonSizes.push_back(corners);
+                    if (corners >= 3) chunk.triangles += corners - 2;
+                } else if ((kind == 'g' || kind == 'o') && IsBlank(line[1])) {
+                    const char* nameBegin = SkipBlanks(line + 1, lineEnd);
+                    const char* nameEnd = lineEnd;
+                    while (nameEnd > nameBegin && std::isspace(static_cast<unsigned char>(nameEnd[-1]))) --nameEnd;
+                    chunk.groups.push_back({std::string(nameBegin, nameEnd), chunk.triangles});
+                }
+            }
+        }
+    }
+
+    MeshData LoadObj(const std::string& path, ThreadPool& pool, ObjLoadStats* stats) {
+        const auto start = Clock::now();
+        const MappedFile file = [&path] {
+            try {
+                return MappedFile(path);
+            } catch (const std::runtime_error&) {
+                throw std::runtime_error("ERROR::MESH::FILE_NOT_FOUND: " + path);
+            }
+        }();
+        const std::string_view text = file.Text();
+        const unsigned int threads = pool.ThreadCount() + 1;
+
+        // Line-aligned chunks: several per thread for balance, but not so small that bookkeeping dominates
+        const std::size_t chunkCount = std::clamp<std::size_t>(text.size() / kMinChunkBytes, 1, threads * 8);
+        std::vector<std::size_t> bounds{0};
+        for (std::size_t c = 1; c < chunkCount; ++c) {
+            std::size_t split = std::max(text.size() * c / chunkCount, bounds.back());
+            const std::size_t newline = text.find('\n', split);
+            split = newline == std::string_view::npos ? text.size() : newline + 1;
+            if (split > bounds.back() && split < text.size()) bounds.push_back(split);
+        }
+        bounds.push_back(text.size());
+
+        std::vector<Chunk> chunks(bounds.size() - 1);
+        const auto parseStart = Clock::now();
+        pool.ParallelFor(chunks.size(), [&](const std::size_t c) {
+            ParseChunk(text.data() + bounds[c], text.data() + bounds[c + 1], chunks[c]);
+        });
+        const float parseMs = Elapsed(parseStart);
+
+        // Attribute bases per chunk, then concatenate the attribute arrays in file order
+        const auto mergeStart = Clock::now();
+        std::uint64_t positionTotal = 0, uvTotal = 0, normalTotal = 0, triangleTotal = 0, cornerTotal = 0;
+        for (Chunk& chunk : chunks) {
+            chunk.positionBase = static_cast<std::uint32_t>(positionTotal);
+            chunk.uvBase = static_cast<std::uint32_t>(uvTotal);
+            chunk.normalBase = static_cast<std::uint32_t>(normalTotal);
+            chunk.triangleBase = static_cast<std::uint32_t>(triangleTotal);
+            positionTotal += chunk.positions.size();
+            uvTotal += chunk.uvs.size();
+            normalTotal += chunk.normals.size();
+            triangleTotal += chunk.triangles;
+            cornerTotal += chunk.relative.size();
+        }
+        if (positionTotal >= kAbsent || uvTotal >= kAbsent || normalTotal >= kAbsent || triangleTotal * 3 >= kAbsent)
+            throw std::runtime_error("ERROR::MESH::TOO_LARGE: " + path);
+
+        std::vector<glm::vec3> positions(positionTotal), normals(normalTotal);
+        std::vector<glm::vec2> uvs(uvTotal);
+        pool.ParallelFor(chunks.size(), [&](const std::size_t c) {
+            Chunk& chunk = chunks[c];
+            std::ranges::copy(chunk.positions, positions.begin() + chunk.positionBase);
+            std::ranges::copy(chunk.uvs, uvs.begin() + chunk.uvBase);
+            std::ranges::copy(chunk.normals, normals.begin() + chunk.normalBase);
+            chunk.positions = {};
+            chunk.uvs = {};
+            chunk.normals = {};
+        });
+        const float mergeMs = Elapsed(mergeStart);
+
+        // Resolve each corner globally and deduplicate within the chunk
+        const auto dedupStart = Clock::now();
+        pool.ParallelFor(chunks.size(), [&](const std::size_t c) {
+            Chunk& chunk = chunks[c];
+            const std::size_t cornerCount = chunk.relative.size();
+            const std::int64_t bases[3] = {chunk.positionBase, chunk.uvBase, chunk.normalBase};
+            const std::int64_t totals[3] = {static_cast<std::int64_t>(positionTotal), static_cast<std::int64_t>(uvTotal),
+                                            static_cast<std::int64_t>(normalTotal)};
+
+            CornerTable table(cornerCount);
+            chunk.localIndices.resize(cornerCount);
+            for (std::size_t i = 0; i < cornerCount; ++i) {
+                std::uint32_t resolved[3];
+                for (int a = 0; a < 3; ++a) {
+                    std::int64_t index = chunk.rawCorners[i * 3 + a];
+                    if (chunk.relative[i] & (1u << a)) index += bases[a];
+                    else if (index < 0) index = -1;
+                    resolved[a] = index >= 0 && index < totals[a] ? static_cast<std::uint32_t>(index) : kAbsent;
+                }
+                if (resolved[0] == kAbsent) throw std::runtime_error("ERROR::MESH::INVALID_INDEX: " + path);
+
+                const Corner corner{resolved[0], resolved[1], resolved[2]};
+                const auto [local, inserted] = table.Insert(corner, static_cast<std::uint32_t>(chunk.uniques.size()));
+                if (inserted) chunk.uniques.push_back(corner);
+                chunk.localIndices[i] = local;
+            }
+            chunk.rawCorners = {};
+            chunk.relative = {};
+        });
+
+        // Global numbering in first-use order: serial over the (much shorter) per-chunk unique lists
+        std::size_t uniqueTotal = 0;
+        for (const Chunk& chunk : chunks) uniqueTotal += chunk.uniques.size();
+        CornerTable global(uniqueTotal);
+        std::vector<Corner> vertexCorners;
+        vertexCorners.reserve(uniqueTotal);
+        for (Chunk& chunk : chunks) {
+            chunk.remap.resize(chunk.uniques.size());
+            for (std::size_t u = 0; u < chunk.uniques.size(); ++u) {
+                const auto [index, inserted] = global.Insert(chunk.uniques[u], static_cast<std::uint32_t>(vertexCorners.size()));
+                if (inserted) vertexCorners.push_back(chunk.uniques[u]);
+                chunk.remap[u] = index;
+            }
+            chunk.uniques = {};
+        }
+
+        MeshData mesh;
+        mesh.vertices.resize(vertexCorners.size());
+        mesh.indices.resize(triangleTotal * 3);
+        const std::size_t vertexSlices = (vertexCorners.size() + kVertexSlice - 1) / kVertexSlice;
+        pool.ParallelFor(vertexSlices + chunks.size(), [&](const std::size_t job) {
+            if (job < vertexSlices) {
+                const std::size_t end = std::min(vertexCorners.size(), (job + 1) * kVertexSlice);
+                for (std::size_t v = job * kVertexSlice; v < end; ++v) {
+                    const Corner& corner = vertexCorners[v];
+                    MeshVertex& vertex = mesh.vertices[v];
+                    vertex.position = positions[corner.position];
+                    if (corner.uv != kAbsent) vertex.uv = uvs[corner.uv];
+                    if (corner.normal != kAbsent) vertex.normal = normals[corner.normal];
+                }
+                return;
+            }
+
+            // Fan-triangulate this chunk's polygons into its slice of the index buffer
+            const Chunk& chunk = chunks[job - vertexSlices];
+            std::uint32_t* out = mesh.indices.data() + static_cast<std::size_t>(chunk.triangleBase) * 3;
+            std::size_t corner = 0;
+            for (const std::uint32_t size : chunk.polygonSizes) {
+                const std::uint32_t* polygon = chunk.localIndices.data() + corner;
+                for (std::uint32_t i = 2; i < size; ++i) {
+                    *out++ = chunk.remap[polygon[0]];
+                    *out++ = chunk.remap[polygon[i - 1]];
+                    *out++ = chunk.remap[polygon[i]];
+                }
+                corner += size;
+            }
+        });
+
+        for (const Chunk& chunk : chunks)
+            for (const Chunk::Group& group : chunk.groups)
+                mesh.groups.push_back({group.name, (chunk.triangleBase + group.firstTriangle) * 3, 0});
+        for (std::size_t g = 0; g < mesh.groups.size(); ++g) {
+            const std::uint32_t next = g + 1 < mesh.groups.size() ? mesh.groups[g + 1].firstIndex
+                                                                  : static_cast<std::uint32_t>(mesh.indices.size());
+            mesh.groups[g].indexCount = next - mesh.groups[g].firstIndex;
+        }
+
+        if (stats) {
+            stats->bytes = text.size();
+            stats->chunks = static_cast<std::uint32_t>(chunks.size());
+            stats->threads = threads;
+            stats->corners = cornerTotal;
+            stats->parseMs = parseMs;
+            stats->mergeMs = mergeMs;
+            stats->dedupMs = Elapsed(dedupStart);
+            stats->totalMs = Elapsed(start);
+            stats->megabytesPerSecond = stats->totalMs > 0.0f
+                ? static_cast<float>(static_cast<double>(stats->bytes) / (1024.0 * 1024.0) / (stats->totalMs / 1000.0))
+                : 0.0f;
+        }
+        return mesh;
+    }
+
+}
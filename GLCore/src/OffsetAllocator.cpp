@@ -0,0 +1,220 @@
+//
+// Created by niek on 11/12/2025.
+//
+
+#include "GLCore/OffsetAllocator.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace GLCore {
+
+    namespace {
+        constexpr std::uint32_t kMantissaBits = 3;
+        constexpr std::uint32_t kMantissaValue = 1u << kMantissaBits;
+        constexpr std::uint32_t kMantissaMask = kMantissaValue - 1;
+
+        // Size -> bin as a tiny float (exponent + 3-bit mantissa), rounding up: any range in the
+        // returned bin or above is large enough.
+        std::uint32_t SizeToBinRoundUp(const std::uint32_t size) {
+            if (size < kMantissaValue) return size; // denormals map 1:1
+            const std::uint32_t highestBit = 31 - std::countl_zero(size);
+            const std::uint32_t mantissaStart = highestBit - kMantissaBits;
+            const std::uint32_t exponent = mantissaStart + 1;
+            std::uint32_t mantissa = (size >> mantissaStart) & kMantissaMask;
+            if (size & ((1u << mantissaStart) - 1)) ++mantissa; // may carry into the exponent, which is intended
+            return (exponent << kMantissaBits) + mantissa;
+        }
+
+        // Rounding down: every size in the returned bin is at least the bin's value
+        std::uint32_t SizeToBinRoundDown(const std::uint32_t size) {
+            if (size < kMantissaValue) return size;
+            const std::uint32_t highestBit = 31 - std::countl_zero(size);
+            const std::uint32_t mantissaStart = highestBit - kMantissaBits;
+            const std::uint32_t exponent = mantissaStart + 1;
+            const std::uint32_t mantissa = (size >> mantissaStart) & kMantissaMask;
+            return (exponent << kMantissaBits) | mantissa;
+        }
+
+        std::uint32_t LowestSetBitFrom(const std::uint32_t mask, const std::uint32_t start) {
+            if (start >= 32) return OffsetAllocator::kNoSpace;
+            const std::uint32_t masked = mask & ~((1u << start) - 1);
+            return masked ? static_cast<std::uint32_t>(std::countr_zero(masked)) : OffsetAllocator::kNoSpace;
+        }
+    }
+
+    OffsetAllocator::OffsetAllocator(const std::uint32_t size) {
+        Reset(size);
+    }
+
+    void OffsetAllocator::Reset(const std::uint32_t size) {
+        mSize = size;
+        mFreeStorage = 0;
+        mUsedBinsTop = 0;
+        mUsedBins.fill(0);
+        mBinHeads.fill(kUnused);
+        mNodes.clear();
+        mFreeNodes.clear();
+        if (size > 0) InsertFreeNode(0, size);
+    }
+
+    std::uint32_t OffsetAllocator::NewNode() {
+        if (!mFreeNodes.empty()) {
+            const std::uint32_t index = mFreeNodes.back();
+            mFreeNodes.pop_back();
+            return index;
+        }
+        mNodes.emplace_back();
+        return static_cast<std::uint32_t>(mNodes.size() - 1);
+    }
+
+    std::uint32_t OffsetAllocator::InsertFreeNode(const std::uint32_t offset, const std::uint32_t size) {
+        const std::uint32_t bin = SizeToBinRoundDown(size);
+        const std::uint32_t top = bin >> kMantissaBits;
+        const std::uint32_t leaf = bin & kMantissaMask;
+
+        if (mBinHeads[bin] == kUnused) {
+            mUsedBins[top] |= static_cast<std::uint8_t>(1u << leaf);
+            mUsedBinsTop |= 1u << top;
+        }
+
+        const std::uint32_t index = NewNode();
+        const std::uint32_t head = mBinHeads[bin];
+        mNodes[index] = Node{offset, size, kUnused, head, kUnused, kUnused, false};
+        if (head != kUnused) mNodes[head].binPrev = index;
+        mBinHeads[bin] = index;
+
+        mFreeStorage += size;
+        return index;
+    }
+
+    void OffsetAllocator::RemoveFreeNode(const std::uint32_t nodeIndex) {
+        UnlinkFreeNode(nodeIndex);
+        mFreeNodes.push_back(nodeIndex);
+    }
+
+    void OffsetAllocator::UnlinkFreeNode(const std::uint32_t nodeIndex) {
+        const Node& node = mNodes[nodeIndex];
+        if (node.binPrev != kUnused) {
+            mNodes[node.binPrev].binNext = node.binNext;
+            if (node.binNext != kUnused) mNodes[node.binNext].binPrev = node.binPrev;
+        } else {
+            // Head of its bin
+            const std::uint32_t bin = SizeToBinRoundDown(node.size);
+            const std::uint32_t top = bin >> kMantissaBits;
+            const std::uint32_t leaf = bin & kMantissaMask;
+            mBinHeads[bin] = node.binNext;
+            if (node.binNext != kUnused) {
+                mNodes[node.binNext].binPrev = kUnused;
+            } else {
+                mUsedBins[top] &= static_cast<std::uint8_t>(~(1u << leaf));
+                if (mUsedBins[top] == 0) mUsedBinsTop &= ~(1u << top);
+            }
+        }
+        mFreeStorage -= node.size;
+    }
+
+    OffsetAllocator::Allocation OffsetAllocator::Allocate(const std::uint32_t size) {
+        if (size == 0 || size > mFreeStorage) return {};
+
+        // First bin that fits: same top bin with a larger leaf, otherwise the next used top bin
+        const std::uint32_t minBin = SizeToBinRoundUp(size);
+        const std::uint32_t minTop = minBin >> kMantissaBits;
+        const std::uint32_t minLeaf = minBin & kMantissaMask;
+
+        std::uint32_t top = minTop;
+        std::uint32_t leaf = kNoSpace;
+        if (top < kTopBins && (mUsedBinsTop & (1u << top)))
+            leaf = LowestSetBitFrom(mUsedBins[top], minLeaf);
+        if (leaf == kNoSpace) {
+            top = LowestSetBitFrom(mUsedBinsTop, minTop + 1);
+            if (top < kTopBins) leaf = static_cast<std::uint32_t>(std::countr_zero(static_cast<std::uint32_t>(mUsedBins[top])));
+        }
+
+        std::uint32_t nodeIndex = leaf != kNoSpace ? mBinHeads[top << kMantissaBits | leaf] : kUnused;
+        if (nodeIndex == kUnused) {
+            // Nothing in a bin that is guaranteed to fit, but the bin the size rounds down to spans sizes up to the
+            // next bin, so a range there can still be large enough (an exact fit, for one). Linear in that bin only.
+            for (std::uint32_t i = mBinHeads[SizeToBinRoundDown(size)]; i != kUnused; i = mNodes[i].binNext) {
+                if (mNodes[i].size >= size) {
+                    nodeIndex = i;
+                    break;
+                }
+            }
+            if (nodeIndex == kUnused) return {};
+        }
+
+        const std::uint32_t nodeSize = mNodes[nodeIndex].size;
+        UnlinkFreeNode(nodeIndex);
+
+        Node& node = mNodes[nodeIndex];
+        node.used = true;
+        node.size = size;
+        node.binPrev = kUnused;
+        node.binNext = kUnused;
+
+        // Return the tail to the free lists as the new right neighbor
+        if (const std::uint32_t remainder = nodeSize - size; remainder > 0) {
+            const std::uint32_t rightOffset = mNodes[nodeIndex].offset + size;
+            const std::uint32_t right = InsertFreeNode(rightOffset, remainder);
+            const std::uint32_t oldNext = mNodes[nodeIndex].neighborNext;
+            if (oldNext != kUnused) mNodes[oldNext].neighborPrev = right;
+            mNodes[right].neighborPrev = nodeIndex;
+            mNodes[right].neighborNext = oldNext;
+            mNodes[nodeIndex].neighborNext = right;
+        }
+
+        return {mNodes[nodeIndex].offset, nodeIndex};
+    }
+
+    void OffsetAllocator::Free(const Allocation allocation) {
+        if (!allocation.Valid() || allocation.metadata >= mNodes.size()) return;
+        const std::uint32_t nodeIndex = allocation.metadata;
+        if (!mNodes[nodeIndex].used) return;
+
+        std::uint32_t offset = mNodes[nodeIndex].offset;
+        std::uint32_t size = mNodes[nodeIndex].size;
+        std::uint32_t neighborPrev = mNodes[nodeIndex].neighborPrev;
+        std::uint32_t neighborNext = mNodes[nodeIndex].neighborNext;
+
+        // Merge with free neighbors
+        if (neighborPrev != kUnused && !mNodes[neighborPrev].used) {
+            const Node prev = mNodes[neighborPrev];
+            offset = prev.offset;
+            size += prev.size;
+            RemoveFreeNode(neighborPrev);
+            neighborPrev = prev.neighborPrev;
+        }
+        if (neighborNext != kUnused && !mNodes[neighborNext].used) {
+            const Node next = mNodes[neighborNext];
+            size += next.size;
+            RemoveFreeNode(neighborNext);
+            neighborNext = next.neighborNext;
+        }
+        mFreeNodes.push_back(nodeIndex);
+
+        const std::uint32_t merged = InsertFreeNode(offset, size);
+        mNodes[merged].neighborPrev = neighborPrev;
+        mNodes[merged].neighborNext = neighborNext;
+        if (neighborPrev != kUnused) mNodes[neighborPrev].neighborNext = merged;
+        if (neighborNext != kUnused) mNodes[neighborNext].neighborPrev = merged;
+    }
+
+    std::uint32_t OffsetAllocator::AllocationSize(const Allocation allocation) const {
+        if (!allocation.Valid() || allocation.metadata >= mNodes.size()) return 0;
+        return mNodes[allocation.metadata].size;
+    }
+
+    OffsetAllocator::StorageReport OffsetAllocator::GetStorageReport() const {
+        StorageReport report{mFreeStorage, 0};
+        if (mUsedBinsTop) {
+            const std::uint32_t top = 31 - std::countl_zero(mUsedBinsTop);
+            const std::uint32_t leaf = 31 - std::countl_zero(static_cast<std::uint32_t>(mUsedBins[top]));
+            // The largest bin can hold ranges of different sizes, so scan just that one list
+            for (std::uint32_t i = mBinHeads[top << kMantissaBits | leaf]; i != kUnused; i = mNodes[i].binNext)
+                report.largestFree = std::max(report.largestFree, mNodes[i].size);
+        }
+        return report;
+    }
+
+}
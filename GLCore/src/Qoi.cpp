@@ -0,0 +1,209 @@
+//
+// Created by niek on 11/28/2025.
+//
+
+#include "GLCore/Qoi.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace GLCore {
+
+    namespace {
+        constexpr std::uint8_t kOpIndex = 0x00;
+        constexpr std::uint8_t kOpDiff = 0x40;
+        constexpr std::uint8_t kOpLuma = 0x80;
+        constexpr std::uint8_t kOpRun = 0xC0;
+        constexpr std::uint8_t kOpRgb = 0xFE;
+        constexpr std::uint8_t kOpRgba = 0xFF;
+        constexpr std::uint8_t kMask = 0xC0;
+        constexpr std::size_t kHeaderSize = 14;
+        constexpr std::uint8_t kPadding[8] = {0, 0, 0, 0, 0, 0, 0, 1};
+        constexpr std::uint64_t kMaxPixels = 400'000'000;   // the reference implementation's limit
+        constexpr int kMaxRun = 62;
+
+        struct Rgba {
+            std::uint8_t r = 0, g = 0, b = 0, a = 255;
+
+            bool operator==(const Rgba&) const = default;
+        };
+
+        unsigned int Hash(const Rgba& p) {
+            return (p.r * 3u + p.g * 5u + p.b * 7u + p.a * 11u) % 64u;
+        }
+
+        std::uint32_t ReadBigEndian(const std::uint8_t* p) {
+            return static_cast<std::uint32_t>(p[0]) << 24 | static_cast<std::uint32_t>(p[1]) << 16
+                   | static_cast<std::uint32_t>(p[2]) << 8 | p[3];
+        }
+
+        void AppendBigEndian(std::vector<std::uint8_t>& out, const std::uint32_t value) {
+            out.insert(out.end(), {static_cast<std::uint8_t>(value >> 24), static_cast<std::uint8_t>(value >> 16),
+                                   static_cast<std::uint8_t>(value >> 8), static_cast<std::uint8_t>(value)});
+        }
+
+        Rgba Fetch(const std::uint8_t* p, const int channels) {
+            switch (channels) {
+                case 1: return {p[0], p[0], p[0], 255};
+                case 2: return {p[0], p[0], p[0], p[1]};
+                case 3: return {p[0], p[1], p[2], 255};
+                default: return {p[0], p[1], p[2], p[3]};
+            }
+        }
+    }
+
+    bool IsQoi(const std::span<const std::byte> encoded) {
+        return encoded.size() >= 4 && std::memcmp(encoded.data(), "qoif", 4) == 0;
+    }
+
+    std::vector<std::uint8_t> EncodeQoi(const Image& image, const bool flipVertically, const bool srgb) {
+        const int width = image.width, height = image.height, channels = image.channels;
+        if (width <= 0 || height <= 0 || channels < 1 || channels > 4
+            || image.pixels.size() != static_cast<std::size_t>(width) * height * channels
+            || static_cast<std::uint64_t>(width) * height > kMaxPixels)
+            throw std::runtime_error("ERROR::IMAGE::INVALID_IMAGE: QOI encode");
+
+        bool alpha = channels == 2;
+        if (channels == 4) {
+            for (std::size_t i = 3; i < image.pixels.size() && !alpha; i += 4) alpha = image.pixels[i] != 255;
+        }
+
+        std::vector<std::uint8_t> out;
+        out.reserve(kHeaderSize + static_cast<std::size_t>(width) * height * (alpha ? 5 : 4) + sizeof(kPadding));
+        out.insert(out.end(), {'q', 'o', 'i', 'f'});
+        AppendBigEndian(out, static_cast<std::uint32_t>(width));
+        AppendBigEndian(out, static_cast<std::uint32_t>(height));
+        out.push_back(alpha ? 4 : 3);
+        out.push_back(srgb ? 0 : 1);
+
+        Rgba index[64]{};
+        for (Rgba& entry : index) entry.a = 0;
+        Rgba previous;
+        int run = 0;
+        const std::size_t rowBytes = static_cast<std::size_t>(width) * channels;
+        for (int row = 0; row < height; ++row) {
+            const std::uint8_t* in = image.pixels.data() + static_cast<std::size_t>(flipVertically ? height - 1 - row : row) * rowBytes;
+            for (int x = 0; x < width; ++x, in += channels) {
+                const Rgba pixel = Fetch(in, channels);
+                if (pixel == previous) {
+                    if (++run == kMaxRun) {
+                        out.push_back(static_cast<std::uint8_t>(kOpRun | (run - 1)));
+                        run = 0;
+                    }
+                    continue;
+                }
+                if (run > 0) {
+                    out.push_back(static_cast<std::uint8_t>(kOpRun | (run - 1)));
+                    run = 0;
+                }
+
+                const unsigned int hash = Hash(pixel);
+                if (index[hash] == pixel) {
+                    out.push_back(static_cast<std::uint8_t>(kOpIndex | hash));
+                } else {
+                    index[hash] = pixel;
+                    if (pixel.a == previous.a) {
+                        const auto dr = static_cast<std::int8_t>(pixel.r - previous.r);
+                        const auto dg = static_cast<std::int8_t>(pixel.g - previous.g);
+                        const auto db = static_cast<std::int8_t>(pixel.b - previous.b);
+                        const int drg = dr - dg, dbg = db - dg;
+                        if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+                            out.push_back(static_cast<std::uint8_t>(kOpDiff | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2)));
+                        } else if (dg >= -32 && dg <= 31 && drg >= -8 && drg <= 7 && dbg >= -8 && dbg <= 7) {
+                            out.push_back(static_cast<std::uint8_t>(kOpLuma | (dg + 32)));
+                            out.push_back(static_cast<std::uint8_t>((drg + 8) << 4 | (dbg + 8)));
+                        } else {
+                            out.insert(out.end(), {kOpRgb, pixel.r, pixel.g, pixel.b});
+                        }
+                    } else {
+                        out.insert(out.end(), {kOpRgba, pixel.r, pixel.g, pixel.b, pixel.a});
+                    }
+                }
+                previous = pixel;
+            }
+        }
+        if (run > 0) out.push_back(static_cast<std::uint8_t>(kOpRun | (run - 1)));
+        out.insert(out.end(), std::begin(kPadding), std::end(kPadding));
+        return out;
+    }
+
+    Image DecodeQoi(const std::span<const std::byte> encoded, const bool flipVertically, const std::string& name) {
+        const auto fail = [&name](const char* what) {
+            return std::runtime_error("ERROR::IMAGE::DECODE_FAILED: " + name + " (QOI: " + what + ")");
+        };
+        if (encoded.size() < kHeaderSize + sizeof(kPadding) || !IsQoi(encoded)) throw fail("not a QOI file");
+        const auto* data = reinterpret_cast<const std::uint8_t*>(encoded.data());
+        const std::uint32_t width = ReadBigEndian(data + 4), height = ReadBigEndian(data + 8);
+        if (width == 0 || height == 0 || (data[12] != 3 && data[12] != 4) || data[13] > 1) throw fail("invalid header");
+
+        // A run byte covers at most 62 pixels: anything claiming more is truncated (and not worth allocating for)
+        const std::uint64_t pixels = static_cast<std::uint64_t>(width) * height;
+        const std::size_t chunkBytes = encoded.size() - kHeaderSize - sizeof(kPadding);
+        if (pixels > kMaxPixels || pixels > static_cast<std::uint64_t>(chunkBytes) * kMaxRun) throw fail("truncated");
+
+        Image image{static_cast<int>(width), static_cast<int>(height), 4, {}};
+        image.pixels.resize(static_cast<std::size_t>(pixels) * 4);
+
+        // Ops read at most 5 bytes and the 8 padding bytes follow the last one, so one check per op is enough
+        const std::uint8_t* p = data + kHeaderSize;
+        const std::uint8_t* const end = data + encoded.size() - sizeof(kPadding);
+        Rgba index[64]{};
+        for (Rgba& entry : index) entry.a = 0;
+        Rgba pixel;
+        int run = 0;
+        const std::size_t rowBytes = static_cast<std::size_t>(width) * 4;
+        for (std::uint32_t row = 0; row < height; ++row) {
+            std::uint8_t* out = image.pixels.data() + (flipVertically ? height - 1 - row : row) * rowBytes;
+            std::uint8_t* const rowEnd = out + rowBytes;
+            while (out < rowEnd) {
+                if (run > 0) {
+                    // The rest of a run, possibly from the previous row
+                    const int count = std::min(run, static_cast<int>((rowEnd - out) / 4));
+                    for (int i = 0; i < count; ++i, out += 4) std::memcpy(out, &pixel, 4);
+                    run -= count;
+                    continue;
+                }
+                if (p >= end) throw fail("truncated");
+
+                const std::uint8_t op = *p++;
+                if (op == kOpRgb) {
+                    pixel.r = p[0];
+                    pixel.g = p[1];
+                    pixel.b = p[2];
+                    p += 3;
+                } else if (op == kOpRgba) {
+                    pixel = {p[0], p[1], p[2], p[3]};
+                    p += 4;
+                } else {
+                    switch (op & kMask) {
+                        case kOpIndex:
+                            pixel = index[op];
+                            break;
+                        case kOpDiff:
+                            pixel.r = static_cast<std::uint8_t>(pixel.r + ((op >> 4) & 3) - 2);
+                            pixel.g = static_cast<std::uint8_t>(pixel.g + ((op >> 2) & 3) - 2);
+                            pixel.b = static_cast<std::uint8_t>(pixel.b + (op & 3) - 2);
+                            break;
+                        case kOpLuma: {
+                            const int dg = (op & 0x3F) - 32;
+                            const std::uint8_t next = *p++;
+                            pixel.r = static_cast<std::uint8_t>(pixel.r + dg - 8 + (next >> 4));
+                            pixel.g = static_cast<std::uint8_t>(pixel.g + dg);
+                            pixel.b = static_cast<std::uint8_t>(pixel.b + dg - 8 + (next & 0x0F));
+                            break;
+                        }
+                        default:
+                            run = (op & 0x3F) + 1;
+                            continue;
+                    }
+                }
+                index[Hash(pixel)] = pixel;
+                std::memcpy(out, &pixel, 4);
+                out += 4;
+            }
+        }
+        return image;
+    }
+
+}
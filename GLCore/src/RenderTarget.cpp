@@ -0,0 +1,144 @@
+//
+// Created by niek on 11/7/2025.
+//
+
+#include "GLCore/RenderTarget.h"
+#include "GLCore/Caps.h"
+#include "GLCore/Debug.h"
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+namespace GLCore {
+
+    RenderTarget::RenderTarget(const int width, const int height, const GLenum colorFormat, const bool depth)
+        : mColorFormat(colorFormat), mWidth(width), mHeight(height),
+          mAllocatedWidth(width), mAllocatedHeight(height) {
+        if (Caps::Get().directStateAccess) {
+            // Bind-free path
+            glCreateFramebuffers(1, &mFramebuffer);
+            glCreateTextures(GL_TEXTURE_2D, 1, &mColor);
+            glTextureStorage2D(mColor, 1, colorFormat, width, height);
+            glTextureParameteri(mColor, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTextureParameteri(mColor, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTextureParameteri(mColor, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTextureParameteri(mColor, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glNamedFramebufferTexture(mFramebuffer, GL_COLOR_ATTACHMENT0, mColor, 0);
+
+            if (depth) {
+                glCreateRenderbuffers(1, &mDepth);
+                glNamedRenderbufferStorage(mDepth, GL_DEPTH24_STENCIL8, width, height);
+                glNamedFramebufferRenderbuffer(mFramebuffer, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, mDepth);
+            }
+
+            if (glCheckNamedFramebufferStatus(mFramebuffer, GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+                std::cerr << "ERROR::RENDER_TARGET::FRAMEBUFFER_INCOMPLETE" << std::endl;
+        } else {
+            glGenFramebuffers(1, &mFramebuffer);
+            glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+
+            glGenTextures(1, &mColor);
+            glBindTexture(GL_TEXTURE_2D, mColor);
+            glTexImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(colorFormat), width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glBindTexture(GL_TEXTURE_2D, 0);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mColor, 0);
+
+            if (depth) {
+                glGenRenderbuffers(1, &mDepth);
+                glBindRenderbuffer(GL_RENDERBUFFER, mDepth);
+                glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+                glBindRenderbuffer(GL_RENDERBUFFER, 0);
+                glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, mDepth);
+            }
+
+            if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+                std::cerr << "ERROR::RENDER_TARGET::FRAMEBUFFER_INCOMPLETE" << std::endl;
+            glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        }
+
+        const std::string label = "RenderTarget " + std::to_string(width) + "x" + std::to_string(height);
+        Debug::Label(GL_FRAMEBUFFER, mFramebuffer, label);
+        Debug::Label(GL_TEXTURE, mColor, label + " color");
+        Debug::Label(GL_RENDERBUFFER, mDepth, label + " depth");
+    }
+
+    RenderTarget::~RenderTarget() {
+        if (mDepth) glDeleteRenderbuffers(1, &mDepth);
+        if (mColor) glDeleteTextures(1, &mColor);
+        if (mFramebuffer) glDeleteFramebuffers(1, &mFramebuffer);
+    }
+
+    void RenderTarget::Bind() const {
+        glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+        glViewport(0, 0, mWidth, mHeight);
+    }
+
+    void RenderTarget::Unbind() {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+
+    void RenderTarget::BlitToScreen(const int width, const int height) const {
+        if (Caps::Get().directStateAccess) {
+            glBlitNamedFramebuffer(mFramebuffer, 0, 0, 0, mWidth, mHeight, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+            return;
+        }
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, mFramebuffer);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+        glBlitFramebuffer(0, 0, mWidth, mHeight, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+
+    void RenderTarget::SetLogicalSize(const int width, const int height) {
+        mWidth = std::min(width, mAllocatedWidth);
+        mHeight = std::min(height, mAllocatedHeight);
+    }
+
+    // Pool
+    RenderTargetPool::RenderTargetPool(const int bucketGranularity)
+        : mGranularity(std::max(1, bucketGranularity)) {}
+
+    int RenderTargetPool::Bucket(const int size) const {
+        return (std::max(size, 1) + mGranularity - 1) / mGranularity * mGranularity;
+    }
+
+    RenderTarget* RenderTargetPool::Acquire(const int width, const int height, const GLenum colorFormat, const bool depth) {
+        const int bucketWidth = Bucket(width);
+        const int bucketHeight = Bucket(height);
+
+        for (Entry& entry : mEntries) {
+            RenderTarget& target = *entry.target;
+            if (entry.inUse || target.ColorFormat() != colorFormat || target.HasDepth() != depth) continue;
+            if (target.AllocatedWidth() != bucketWidth || target.AllocatedHeight() != bucketHeight) continue;
+
+            entry.inUse = true;
+            target.SetLogicalSize(width, height);
+            return &target;
+        }
+
+        Entry& entry = mEntries.emplace_back();
+        entry.target = std::make_unique<RenderTarget>(bucketWidth, bucketHeight, colorFormat, depth);
+        entry.target->SetLogicalSize(width, height);
+        entry.inUse = true;
+        ++mAllocationCount;
+        return entry.target.get();
+    }
+
+    void RenderTargetPool::Release(const RenderTarget* target) {
+        for (Entry& entry : mEntries) {
+            if (entry.target.get() == target) {
+                entry.inUse = false;
+                return;
+            }
+        }
+    }
+
+    void RenderTargetPool::Trim() {
+        std::erase_if(mEntries, [](const Entry& entry) { return !entry.inUse; });
+    }
+
+}
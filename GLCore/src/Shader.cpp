@@ -3,11 +3,14 @@
 //
 
 #include "GLCore/Shader.h"
+#include "GLCore/Caps.h"
+#include "GLCore/Debug.h"
 #include <glad/glad.h>
 
 #include <fstream>
 #include <sstream>
 #include <iostream>
+#include <utility>
 #include <gtc/type_ptr.hpp>
 
 namespace GLCore {
@@ -53,17 +56,40 @@ namespace GLCore {
         return program;
     }
 
+    void Shader::Build(const char* vertexSource, const char* fragmentSource,
+                       const std::string& vertexLabel, const std::string& fragmentLabel, const std::string& programLabel) {
+        const unsigned int vs = Compile(GL_VERTEX_SHADER, vertexSource);
+        const unsigned int fs = Compile(GL_FRAGMENT_SHADER, fragmentSource);
+        Debug::Label(GL_SHADER, vs, vertexLabel);
+        Debug::Label(GL_SHADER, fs, fragmentLabel);
+        mID = LinkProgram(vs, fs);
+        Debug::Label(GL_PROGRAM, mID, programLabel);
+        glDeleteShader(vs);
+        glDeleteShader(fs);
+    }
+
     Shader::Shader(const char* vertexPath, const char* fragmentPath) {
         const std::string vertexCode = ReadTextFile(vertexPath);
         const std::string fragmentCode = ReadTextFile(fragmentPath);
-        const char* vsrc = vertexCode.c_str();
-        const char* fsrc = fragmentCode.c_str();
+        Build(vertexCode.c_str(), fragmentCode.c_str(), vertexPath, fragmentPath,
+              std::string(vertexPath) + " + " + fragmentPath);
+    }
 
-        const unsigned int vs = Compile(GL_VERTEX_SHADER, vsrc);
-        const unsigned int fs = Compile(GL_FRAGMENT_SHADER, fsrc);
-        mID = LinkProgram(vs, fs);
-        glDeleteShader(vs);
-        glDeleteShader(fs);
+    Shader Shader::FromSource(const char* vertexSource, const char* fragmentSource, const std::string& label) {
+        Shader shader;
+        shader.Build(vertexSource, fragmentSource, label + " vertex", label + " fragment", label);
+        return shader;
+    }
+
+    Shader::Shader(Shader&& other) noexcept
+        : mID(std::exchange(other.mID, 0)) {}
+
+    Shader& Shader::operator=(Shader&& other) noexcept {
+        if (this != &other) {
+            if (mID) glDeleteProgram(mID);
+            mID = std::exchange(other.mID, 0);
+        }
+        return *this;
     }
 
     Shader::~Shader() {
@@ -82,22 +108,34 @@ namespace GLCore {
         glUseProgram(0);
     }
 
-    // Scalar setters
+    // Scalar setters (glProgramUniform* on 4.1+ so the program does not need to be bound)
     void Shader::SetBool(const std::string &name, const bool value) const {
-        glUniform1i(glGetUniformLocation(mID, name.c_str()), static_cast<int>(value));
+        SetInt(name, static_cast<int>(value));
     }
 
     void Shader::SetInt(const std::string &name, const int value) const {
-        glUniform1i(glGetUniformLocation(mID, name.c_str()), value);
+        const int location = glGetUniformLocation(mID, name.c_str());
+        if (Caps::Get().separateShaderObjects) glProgramUniform1i(mID, location, value);
+        else glUniform1i(location, value);
     }
 
     void Shader::SetFloat(const std::string &name, const float value) const {
-        glUniform1f(glGetUniformLocation(mID, name.c_str()), value);
+        const int location = glGetUniformLocation(mID, name.c_str());
+        if (Caps::Get().separateShaderObjects) glProgramUniform1f(mID, location, value);
+        else glUniform1f(location, value);
+    }
+
+    void Shader::SetVec4(const std::string &name, const glm::vec4 &value) const {
+        const int location = glGetUniformLocation(mID, name.c_str());
+        if (Caps::Get().separateShaderObjects) glProgramUniform4fv(mID, location, 1, glm::value_ptr(value));
+        else glUniform4fv(location, 1, glm::value_ptr(value));
     }
 
     // Matrix setter (common case)
     void Shader::SetMat4(const std::string &name, const glm::mat4 &value) const {
-        glUniformMatrix4fv(glGetUniformLocation(mID, name.c_str()), 1, GL_FALSE, glm::value_ptr(value));
+        const int location = glGetUniformLocation(mID, name.c_str());
+        if (Caps::Get().separateShaderObjects) glProgramUniformMatrix4fv(mID, location, 1, GL_FALSE, glm::value_ptr(value));
+        else glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(value));
     }
 
 }
@@ -0,0 +1,267 @@
+//
+// Created by niek on 11/13/2025.
+//
+
+#include "GLCore/SpriteBatch.h"
+#include "GLCore/Atlas.h"
+#include "GLCore/Debug.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+
+namespace GLCore {
+
+    namespace {
+        const char* kSpriteVertexSource = R"(#version 330 core
+layout (location = 0) in vec2 aPos;
+layout (location = 1) in vec2 aUV;
+layout (location = 2) in vec4 aColor;
+layout (location = 3) in uint aLayer;
+
+uniform mat4 uProjection;
+
+out vec2 vUV;
+out vec4 vColor;
+flat out uint vLayer;
+
+void main() {
+    gl_Position = uProjection * vec4(aPos, 0.0, 1.0);
+    vUV = aUV;
+    vColor = aColor;
+    vLayer = aLayer;
+})";
+
+        const char* kSpriteFragmentSource = R"(#version 330 core
+in vec2 vUV;
+in vec4 vColor;
+flat in uint vLayer;
+
+uniform sampler2DArray uTexture;
+
+out vec4 FragColor;
+
+void main() {
+    FragColor = texture(uTexture, vec3(vUV, float(vLayer))) * vColor;
+})";
+
+        std::vector<std::uint32_t> MakeQuadIndices(const std::uint32_t quads) {
+            std::vector<std::uint32_t> indices(static_cast<std::size_t>(quads) * 6);
+            for (std::uint32_t q = 0; q < quads; ++q) {
+                const std::uint32_t v = q * 4;
+                const std::size_t i = static_cast<std::size_t>(q) * 6;
+                indices[i + 0] = v + 0;
+                indices[i + 1] = v + 1;
+                indices[i + 2] = v + 2;
+                indices[i + 3] = v + 2;
+                indices[i + 4] = v + 3;
+                indices[i + 5] = v + 0;
+            }
+            return indices;
+        }
+    }
+
+    SpriteBatch::SpriteBatch(const std::uint32_t maxSpritesPerBatch)
+        : mCapacity(std::max(1u, maxSpritesPerBatch)),
+          mShader(Shader::FromSource(kSpriteVertexSource, kSpriteFragmentSource, "SpriteBatch")),
+          mStream(static_cast<std::size_t>(mCapacity) * 4 * sizeof(SpriteVertex) + sizeof(SpriteVertex), 3,
+                  StreamStrategy::Auto, "SpriteBatch vertices"),
+          mQuadIndices(MakeQuadIndices(mCapacity), BufferUsage::Static, "SpriteBatch quad indices"),
+          mVertexArray("SpriteBatch VAO") {
+        mVertexArray.SetVertexFormat(0, VertexFormat::Of<SpriteVertex>());
+        mVertexArray.RebindVertexBuffer(0, mStream.ID(), 0);
+        mVertexArray.SetIndexBuffer(mQuadIndices);
+
+        // 1x1 white layer used for untextured sprites
+        constexpr std::uint32_t white = 0xFFFFFFFFu;
+        glGenTextures(1, &mWhiteTexture);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, mWhiteTexture);
+        glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, 1, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &white);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+        Debug::Label(GL_TEXTURE, mWhiteTexture, "SpriteBatch white");
+
+        mSprites.reserve(mCapacity);
+    }
+
+    SpriteBatch::~SpriteBatch() {
+        if (mWhiteTexture) glDeleteTextures(1, &mWhiteTexture);
+    }
+
+    void SpriteBatch::Begin(const glm::mat4& projection) {
+        mProjection = projection;
+        mSprites.clear();
+    }
+
+    void SpriteBatch::Draw(const Sprite& sprite) {
+        mSprites.push_back(sprite);
+    }
+
+    void SpriteBatch::Draw(const Atlas& atlas, const std::uint32_t id, Sprite sprite) {
+        const AtlasSprite& entry = atlas.Get(id);
+        sprite.texture = atlas.Texture().ID();
+        sprite.layer = entry.page;
+        sprite.uv = {entry.u0, entry.v0, entry.u1, entry.v1};
+        mSprites.push_back(sprite);
+    }
+
+    void SpriteBatch::SortSprites() {
+        const auto count = static_cast<std::uint32_t>(mSprites.size());
+        mKeys.resize(count);
+        mSortScratch.resize(count);
+
+        // Textures only need to be grouped, so map GL names to dense slots in order of first use.
+        // Past 14 bits everything shares the last slot; End() still splits draws on the real texture.
+        constexpr std::uint32_t kMaxSlot = (1u << 14) - 1;
+        std::vector<unsigned int> slots;
+        unsigned int lastTexture = 0;
+        std::uint32_t lastSlot = 0;
+        bool haveLast = false;
+
+        for (std::uint32_t i = 0; i < count; ++i) {
+            const Sprite& sprite = mSprites[i];
+            if (!haveLast || sprite.texture != lastTexture) {
+                const auto it = std::ranges::find(slots, sprite.texture);
+                if (it != slots.end()) {
+                    lastSlot = static_cast<std::uint32_t>(it - slots.begin());
+                } else {
+                    lastSlot = static_cast<std::uint32_t>(slots.size());
+                    slots.push_back(sprite.texture);
+                }
+                lastSlot = std::min(lastSlot, kMaxSlot);
+                lastTexture = sprite.texture;
+                haveLast = true;
+            }
+
+            const std::uint32_t state = static_cast<std::uint32_t>(static_cast<std::int32_t>(sprite.order) + 32768) << 16
+                                      | static_cast<std::uint32_t>(sprite.blend) << 14
+                                      | lastSlot;
+            mKeys[i] = static_cast<std::uint64_t>(state) << 32 | i;
+        }
+
+        // LSD radix sort on the state bits; the index in the low bits starts sorted, so the result is stable.
+        // Passes whose digit is identical for every key (the common case for order and blend) are skipped.
+        for (int shift = 32; shift < 64; shift += 8) {
+            std::array<std::uint32_t, 256> histogram{};
+            for (const std::uint64_t key : mKeys) ++histogram[(key >> shift) & 0xFF];
+            if (std::ranges::find(histogram, count) != histogram.end()) continue;
+
+            std::uint32_t sum = 0;
+            for (std::uint32_t& bucket : histogram) {
+                const std::uint32_t c = bucket;
+                bucket = sum;
+                sum += c;
+            }
+            for (const std::uint64_t key : mKeys) mSortScratch[histogram[(key >> shift) & 0xFF]++] = key;
+            mKeys.swap(mSortScratch);
+        }
+    }
+
+    void SpriteBatch::ApplyBlend(const BlendMode mode) {
+        switch (mode) {
+            case BlendMode::Opaque:
+                glDisable(GL_BLEND);
+                break;
+            case BlendMode::Alpha:
+                glEnable(GL_BLEND);
+                glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+                break;
+            case BlendMode::Additive:
+                glEnable(GL_BLEND);
+                glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+                break;
+            case BlendMode::Premultiplied:
+                glEnable(GL_BLEND);
+                glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+                break;
+        }
+    }
+
+    void SpriteBatch::End() {
+        const auto start = std::chrono::steady_clock::now();
+        mStats = {};
+        if (mSprites.empty()) return;
+
+        SortSprites();
+        const auto count = static_cast<std::uint32_t>(std::min<std::size_t>(mSprites.size(), mCapacity));
+        mStats.sprites = count;
+        mStats.dropped = static_cast<std::uint32_t>(mSprites.size()) - count;
+
+        mStream.BeginFrame();
+        const StreamAllocation allocation = mStream.Allocate(static_cast<std::size_t>(count) * 4 * sizeof(SpriteVertex), sizeof(SpriteVertex));
+        if (!allocation) {
+            mStream.EndFrame();
+            return;
+        }
+
+        // Write sequentially; the destination may be write-combined mapped memory
+        auto* out = static_cast<SpriteVertex*>(allocation.data);
+        for (std::uint32_t i = 0; i < count; ++i) {
+            const Sprite& s = mSprites[static_cast<std::uint32_t>(mKeys[i])];
+            const glm::vec2 half = s.size * 0.5f;
+            glm::vec2 ax{half.x, 0.0f};
+            glm::vec2 ay{0.0f, half.y};
+            if (s.rotation != 0.0f) {
+                const float c = std::cos(s.rotation);
+                const float sn = std::sin(s.rotation);
+                ax = {c * half.x, sn * half.x};
+                ay = {-sn * half.y, c * half.y};
+            }
+            const std::uint32_t layer = s.layer;
+            *out++ = {s.position - ax - ay, {s.uv.x, s.uv.y}, s.color, layer};
+            *out++ = {s.position + ax - ay, {s.uv.z, s.uv.y}, s.color, layer};
+            *out++ = {s.position + ax + ay, {s.uv.z, s.uv.w}, s.color, layer};
+            *out++ = {s.position - ax + ay, {s.uv.x, s.uv.w}, s.color, layer};
+        }
+        mStream.Flush();
+
+        mShader.Bind();
+        mShader.SetMat4("uProjection", mProjection);
+        mShader.SetInt("uTexture", 0);
+        mVertexArray.Bind();
+        glActiveTexture(GL_TEXTURE0);
+
+        const auto firstVertex = static_cast<GLint>(allocation.offset / sizeof(SpriteVertex));
+        unsigned int boundTexture = 0xFFFFFFFFu;
+        bool blendSet = false;
+        BlendMode currentBlend = BlendMode::Opaque;
+
+        std::uint32_t runStart = 0;
+        while (runStart < count) {
+            const Sprite& first = mSprites[static_cast<std::uint32_t>(mKeys[runStart])];
+            std::uint32_t runEnd = runStart + 1;
+            while (runEnd < count) {
+                const Sprite& next = mSprites[static_cast<std::uint32_t>(mKeys[runEnd])];
+                if (next.texture != first.texture || next.blend != first.blend) break;
+                ++runEnd;
+            }
+
+            const unsigned int texture = first.texture ? first.texture : mWhiteTexture;
+            if (texture != boundTexture) {
+                glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+                boundTexture = texture;
+                ++mStats.textureBinds;
+            }
+            if (!blendSet || first.blend != currentBlend) {
+                ApplyBlend(first.blend);
+                currentBlend = first.blend;
+                blendSet = true;
+                ++mStats.blendChanges;
+            }
+
+            glDrawElementsBaseVertex(GL_TRIANGLES, static_cast<GLsizei>((runEnd - runStart) * 6), GL_UNSIGNED_INT,
+                                     nullptr, firstVertex + static_cast<GLint>(runStart * 4));
+            ++mStats.drawCalls;
+            runStart = runEnd;
+        }
+
+        mStream.EndFrame();
+        glDisable(GL_BLEND);
+        VertexArray::Unbind();
+
+        mStats.cpuMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+}
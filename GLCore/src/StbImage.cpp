@@ -0,0 +1,7 @@
+//
+// Created by niek on 11/21/2025.
+//
+
+// The single stb_image implementation in GLCore; other translation units include "stb_image.h" for declarations only
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
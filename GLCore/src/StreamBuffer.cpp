@@ -0,0 +1,190 @@
+//
+// Created by niek on 11/11/2025.
+//
+
+#include "GLCore/StreamBuffer.h"
+#include "GLCore/Caps.h"
+#include "GLCore/Debug.h"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace GLCore {
+
+    namespace {
+        constexpr std::size_t kRegionAlignment = 256;
+        constexpr GLbitfield kPersistentFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    }
+
+    StreamBuffer::StreamBuffer(const std::size_t bytesPerFrame, const unsigned int framesInFlight,
+                               const StreamStrategy strategy, const std::string& label)
+        : mStrategy(strategy),
+          mRegionSize((std::max<std::size_t>(bytesPerFrame, 1) + kRegionAlignment - 1) / kRegionAlignment * kRegionAlignment),
+          mFrames(std::max(1u, framesInFlight)) {
+        const Caps& caps = Caps::Get();
+        if (mStrategy == StreamStrategy::Auto || (mStrategy == StreamStrategy::PersistentMapped && !caps.bufferStorage))
+            mStrategy = caps.bufferStorage ? StreamStrategy::PersistentMapped : StreamStrategy::Orphaning;
+
+        if (mStrategy == StreamStrategy::PersistentMapped) {
+            const auto total = static_cast<GLsizeiptr>(mRegionSize * mFrames);
+            if (caps.directStateAccess) {
+                glCreateBuffers(1, &mID);
+                glNamedBufferStorage(mID, total, nullptr, kPersistentFlags);
+                mMapped = static_cast<std::byte*>(glMapNamedBufferRange(mID, 0, total, kPersistentFlags));
+            } else {
+                glGenBuffers(1, &mID);
+                glBindBuffer(GL_COPY_WRITE_BUFFER, mID);
+                glBufferStorage(GL_COPY_WRITE_BUFFER, total, nullptr, kPersistentFlags);
+                mMapped = static_cast<std::byte*>(glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, total, kPersistentFlags));
+                glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+            }
+            mFences.resize(mFrames, nullptr);
+        } else {
+            // Fallbacks keep a single GPU region and stage writes on the CPU
+            mFrames = 1;
+            glGenBuffers(1, &mID);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, mID);
+            glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(mRegionSize), nullptr, GL_STREAM_DRAW);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+            mStaging.resize(mRegionSize);
+        }
+        Debug::Label(GL_BUFFER, mID, label.empty() ? std::string("StreamBuffer ") + StrategyName(mStrategy) : label);
+    }
+
+    StreamBuffer::~StreamBuffer() {
+        Release();
+    }
+
+    void StreamBuffer::Release() {
+        for (GLsync& fence : mFences) {
+            if (fence) glDeleteSync(fence);
+            fence = nullptr;
+        }
+        if (mID) {
+            if (mMapped) {
+                if (Caps::Get().directStateAccess) {
+                    glUnmapNamedBuffer(mID);
+                } else {
+                    glBindBuffer(GL_COPY_WRITE_BUFFER, mID);
+                    glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+                    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+                }
+                mMapped = nullptr;
+            }
+            glDeleteBuffers(1, &mID);
+            mID = 0;
+        }
+    }
+
+    StreamBuffer::StreamBuffer(StreamBuffer&& other) noexcept
+        : mID(std::exchange(other.mID, 0)), mStrategy(other.mStrategy), mRegionSize(other.mRegionSize),
+          mFrames(other.mFrames), mFrameIndex(other.mFrameIndex), mCursor(other.mCursor),
+          mFlushedCursor(other.mFlushedCursor), mMapped(std::exchange(other.mMapped, nullptr)),
+          mStaging(std::move(other.mStaging)), mFences(std::move(other.mFences)), mStats(other.mStats) {}
+
+    StreamBuffer& StreamBuffer::operator=(StreamBuffer&& other) noexcept {
+        if (this != &other) {
+            Release();
+            mID = std::exchange(other.mID, 0);
+            mStrategy = other.mStrategy;
+            mRegionSize = other.mRegionSize;
+            mFrames = other.mFrames;
+            mFrameIndex = other.mFrameIndex;
+            mCursor = other.mCursor;
+            mFlushedCursor = other.mFlushedCursor;
+            mMapped = std::exchange(other.mMapped, nullptr);
+            mStaging = std::move(other.mStaging);
+            mFences = std::move(other.mFences);
+            mStats = other.mStats;
+        }
+        return *this;
+    }
+
+    std::size_t StreamBuffer::RegionBase() const {
+        return mStrategy == StreamStrategy::PersistentMapped ? mFrameIndex * mRegionSize : 0;
+    }
+
+    void StreamBuffer::BeginFrame() {
+        mCursor = 0;
+        mFlushedCursor = 0;
+        mStats.bytesThisFrame = 0;
+        mStats.waitMs = 0.0;
+
+        if (mStrategy == StreamStrategy::PersistentMapped) {
+            GLsync& fence = mFences[mFrameIndex];
+            if (!fence) return;
+
+            // Wait until the GPU has consumed this region from framesInFlight frames ago
+            GLenum result = glClientWaitSync(fence, 0, 0);
+            if (result == GL_TIMEOUT_EXPIRED) {
+                const auto start = std::chrono::steady_clock::now();
+                do {
+                    result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000);
+                } while (result == GL_TIMEOUT_EXPIRED);
+                mStats.waitMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+                ++mStats.stalls;
+            }
+            glDeleteSync(fence);
+            fence = nullptr;
+        } else if (mStrategy == StreamStrategy::Orphaning) {
+            // Detach the store the GPU may still read from; the driver hands back fresh memory
+            glBindBuffer(GL_COPY_WRITE_BUFFER, mID);
+            glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(mRegionSize), nullptr, GL_STREAM_DRAW);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        }
+    }
+
+    StreamAllocation StreamBuffer::Allocate(const std::size_t size, const std::size_t alignment) {
+        const std::size_t align = std::max<std::size_t>(alignment, 1);
+        const std::size_t base = RegionBase();
+        const std::size_t start = ((base + mCursor + align - 1) / align * align) - base;
+        if (size == 0 || start + size > mRegionSize) {
+            ++mStats.failedAllocations;
+            return {};
+        }
+
+        mCursor = start + size;
+        mStats.bytesThisFrame += size;
+        mStats.bytesTotal += size;
+
+        std::byte* cpu = mMapped ? mMapped + base + start : mStaging.data() + start;
+        return {cpu, base + start, size};
+    }
+
+    void StreamBuffer::Flush() {
+        if (mStrategy == StreamStrategy::PersistentMapped || mFlushedCursor >= mCursor) return;
+
+        glBindBuffer(GL_COPY_WRITE_BUFFER, mID);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(mFlushedCursor),
+                        static_cast<GLsizeiptr>(mCursor - mFlushedCursor), mStaging.data() + mFlushedCursor);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        mFlushedCursor = mCursor;
+    }
+
+    void StreamBuffer::FlushRange(const std::size_t offset, const std::size_t size) {
+        if (mStrategy == StreamStrategy::PersistentMapped || size == 0 || offset + size > mRegionSize) return;
+
+        glBindBuffer(GL_COPY_WRITE_BUFFER, mID);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), mStaging.data() + offset);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+
+    void StreamBuffer::EndFrame() {
+        Flush();
+        if (mStrategy == StreamStrategy::PersistentMapped) {
+            mFences[mFrameIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            mFrameIndex = (mFrameIndex + 1) % mFrames;
+        }
+    }
+
+    const char* StreamBuffer::StrategyName(const StreamStrategy strategy) {
+        switch (strategy) {
+            case StreamStrategy::PersistentMapped: return "PersistentMapped";
+            case StreamStrategy::Orphaning: return "Orphaning";
+            case StreamStrategy::SubData: return "SubData";
+            default: return "Auto";
+        }
+    }
+
+}
@@ -0,0 +1,409 @@
+//
+// Created by niek on 11/21/2025.
+//
+
+#include "GLCore/Texture.h"
+#include "GLCore/Caps.h"
+#include "GLCore/Debug.h"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <utility>
+
+namespace GLCore {
+
+    namespace {
+        // Client format / type that matches an internal format, for glTexImage2D storage on pre-4.2 contexts
+        std::pair<GLenum, GLenum> ClientFormat(const GLenum internalFormat) {
+            switch (internalFormat) {
+                case GL_R8: return {GL_RED, GL_UNSIGNED_BYTE};
+                case GL_RG8: return {GL_RG, GL_UNSIGNED_BYTE};
+                case GL_RGB8:
+                case GL_SRGB8: return {GL_RGB, GL_UNSIGNED_BYTE};
+                case GL_R16F: return {GL_RED, GL_HALF_FLOAT};
+                case GL_RG16F: return {GL_RG, GL_HALF_FLOAT};
+                case GL_RGBA16F: return {GL_RGBA, GL_HALF_FLOAT};
+                case GL_RGBA32F: return {GL_RGBA, GL_FLOAT};
+                default: return {GL_RGBA, GL_UNSIGNED_BYTE};
+            }
+        }
+    }
+
+    Texture2D::Texture2D(const int width, const int height, const GLenum internalFormat, const int levels, const std::string& label)
+        : mWidth(width), mHeight(height), mLevels(levels > 0 ? std::min(levels, MipLevels(width, height)) : MipLevels(width, height)),
+          mInternalFormat(internalFormat) {
+        const Caps& caps = Caps::Get();
+        if (caps.directStateAccess) {
+            glCreateTextures(GL_TEXTURE_2D, 1, &mID);
+            glTextureStorage2D(mID, mLevels, internalFormat, width, height);
+        } else {
+            glGenTextures(1, &mID);
+            glBindTexture(GL_TEXTURE_2D, mID);
+            if (caps.textureStorage) {
+                glTexStorage2D(GL_TEXTURE_2D, mLevels, internalFormat, width, height);
+            } else if (IsCompressed(internalFormat)) {
+                for (int level = 0; level < mLevels; ++level) {
+                    const int w = std::max(width >> level, 1), h = std::max(height >> level, 1);
+                    glCompressedTexImage2D(GL_TEXTURE_2D, level, internalFormat, w, h, 0,
+                                           static_cast<GLsizei>(ImageBytes(internalFormat, w, h)), nullptr);
+                }
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, mLevels - 1);
+            } else {
+                const auto [format, type] = ClientFormat(internalFormat);
+                for (int level = 0; level < mLevels; ++level)
+                    glTexImage2D(GL_TEXTURE_2D, level, static_cast<GLint>(internalFormat), std::max(width >> level, 1),
+                                 std::max(height >> level, 1), 0, format, type, nullptr);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, mLevels - 1);
+            }
+            glBindTexture(GL_TEXTURE_2D, 0);
+        }
+
+        SetFilter(mLevels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR, GL_LINEAR);
+        SetWrap(GL_REPEAT, GL_REPEAT);
+        Debug::Label(GL_TEXTURE, mID, label.empty() ? "Texture2D " + std::to_string(width) + "x" + std::to_string(height) : label);
+    }
+
+    Texture2D::~Texture2D() {
+        if (mID) {
+            glDeleteTextures(1, &mID);
+            mID = 0;
+        }
+    }
+
+    Texture2D::Texture2D(Texture2D&& other) noexcept
+        : mID(std::exchange(other.mID, 0)), mWidth(other.mWidth), mHeight(other.mHeight), mLevels(other.mLevels),
+          mInternalFormat(other.mInternalFormat) {}
+
+    Texture2D& Texture2D::operator=(Texture2D&& other) noexcept {
+        if (this != &other) {
+            if (mID) glDeleteTextures(1, &mID);
+            mID = std::exchange(other.mID, 0);
+            mWidth = other.mWidth;
+            mHeight = other.mHeight;
+            mLevels = other.mLevels;
+            mInternalFormat = other.mInternalFormat;
+        }
+        return *this;
+    }
+
+    void Texture2D::SetSubImage(const int level, const int x, const int y, const int width, const int height,
+                                const GLenum format, const GLenum type, const void* pixels) const {
+        if (Caps::Get().directStateAccess) {
+            glTextureSubImage2D(mID, level, x, y, width, height, format, type, pixels);
+            return;
+        }
+        glBindTexture(GL_TEXTURE_2D, mID);
+        glTexSubImage2D(GL_TEXTURE_2D, level, x, y, width, height, format, type, pixels);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    void Texture2D::SetCompressedSubImage(const int level, const int x, const int y, const int width, const int height,
+                                          const std::size_t bytes, const void* data) const {
+        if (Caps::Get().directStateAccess) {
+            glCompressedTextureSubImage2D(mID, level, x, y, width, height, mInternalFormat, static_cast<GLsizei>(bytes), data);
+            return;
+        }
+        glBindTexture(GL_TEXTURE_2D, mID);
+        glCompressedTexSubImage2D(GL_TEXTURE_2D, level, x, y, width, height, mInternalFormat, static_cast<GLsizei>(bytes), data);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    void Texture2D::GenerateMipmaps() const {
+        if (mLevels <= 1) return;
+        if (Caps::Get().directStateAccess) {
+            glGenerateTextureMipmap(mID);
+            return;
+        }
+        glBindTexture(GL_TEXTURE_2D, mID);
+        glGenerateMipmap(GL_TEXTURE_2D);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    void Texture2D::SetFilter(const GLenum minFilter, const GLenum magFilter) const {
+        SetParameter(GL_TEXTURE_MIN_FILTER, static_cast<GLint>(minFilter));
+        SetParameter(GL_TEXTURE_MAG_FILTER, static_cast<GLint>(magFilter));
+    }
+
+    void Texture2D::SetWrap(const GLenum wrapS, const GLenum wrapT) const {
+        SetParameter(GL_TEXTURE_WRAP_S, static_cast<GLint>(wrapS));
+        SetParameter(GL_TEXTURE_WRAP_T, static_cast<GLint>(wrapT));
+    }
+
+    void Texture2D::SetAnisotropy(const float anisotropy) const {
+        const Caps& caps = Caps::Get();
+        if (!caps.anisotropicFiltering) return;
+        const float value = std::clamp(anisotropy, 1.0f, caps.maxAnisotropy);
+        if (caps.directStateAccess) {
+            glTextureParameterf(mID, GL_TEXTURE_MAX_ANISOTROPY, value);
+            return;
+        }
+        glBindTexture(GL_TEXTURE_2D, mID);
+        glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY, value);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    void Texture2D::SetSwizzle(const GLenum r, const GLenum g, const GLenum b, const GLenum a) const {
+        SetParameter(GL_TEXTURE_SWIZZLE_R, static_cast<GLint>(r));
+        SetParameter(GL_TEXTURE_SWIZZLE_G, static_cast<GLint>(g));
+        SetParameter(GL_TEXTURE_SWIZZLE_B, static_cast<GLint>(b));
+        SetParameter(GL_TEXTURE_SWIZZLE_A, static_cast<GLint>(a));
+    }
+
+    void Texture2D::SetLevelRange(const int baseLevel, const int maxLevel) const {
+        SetParameter(GL_TEXTURE_BASE_LEVEL, baseLevel);
+        SetParameter(GL_TEXTURE_MAX_LEVEL, maxLevel);
+    }
+
+    void Texture2D::Bind(const unsigned int unit) const {
+        if (Caps::Get().directStateAccess) {
+            glBindTextureUnit(unit, mID);
+            return;
+        }
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(GL_TEXTURE_2D, mID);
+    }
+
+    Texture2D Texture2D::DropMips(const int count, const std::string& label) const {
+        if (count <= 0 || count >= mLevels) throw std::runtime_error("ERROR::TEXTURE::INVALID_MIP_DROP: " + std::to_string(count)
+                                                                     + " of " + std::to_string(mLevels) + " levels");
+        if (!Caps::Get().copyImage) throw std::runtime_error("ERROR::TEXTURE::COPY_IMAGE_UNSUPPORTED");
+
+        Texture2D smaller(std::max(mWidth >> count, 1), std::max(mHeight >> count, 1), mInternalFormat, mLevels - count, label);
+        smaller.CopyLevels(*this, count, 0, mLevels - count);
+        smaller.CopySampling(*this);
+        return smaller;
+    }
+
+    void Texture2D::CopyLevels(const Texture2D& source, const int sourceLevel, const int level, const int count) const {
+        if (!Caps::Get().copyImage) throw std::runtime_error("ERROR::TEXTURE::COPY_IMAGE_UNSUPPORTED");
+        for (int i = 0; i < count; ++i)
+            glCopyImageSubData(source.mID, GL_TEXTURE_2D, sourceLevel + i, 0, 0, 0, mID, GL_TEXTURE_2D, level + i, 0, 0, 0,
+                               std::max(mWidth >> (level + i), 1), std::max(mHeight >> (level + i), 1), 1);
+    }
+
+    void Texture2D::CopySampling(const Texture2D& source) const {
+        for (const GLenum name : {GL_TEXTURE_MIN_FILTER, GL_TEXTURE_MAG_FILTER, GL_TEXTURE_WRAP_S, GL_TEXTURE_WRAP_T,
+                                  GL_TEXTURE_SWIZZLE_R, GL_TEXTURE_SWIZZLE_G, GL_TEXTURE_SWIZZLE_B, GL_TEXTURE_SWIZZLE_A})
+            SetParameter(name, source.GetParameter(name));
+        if (Caps::Get().anisotropicFiltering) SetAnisotropy(static_cast<float>(source.GetParameter(GL_TEXTURE_MAX_ANISOTROPY)));
+    }
+
+    std::size_t Texture2D::EstimatedBytes() const {
+        std::size_t bytes = 0;
+        for (int level = 0; level < mLevels; ++level)
+            bytes += ImageBytes(mInternalFormat, std::max(mWidth >> level, 1), std::max(mHeight >> level, 1));
+        return bytes;
+    }
+
+    int Texture2D::MipLevels(const int width, const int height) {
+        return std::bit_width(static_cast<unsigned int>(std::max({width, height, 1})));
+    }
+
+    std::size_t Texture2D::BytesPerTexel(const GLenum internalFormat) {
+        switch (internalFormat) {
+            case GL_R8: return 1;
+            case GL_RG8:
+            case GL_R16F: return 2;
+            case GL_RGBA16F: return 8;
+            case GL_RGBA32F: return 16;
+            default: return 4;    // RGB(A)8, SRGB8(_ALPHA8), RG16F
+        }
+    }
+
+    bool Texture2D::IsCompressed(const GLenum internalFormat) {
+        switch (internalFormat) {
+            case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+            case GL_COMPRESSED_SRGB_S3TC_DXT1_EXT:
+            case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+            case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT:
+            case GL_COMPRESSED_RED_RGTC1:
+            case GL_COMPRESSED_RG_RGTC2:
+            case GL_COMPRESSED_RGBA_BPTC_UNORM:
+            case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM: return true;
+            default: return false;
+        }
+    }
+
+    std::size_t Texture2D::ImageBytes(const GLenum internalFormat, const int width, const int height) {
+        if (!IsCompressed(internalFormat)) return static_cast<std::size_t>(width) * height * BytesPerTexel(internalFormat);
+        const bool halfBlock = internalFormat == GL_COMPRESSED_RGB_S3TC_DXT1_EXT || internalFormat == GL_COMPRESSED_SRGB_S3TC_DXT1_EXT
+                               || internalFormat == GL_COMPRESSED_RED_RGTC1;
+        return static_cast<std::size_t>((width + 3) / 4) * ((height + 3) / 4) * (halfBlock ? 8 : 16);
+    }
+
+    void Texture2D::SetParameter(const GLenum name, const GLint value) const {
+        if (Caps::Get().directStateAccess) {
+            glTextureParameteri(mID, name, value);
+            return;
+        }
+        glBindTexture(GL_TEXTURE_2D, mID);
+        glTexParameteri(GL_TEXTURE_2D, name, value);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    GLint Texture2D::GetParameter(const GLenum name) const {
+        GLint value = 0;
+        if (Caps::Get().directStateAccess) {
+            glGetTextureParameteriv(mID, name, &value);
+            return value;
+        }
+        glBindTexture(GL_TEXTURE_2D, mID);
+        glGetTexParameteriv(GL_TEXTURE_2D, name, &value);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        return value;
+    }
+
+    Texture2DArray::Texture2DArray(const int width, const int height, const int layers, const GLenum internalFormat, const int levels,
+                                   const std::string& label)
+        : mWidth(width), mHeight(height), mLayers(layers),
+          mLevels(levels > 0 ? std::min(levels, Texture2D::MipLevels(width, height)) : Texture2D::MipLevels(width, height)),
+          mInternalFormat(internalFormat) {
+        const Caps& caps = Caps::Get();
+        if (caps.directStateAccess) {
+            glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &mID);
+            glTextureStorage3D(mID, mLevels, internalFormat, width, height, layers);
+        } else {
+            glGenTextures(1, &mID);
+            glBindTexture(GL_TEXTURE_2D_ARRAY, mID);
+            if (caps.textureStorage) {
+                glTexStorage3D(GL_TEXTURE_2D_ARRAY, mLevels, internalFormat, width, height, layers);
+            } else if (Texture2D::IsCompressed(internalFormat)) {
+                for (int level = 0; level < mLevels; ++level) {
+                    const int w = std::max(width >> level, 1), h = std::max(height >> level, 1);
+                    glCompressedTexImage3D(GL_TEXTURE_2D_ARRAY, level, internalFormat, w, h, layers, 0,
+                                           static_cast<GLsizei>(Texture2D::ImageBytes(internalFormat, w, h) * layers), nullptr);
+                }
+                glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, mLevels - 1);
+            } else {
+                const auto [format, type] = ClientFormat(internalFormat);
+                for (int level = 0; level < mLevels; ++level)
+                    glTexImage3D(GL_TEXTURE_2D_ARRAY, level, static_cast<GLint>(internalFormat), std::max(width >> level, 1),
+                                 std::max(height >> level, 1), layers, 0, format, type, nullptr);
+                glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, mLevels - 1);
+            }
+            glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+        }
+
+        SetFilter(mLevels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR, GL_LINEAR);
+        SetWrap(GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE);
+        Debug::Label(GL_TEXTURE, mID, label.empty() ? "Texture2DArray " + std::to_string(width) + "x" + std::to_string(height)
+                                                      + "x" + std::to_string(layers) : label);
+    }
+
+    Texture2DArray::~Texture2DArray() {
+        if (mID) {
+            glDeleteTextures(1, &mID);
+            mID = 0;
+        }
+    }
+
+    Texture2DArray::Texture2DArray(Texture2DArray&& other) noexcept
+        : mID(std::exchange(other.mID, 0)), mWidth(other.mWidth), mHeight(other.mHeight), mLayers(other.mLayers),
+          mLevels(other.mLevels), mInternalFormat(other.mInternalFormat) {}
+
+    Texture2DArray& Texture2DArray::operator=(Texture2DArray&& other) noexcept {
+        if (this != &other) {
+            if (mID) glDeleteTextures(1, &mID);
+            mID = std::exchange(other.mID, 0);
+            mWidth = other.mWidth;
+            mHeight = other.mHeight;
+            mLayers = other.mLayers;
+            mLevels = other.mLevels;
+            mInternalFormat = other.mInternalFormat;
+        }
+        return *this;
+    }
+
+    void Texture2DArray::SetSubImage(const int level, const int x, const int y, const int layer, const int width, const int height,
+                                     const int layerCount, const GLenum format, const GLenum type, const void* pixels) const {
+        if (Caps::Get().directStateAccess) {
+            glTextureSubImage3D(mID, level, x, y, layer, width, height, layerCount, format, type, pixels);
+            return;
+        }
+        glBindTexture(GL_TEXTURE_2D_ARRAY, mID);
+        glTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, x, y, layer, width, height, layerCount, format, type, pixels);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    }
+
+    void Texture2DArray::SetCompressedSubImage(const int level, const int x, const int y, const int layer, const int width,
+                                               const int height, const int layerCount, const std::size_t bytes, const void* data) const {
+        if (Caps::Get().directStateAccess) {
+            glCompressedTextureSubImage3D(mID, level, x, y, layer, width, height, layerCount, mInternalFormat,
+                                          static_cast<GLsizei>(bytes), data);
+            return;
+        }
+        glBindTexture(GL_TEXTURE_2D_ARRAY, mID);
+        glCompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, x, y, layer, width, height, layerCount, mInternalFormat,
+                                  static_cast<GLsizei>(bytes), data);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    }
+
+    void Texture2DArray::GenerateMipmaps() const {
+        if (mLevels <= 1) return;
+        if (Caps::Get().directStateAccess) {
+            glGenerateTextureMipmap(mID);
+            return;
+        }
+        glBindTexture(GL_TEXTURE_2D_ARRAY, mID);
+        glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    }
+
+    void Texture2DArray::SetFilter(const GLenum minFilter, const GLenum magFilter) const {
+        SetParameter(GL_TEXTURE_MIN_FILTER, static_cast<GLint>(minFilter));
+        SetParameter(GL_TEXTURE_MAG_FILTER, static_cast<GLint>(magFilter));
+    }
+
+    void Texture2DArray::SetWrap(const GLenum wrapS, const GLenum wrapT) const {
+        SetParameter(GL_TEXTURE_WRAP_S, static_cast<GLint>(wrapS));
+        SetParameter(GL_TEXTURE_WRAP_T, static_cast<GLint>(wrapT));
+    }
+
+    void Texture2DArray::SetAnisotropy(const float anisotropy) const {
+        const Caps& caps = Caps::Get();
+        if (!caps.anisotropicFiltering) return;
+        const float value = std::clamp(anisotropy, 1.0f, caps.maxAnisotropy);
+        if (caps.directStateAccess) {
+            glTextureParameterf(mID, GL_TEXTURE_MAX_ANISOTROPY, value);
+            return;
+        }
+        glBindTexture(GL_TEXTURE_2D_ARRAY, mID);
+        glTexParameterf(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_ANISOTROPY, value);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    }
+
+    void Texture2DArray::SetSwizzle(const GLenum r, const GLenum g, const GLenum b, const GLenum a) const {
+        SetParameter(GL_TEXTURE_SWIZZLE_R, static_cast<GLint>(r));
+        SetParameter(GL_TEXTURE_SWIZZLE_G, static_cast<GLint>(g));
+        SetParameter(GL_TEXTURE_SWIZZLE_B, static_cast<GLint>(b));
+        SetParameter(GL_TEXTURE_SWIZZLE_A, static_cast<GLint>(a));
+    }
+
+    void Texture2DArray::Bind(const unsigned int unit) const {
+        if (Caps::Get().directStateAccess) {
+            glBindTextureUnit(unit, mID);
+            return;
+        }
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, mID);
+    }
+
+    std::size_t Texture2DArray::EstimatedBytes() const {
+        std::size_t bytes = 0;
+        for (int level = 0; level < mLevels; ++level)
+            bytes += Texture2D::ImageBytes(mInternalFormat, std::max(mWidth >> level, 1), std::max(mHeight >> level, 1));
+        return bytes * static_cast<std::size_t>(mLayers);
+    }
+
+    void Texture2DArray::SetParameter(const GLenum name, const GLint value) const {
+        if (Caps::Get().directStateAccess) {
+            glTextureParameteri(mID, name, value);
+            return;
+        }
+        glBindTexture(GL_TEXTURE_2D_ARRAY, mID);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, name, value);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    }
+
+}
@@ -0,0 +1,154 @@
+//
+// Created by niek on 11/27/2025.
+//
+
+#include "GLCore/TextureArrayPool.h"
+#include "GLCore/Caps.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace GLCore {
+
+    TextureArrayPool::TextureArrayPool(const TextureArrayPoolSettings& settings) : mSettings(settings) {}
+
+    TextureSlot TextureArrayPool::Allocate(const int width, const int height, const GLenum internalFormat, const int levels) {
+        return Allocate(width, height, internalFormat, levels, Swizzle::None);
+    }
+
+    TextureSlot TextureArrayPool::Allocate(const int width, const int height, const GLenum internalFormat, const int levels,
+                                           const Swizzle swizzle) {
+        if (width <= 0 || height <= 0) throw std::runtime_error("ERROR::TEXTURE_ARRAY_POOL::INVALID_SIZE");
+        const int fullLevels = Texture2D::MipLevels(width, height);
+        const int resolvedLevels = levels > 0 ? std::min(levels, fullLevels) : fullLevels;
+
+        for (std::size_t i = 0; i < mArrays.size(); ++i) {
+            Array& array = mArrays[i];
+            const Texture2DArray& texture = array.texture;
+            if (texture.ID() == 0 || array.freeLayers.empty() || array.swizzle != swizzle || texture.Width() != width
+                || texture.Height() != height || texture.InternalFormat() != internalFormat || texture.Levels() != resolvedLevels)
+                continue;
+            const std::uint16_t layer = array.freeLayers.back();
+            array.freeLayers.pop_back();
+            ++mStats.usedLayers;
+            return {static_cast<std::uint16_t>(i), layer};
+        }
+
+        // Every matching array is full: a new one, in a trimmed index if there is one
+        auto it = std::find_if(mArrays.begin(), mArrays.end(), [](const Array& array) { return array.texture.ID() == 0; });
+        if (it == mArrays.end()) {
+            if (mArrays.size() >= TextureSlot::kInvalid) throw std::runtime_error("ERROR::TEXTURE_ARRAY_POOL::TOO_MANY_ARRAYS");
+            it = mArrays.emplace(mArrays.end());
+        }
+        const auto index = static_cast<std::uint16_t>(it - mArrays.begin());
+        const int maxLayers = Caps::Get().maxArrayTextureLayers > 0 ? Caps::Get().maxArrayTextureLayers : 256;
+        const int layers = std::clamp(std::min(mSettings.layersPerArray, maxLayers), 1, static_cast<int>(TextureSlot::kInvalid));
+
+        Array& array = *it;
+        array.texture = Texture2DArray(width, height, layers, internalFormat, resolvedLevels,
+                                       "TextureArrayPool " + std::to_string(width) + "x" + std::to_string(height) + " #"
+                                       + std::to_string(index));
+        array.swizzle = swizzle;
+        if (swizzle == Swizzle::Grey) array.texture.SetSwizzle(GL_RED, GL_RED, GL_RED, GL_ONE);
+        if (swizzle == Swizzle::GreyAlpha) array.texture.SetSwizzle(GL_RED, GL_RED, GL_RED, GL_GREEN);
+        array.freeLayers.clear();
+        for (int layer = layers - 1; layer > 0; --layer) array.freeLayers.push_back(static_cast<std::uint16_t>(layer));
+
+        ++mStats.arrays;
+        mStats.layers += static_cast<std::uint32_t>(layers);
+        ++mStats.usedLayers;
+        mStats.bytes += array.texture.EstimatedBytes();
+        return {index, 0};
+    }
+
+    TextureSlot TextureArrayPool::Add(const std::span<const Image> levels, const bool srgb) {
+        if (levels.empty()) throw std::runtime_error("ERROR::TEXTURE_ARRAY_POOL::INVALID_MIP_CHAIN");
+        const Image& base = levels[0];
+        GLenum internalFormat = 0, format = 0;
+        Swizzle swizzle = Swizzle::None;
+        switch (base.channels) {
+            case 1: internalFormat = GL_R8; format = GL_RED; swizzle = Swizzle::Grey; break;
+            case 2: internalFormat = GL_RG8; format = GL_RG; swizzle = Swizzle::GreyAlpha; break;
+            case 4: internalFormat = srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8; format = GL_RGBA; break;
+            default: throw std::runtime_error("ERROR::TEXTURE_ARRAY_POOL::UNSUPPORTED_CHANNELS");
+        }
+        for (std::size_t i = 0; i < levels.size(); ++i) {
+            const Image& level = levels[i];
+            if (level.channels != base.channels || level.width != std::max(base.width >> i, 1) || level.height != std::max(base.height >> i, 1)
+                || level.pixels.size() != static_cast<std::size_t>(level.width) * level.height * level.channels)
+                throw std::runtime_error("ERROR::TEXTURE_ARRAY_POOL::INVALID_MIP_CHAIN");
+        }
+
+        const TextureSlot slot = Allocate(base.width, base.height, internalFormat, static_cast<int>(levels.size()), swizzle);
+        const Texture2DArray& texture = Get(slot);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        for (int level = 0; level < texture.Levels(); ++level) {
+            const Image& image = levels[static_cast<std::size_t>(level)];
+            texture.SetSubImage(level, 0, 0, slot.layer, image.width, image.height, 1, format, GL_UNSIGNED_BYTE, image.pixels.data());
+        }
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        return slot;
+    }
+
+    TextureSlot TextureArrayPool::Add(const CookedTexture& texture) {
+        const std::optional<BlockFormat> compression = texture.Compression();
+        if (compression && !BlockFormatSupported(*compression))
+            throw std::runtime_error(std::string("ERROR::TEXTURE_ARRAY_POOL::UNSUPPORTED_FORMAT: ") + ToString(*compression));
+        Swizzle swizzle = Swizzle::None;
+        if (texture.Greyscale()) swizzle = texture.Channels() == 1 ? Swizzle::Grey : Swizzle::GreyAlpha;
+
+        const TextureSlot slot = Allocate(texture.Width(), texture.Height(), texture.InternalFormat(), texture.Levels(), swizzle);
+        const Texture2DArray& array = Get(slot);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        for (int level = 0; level < array.Levels(); ++level) {
+            const int width = std::max(texture.Width() >> level, 1), height = std::max(texture.Height() >> level, 1);
+            const std::span<const std::byte> data = texture.Level(level);
+            if (compression) array.SetCompressedSubImage(level, 0, 0, slot.layer, width, height, 1, data.size(), data.data());
+            else array.SetSubImage(level, 0, 0, slot.layer, width, height, 1, texture.ClientFormat(), GL_UNSIGNED_BYTE, data.data());
+        }
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        return slot;
+    }
+
+    void TextureArrayPool::Release(const TextureSlot slot) {
+        if (!slot.Valid()) return;
+        mArrays[slot.array].freeLayers.push_back(slot.layer);
+        --mStats.usedLayers;
+    }
+
+    void TextureArrayPool::Trim() {
+        for (Array& array : mArrays) {
+            if (array.texture.ID() == 0 || static_cast<int>(array.freeLayers.size()) != array.texture.Layers()) continue;
+            std::replace(mBound.begin(), mBound.end(), array.texture.ID(), 0u);
+            --mStats.arrays;
+            mStats.layers -= static_cast<std::uint32_t>(array.texture.Layers());
+            mStats.bytes -= array.texture.EstimatedBytes();
+            array.texture = {};
+            array.freeLayers.clear();
+        }
+    }
+
+    void TextureArrayPool::BeginFrame() {
+        mStats.binds = 0;
+        mStats.skippedBinds = 0;
+        InvalidateBindings();
+    }
+
+    void TextureArrayPool::Bind(const std::uint16_t array, const unsigned int unit) {
+        const Texture2DArray& texture = mArrays[array].texture;
+        if (unit >= mBound.size()) mBound.resize(unit + 1, 0);
+        if (mBound[unit] == texture.ID()) {
+            ++mStats.skippedBinds;
+            return;
+        }
+        texture.Bind(unit);
+        mBound[unit] = texture.ID();
+        ++mStats.binds;
+    }
+
+    void TextureArrayPool::InvalidateBindings() {
+        std::fill(mBound.begin(), mBound.end(), 0u);
+    }
+
+}
@@ -0,0 +1,316 @@
+//
+// Created by niek on 11/21/2025.
+//
+
+#include "GLCore/TextureLoader.h"
+#include "GLCore/CookedTexture.h"
+#include "GLCore/MappedFile.h"
+#include "GLCore/Qoi.h"
+
+#include "stb_image.h"
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace GLCore {
+
+    namespace {
+        using Clock = std::chrono::steady_clock;
+
+        GLenum ClientFormat(const int channels) {
+            return channels == 1 ? GL_RED : channels == 2 ? GL_RG : GL_RGBA;
+        }
+
+        bool IsCooked(const std::string& path) {
+            return path.size() >= 5 && path.compare(path.size() - 5, 5, ".gtex") == 0;
+        }
+    }
+
+    /** @brief One finished decode, handed from a pool task to the GL thread. */
+    struct TextureLoader::Decoded {
+        TextureId id = 0;
+        int width = 0, height = 0, channels = 0;
+        std::unique_ptr<stbi_uc, void (*)(void*)> pixels{nullptr, stbi_image_free};
+        std::unique_ptr<CookedTexture> cooked;   // .gtex: every level is read straight from the mapping
+        std::vector<std::uint8_t> qoi;           // QOI: decoded by DecodeQoi instead of stb_image
+        int levels = 1;                          // levels to upload
+        std::uint64_t sourceBytes = 0;
+        double decodeMs = 0.0;
+        std::string error;
+
+        const std::byte* Pixels(const int level) const {
+            if (cooked) return cooked->Level(level).data();
+            return reinterpret_cast<const std::byte*>(qoi.empty() ? pixels.get() : qoi.data());
+        }
+        int Width(const int level) const { return std::max(width >> level, 1); }
+        int Height(const int level) const { return std::max(height >> level, 1); }
+        std::optional<BlockFormat> Compression() const { return cooked ? cooked->Compression() : std::nullopt; }
+
+        // Upload units: texel rows, or rows of 4x4 blocks for block-compressed levels
+        int Rows(const int level) const { return Compression() ? (Height(level) + 3) / 4 : Height(level); }
+        std::size_t RowBytes(const int level) const {
+            if (const std::optional<BlockFormat> blocks = Compression())
+                return static_cast<std::size_t>((Width(level) + 3) / 4) * BlockBytes(*blocks);
+            return static_cast<std::size_t>(Width(level)) * channels;
+        }
+    };
+
+    struct TextureLoader::Inbox {
+        std::mutex mutex;
+        std::condition_variable ready;
+        std::vector<std::unique_ptr<Decoded>> done;
+    };
+
+    TextureLoader::TextureLoader(ThreadPool& pool, const TextureLoaderSettings& settings)
+        : mPool(pool), mSettings(settings),
+          mStaging(settings.uploadBytesPerFrame, settings.framesInFlight, StreamStrategy::Auto, "TextureLoader staging"),
+          mInbox(std::make_shared<Inbox>()) {}
+
+    TextureLoader::~TextureLoader() = default;
+
+    TextureId TextureLoader::Load(const std::string& path, const TextureLoadOptions& options) {
+        const auto id = static_cast<TextureId>(mEntries.size());
+        Entry& entry = mEntries.emplace_back();
+        entry.path = path;
+        entry.options = options;
+        ++mStats.requested;
+        ++mStats.decoding;
+
+        mPool.Submit([inbox = mInbox, id, path, flip = options.flipVertically, mips = options.generateMipmaps] {
+            auto decoded = std::make_unique<Decoded>();
+            decoded->id = id;
+            const auto start = Clock::now();
+            try {
+                if (IsCooked(path)) {
+                    // Cooked: no decode, every level is already in the file
+                    decoded->cooked = std::make_unique<CookedTexture>(path);
+                    const CookedTexture& cooked = *decoded->cooked;
+                    decoded->width = cooked.Width();
+                    decoded->height = cooked.Height();
+                    decoded->channels = cooked.Channels();
+                    decoded->levels = mips ? cooked.Levels() : 1;
+                    decoded->sourceBytes = cooked.FileSize();
+
+                    // Fault the pages in here rather than in the GL thread's memcpy
+                    unsigned int touched = 0;
+                    for (int level = 0; level < decoded->levels; ++level) {
+                        const std::span<const std::byte> bytes = cooked.Level(level);
+                        for (std::size_t i = 0; i < bytes.size(); i += 4096) touched += static_cast<unsigned int>(bytes[i]);
+                    }
+                    [[maybe_unused]] volatile unsigned int sink = touched;
+                } else {
+                    const MappedFile file = [&path] {
+                        try {
+                            return MappedFile(path);
+                        } catch (const std::runtime_error&) {
+                            throw std::runtime_error("ERROR::TEXTURE::FILE_NOT_FOUND: " + path);
+                        }
+                    }();
+                    decoded->sourceBytes = file.Size();
+                    if (IsQoi(file.Bytes())) {
+                        Image image = DecodeQoi(file.Bytes(), flip, path);
+                        decoded->width = image.width;
+                        decoded->height = image.height;
+                        decoded->channels = image.channels;
+                        decoded->qoi = std::move(image.pixels);
+                    } else {
+                        const auto* data = reinterpret_cast<const stbi_uc*>(file.Data());
+                        const int length = static_cast<int>(std::min<std::size_t>(file.Size(), INT_MAX));
+
+                        // Grey and grey+alpha keep their channel count; RGB is expanded to RGBA (GPUs store it that way anyway)
+                        int width = 0, height = 0, channels = 0;
+                        if (!stbi_info_from_memory(data, length, &width, &height, &channels))
+                            throw std::runtime_error("ERROR::TEXTURE::DECODE_FAILED: " + path + " (" + stbi_failure_reason() + ")");
+                        const int wanted = channels <= 2 ? channels : 4;
+                        stbi_set_flip_vertically_on_load_thread(flip ? 1 : 0);
+                        decoded->pixels.reset(stbi_load_from_memory(data, length, &width, &height, &channels, wanted));
+                        if (!decoded->pixels)
+                            throw std::runtime_error("ERROR::TEXTURE::DECODE_FAILED: " + path + " (" + stbi_failure_reason() + ")");
+                        decoded->width = width;
+                        decoded->height = height;
+                        decoded->channels = wanted;
+                    }
+                }
+            } catch (const std::exception& e) {
+                decoded->error = e.what();
+            }
+            decoded->decodeMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+            {
+                const std::lock_guard lock(inbox->mutex);
+                inbox->done.push_back(std::move(decoded));
+            }
+            inbox->ready.notify_all();
+        });
+        return id;
+    }
+
+    void TextureLoader::Collect() {
+        std::vector<std::unique_ptr<Decoded>> done;
+        {
+            const std::lock_guard lock(mInbox->mutex);
+            done.swap(mInbox->done);
+        }
+
+        for (std::unique_ptr<Decoded>& decoded : done) {
+            Entry& entry = mEntries[decoded->id];
+            --mStats.decoding;
+            mStats.sourceBytes += decoded->sourceBytes;
+            mStats.decodeMs += decoded->decodeMs;
+            if (const std::optional<BlockFormat> blocks = decoded->Compression(); blocks && !BlockFormatSupported(*blocks))
+                decoded->error = std::string("ERROR::TEXTURE::UNSUPPORTED_FORMAT: ") + ToString(*blocks) + " in " + entry.path;
+            if (!decoded->error.empty()) {
+                entry.state = TextureState::Failed;
+                entry.error = std::move(decoded->error);
+                ++mStats.failed;
+                std::cerr << entry.error << std::endl;
+                continue;
+            }
+            for (int level = 0; level < decoded->levels; ++level)
+                mStats.decodedBytes += static_cast<std::uint64_t>(decoded->Rows(level)) * decoded->RowBytes(level);
+            entry.state = TextureState::Uploading;
+            ++mStats.uploading;
+            mUploads.push_back(std::move(decoded));
+        }
+    }
+
+    void TextureLoader::Update() {
+        const auto start = Clock::now();
+        Collect();
+        mStats.uploadedBytesThisFrame = 0;
+        if (mUploads.empty()) {
+            mStats.updateMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            return;
+        }
+
+        // Stage row slices of the queued images (level by level for cooked ones, whole block rows for compressed ones)
+        // into this frame's region, oldest first
+        struct Slice {
+            const Texture2D* texture;
+            int level, y, width, rows;
+            GLenum format;              // 0: block-compressed, `bytes` as stored
+            std::size_t offset, bytes;
+        };
+        struct Finished {
+            TextureId id;
+            bool generateMipmaps;
+        };
+        std::vector<Slice> slices;
+        std::vector<Finished> finished;
+        std::size_t budget = mSettings.uploadBytesPerFrame;
+
+        mStaging.BeginFrame();
+        while (!mUploads.empty()) {
+            Decoded& image = *mUploads.front();
+            Entry& entry = mEntries[image.id];
+            if (entry.texture.ID() == 0) {
+                // Cooked files keep the format (and sRGB-ness) they were filtered in
+                const GLenum internalFormat = image.cooked ? image.cooked->InternalFormat()
+                                            : image.channels == 1 ? GL_R8
+                                            : image.channels == 2 ? GL_RG8
+                                            : entry.options.srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8;
+                const int levels = image.levels > 1 ? image.levels : entry.options.generateMipmaps ? 0 : 1;
+                entry.texture = Texture2D(image.width, image.height, internalFormat, levels, entry.path);
+                // Grey sources sample as grey; a cooked BC4 / BC5 file may also hold a single data channel
+                const bool grey = image.cooked ? image.cooked->Greyscale() : true;
+                if (grey && image.channels == 1) entry.texture.SetSwizzle(GL_RED, GL_RED, GL_RED, GL_ONE);
+                if (grey && image.channels == 2) entry.texture.SetSwizzle(GL_RED, GL_RED, GL_RED, GL_GREEN);
+            }
+
+            const int width = image.Width(mUploadedLevel), height = image.Rows(mUploadedLevel);
+            const std::size_t rowBytes = image.RowBytes(mUploadedLevel);
+            const int rows = static_cast<int>(std::min<std::size_t>(height - mUploadedRows, budget / rowBytes));
+            if (rows == 0) {
+                if (budget < mSettings.uploadBytesPerFrame) break;
+                // A single row does not fit the per-frame budget: this image can never be uploaded
+                entry.state = TextureState::Failed;
+                entry.error = "ERROR::TEXTURE::ROW_EXCEEDS_UPLOAD_BUDGET: " + entry.path;
+                entry.texture = {};
+                std::cerr << entry.error << std::endl;
+                --mStats.uploading;
+                ++mStats.failed;
+                mUploads.pop_front();
+                continue;
+            }
+            const StreamAllocation allocation = mStaging.Allocate(rows * rowBytes, 16);
+            if (!allocation) break;
+
+            std::memcpy(allocation.data, image.Pixels(mUploadedLevel) + mUploadedRows * rowBytes, rows * rowBytes);
+            if (image.Compression()) {
+                const int texelHeight = image.Height(mUploadedLevel);
+                slices.push_back({&entry.texture, mUploadedLevel, mUploadedRows * 4, width,
+                                  std::min(rows * 4, texelHeight - mUploadedRows * 4), 0, allocation.offset, rows * rowBytes});
+            } else {
+                slices.push_back({&entry.texture, mUploadedLevel, mUploadedRows, width, rows, ClientFormat(image.channels),
+                                  allocation.offset, rows * rowBytes});
+            }
+            budget -= rows * rowBytes;
+            mUploadedRows += rows;
+            if (mUploadedRows == height) {
+                mUploadedRows = 0;
+                if (++mUploadedLevel == image.levels) {
+                    finished.push_back({image.id, entry.options.generateMipmaps && image.levels == 1});
+                    mUploads.pop_front();
+                    mUploadedLevel = 0;
+                }
+            }
+        }
+        mStaging.Flush();
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, mStaging.ID());
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        for (const Slice& slice : slices) {
+            if (slice.format == 0)
+                slice.texture->SetCompressedSubImage(slice.level, 0, slice.y, slice.width, slice.rows, slice.bytes,
+                                                     reinterpret_cast<const void*>(slice.offset));
+            else
+                slice.texture->SetSubImage(slice.level, 0, slice.y, slice.width, slice.rows, slice.format, GL_UNSIGNED_BYTE,
+                                           reinterpret_cast<const void*>(slice.offset));
+            mStats.uploadedBytesThisFrame += slice.bytes;
+        }
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        mStaging.EndFrame();
+
+        for (const Finished& done : finished) {
+            Entry& entry = mEntries[done.id];
+            if (done.generateMipmaps) entry.texture.GenerateMipmaps();
+            entry.state = TextureState::Ready;
+            --mStats.uploading;
+            ++mStats.ready;
+        }
+        mStats.uploadedBytes += mStats.uploadedBytesThisFrame;
+        mStats.updateMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    void TextureLoader::WaitIdle() {
+        while (!Idle()) {
+            if (mUploads.empty()) {
+                std::unique_lock lock(mInbox->mutex);
+                mInbox->ready.wait(lock, [this] { return !mInbox->done.empty(); });
+            }
+            Update();
+        }
+    }
+
+    const Texture2D* TextureLoader::Get(const TextureId id) const {
+        const Entry& entry = mEntries[id];
+        return entry.state == TextureState::Ready ? &entry.texture : nullptr;
+    }
+
+    Texture2D TextureLoader::Take(const TextureId id) {
+        Entry& entry = mEntries[id];
+        if (entry.state != TextureState::Ready) throw std::runtime_error("ERROR::TEXTURE::NOT_READY: " + entry.path);
+        entry.state = TextureState::Taken;
+        return std::move(entry.texture);
+    }
+
+}
@@ -0,0 +1,323 @@
+//
+// Created by niek on 11/25/2025.
+//
+
+#include "GLCore/TextureStreamer.h"
+#include "GLCore/Caps.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace GLCore {
+
+    namespace {
+        using Clock = std::chrono::steady_clock;
+
+        int LevelSize(const int size, const int level) {
+            return std::max(size >> level, 1);
+        }
+    }
+
+    TextureStreamer::TextureStreamer(ThreadPool& pool, const TextureStreamerSettings& settings)
+        : mPool(pool), mSettings(settings),
+          mStaging(settings.uploadBytesPerFrame, settings.framesInFlight, StreamStrategy::Auto, "TextureStreamer staging") {}
+
+    TextureStreamer::~TextureStreamer() {
+        // Prefetch tasks read the mappings
+        for (Entry& entry : mEntries)
+            if (entry.prefetch.valid()) entry.prefetch.wait();
+    }
+
+    StreamedTextureId TextureStreamer::Add(const std::string& path) {
+        if (path.size() < 5 || path.compare(path.size() - 5, 5, ".gtex") != 0)
+            throw std::runtime_error("ERROR::TEXTURE_STREAMER::NOT_COOKED: " + path);
+        auto file = std::make_unique<CookedTexture>(path);
+        if (const std::optional<BlockFormat> blocks = file->Compression(); blocks && !BlockFormatSupported(*blocks))
+            throw std::runtime_error(std::string("ERROR::TEXTURE_STREAMER::UNSUPPORTED_FORMAT: ") + ToString(*blocks) + " in " + path);
+
+        const auto id = static_cast<StreamedTextureId>(mEntries.size());
+        Entry& entry = mEntries.emplace_back();
+        entry.path = path;
+        entry.file = std::move(file);
+        const CookedTexture& cooked = *entry.file;
+        const int levels = cooked.Levels();
+        while (entry.tail + 1 < levels
+               && std::max(LevelSize(cooked.Width(), entry.tail), LevelSize(cooked.Height(), entry.tail)) > mSettings.tailSize)
+            ++entry.tail;
+        entry.allocated = entry.resident = entry.requested = entry.target = entry.frameRequest = entry.tail;
+        entry.requestFrame = mFrame;
+
+        entry.texture = Texture2D(LevelSize(cooked.Width(), entry.tail), LevelSize(cooked.Height(), entry.tail),
+                                  cooked.InternalFormat(), levels - entry.tail, path);
+        if (cooked.Greyscale() && cooked.Channels() == 1) entry.texture.SetSwizzle(GL_RED, GL_RED, GL_RED, GL_ONE);
+        if (cooked.Greyscale() && cooked.Channels() == 2) entry.texture.SetSwizzle(GL_RED, GL_RED, GL_RED, GL_GREEN);
+        for (int level = entry.tail; level < levels; ++level) UploadDirect(entry, level);
+        entry.texture.SetLevelRange(0, levels - 1 - entry.tail);
+        mStats.fullBytes += RangeBytes(entry, 0);
+        return id;
+    }
+
+    void TextureStreamer::SetProjection(const float fovY, const float viewportHeight) {
+        mPixelsPerUnit = viewportHeight / (2.0f * std::tan(fovY * 0.5f));
+    }
+
+    void TextureStreamer::Request(const StreamedTextureId id, const float distance, const float uvDensity, const float scale) {
+        const CookedTexture& cooked = *mEntries[id].file;
+        // Texels of level 0 that land on one pixel; each level halves it
+        const float texelsPerPixel = static_cast<float>(std::max(cooked.Width(), cooked.Height())) * uvDensity
+                                     * std::max(distance, 1e-4f) / (std::max(scale, 1e-6f) * mPixelsPerUnit);
+        if (!(texelsPerPixel > 0.0f)) {
+            RequestLevel(id, mEntries[id].tail);
+            return;
+        }
+        RequestLevel(id, static_cast<int>(std::floor(std::log2(std::max(texelsPerPixel, 1.0f)) + mSettings.lodBias)));
+    }
+
+    void TextureStreamer::RequestLevel(const StreamedTextureId id, const int level) {
+        Entry& entry = mEntries[id];
+        const int clamped = std::clamp(level, 0, entry.tail);
+        if (entry.requestFrame != mFrame) {
+            entry.requestFrame = mFrame;
+            entry.frameRequest = clamped;
+        } else {
+            entry.frameRequest = std::min(entry.frameRequest, clamped);
+        }
+    }
+
+    void TextureStreamer::Update() {
+        const auto start = Clock::now();
+        mStats.uploadedBytesThisFrame = 0;
+
+        // Requests: this frame's finest level, or back to the tail once a texture has not been asked for in a while
+        for (Entry& entry : mEntries) {
+            if (entry.requestFrame == mFrame) entry.requested = entry.frameRequest;
+            else if (mFrame - entry.requestFrame > mSettings.keepFrames) entry.requested = entry.tail;
+        }
+
+        // Budget: coarsen the largest top level until the streamed (non-tail) levels fit
+        using Candidate = std::pair<std::uint64_t, std::uint32_t>;
+        std::priority_queue<Candidate> largest;
+        std::uint64_t wanted = 0;
+        for (std::uint32_t i = 0; i < mEntries.size(); ++i) {
+            Entry& entry = mEntries[i];
+            entry.target = entry.requested;
+            wanted += RangeBytes(entry, entry.target) - RangeBytes(entry, entry.tail);
+            if (entry.target < entry.tail) largest.emplace(LevelBytes(entry, entry.target), i);
+        }
+        while (wanted > mSettings.budgetBytes && !largest.empty()) {
+            const std::uint32_t i = largest.top().second;
+            largest.pop();
+            Entry& entry = mEntries[i];
+            wanted -= LevelBytes(entry, entry.target++);
+            if (entry.target < entry.tail) largest.emplace(LevelBytes(entry, entry.target), i);
+        }
+        largest = {};
+
+        // Evict: levels finer than the target stay until what is resident (or on its way) exceeds the budget
+        std::uint64_t committed = 0;
+        for (std::uint32_t i = 0; i < mEntries.size(); ++i) {
+            Entry& entry = mEntries[i];
+            committed += RangeBytes(entry, std::min(entry.resident, entry.target)) - RangeBytes(entry, entry.tail);
+            if (entry.resident < entry.target) largest.emplace(LevelBytes(entry, entry.resident), i);
+        }
+        while (committed > mSettings.budgetBytes && !largest.empty()) {
+            const std::uint32_t i = largest.top().second;
+            largest.pop();
+            Entry& entry = mEntries[i];
+            committed -= LevelBytes(entry, entry.resident);
+            Evict(entry, entry.resident + 1);
+            if (entry.resident < entry.target) largest.emplace(LevelBytes(entry, entry.resident), i);
+        }
+        // Storage above the resident levels of a texture that is not streaming in is released
+        for (Entry& entry : mEntries)
+            if (entry.allocated < entry.resident && entry.resident <= entry.target) Reallocate(entry, entry.resident);
+
+        // Stream: the blurriest textures (relative to their target) first, one level per texture per frame
+        std::vector<std::uint32_t> order;
+        for (std::uint32_t i = 0; i < mEntries.size(); ++i)
+            if (mEntries[i].target < mEntries[i].resident) order.push_back(i);
+        std::sort(order.begin(), order.end(), [this](const std::uint32_t a, const std::uint32_t b) {
+            const Entry& ea = mEntries[a];
+            const Entry& eb = mEntries[b];
+            const int da = ea.resident - ea.target, db = eb.resident - eb.target;
+            return da != db ? da > db : LevelBytes(ea, ea.resident - 1) < LevelBytes(eb, eb.resident - 1);
+        });
+
+        struct Slice {
+            std::uint32_t entry;
+            int level, y, width, rows;
+            std::size_t offset, bytes;
+        };
+        std::vector<Slice> slices;
+        std::vector<std::uint32_t> completed;
+        std::size_t budget = mSettings.uploadBytesPerFrame;
+
+        mStaging.BeginFrame();
+        for (const std::uint32_t i : order) {
+            Entry& entry = mEntries[i];
+            const int level = entry.resident - 1;
+            const std::span<const std::byte> data = entry.file->Level(level);
+            if (entry.prefetched != level) {
+                Prefetch(entry, level);
+                continue;
+            }
+            if (entry.prefetch.valid()) {
+                if (entry.prefetch.wait_for(std::chrono::seconds(0)) != std::future_status::ready) continue;
+                entry.prefetch.get();
+            }
+            if (entry.allocated > level) Reallocate(entry, entry.target);
+
+            const bool compressed = entry.file->Compression().has_value();
+            const int width = LevelSize(entry.file->Width(), level), height = LevelSize(entry.file->Height(), level);
+            const int rowCount = compressed ? (height + 3) / 4 : height;
+            const std::size_t rowBytes = data.size() / static_cast<std::size_t>(rowCount);
+            const int rows = static_cast<int>(std::min<std::size_t>(rowCount - entry.uploadedRows, budget / rowBytes));
+            if (rows == 0) {
+                if (budget < mSettings.uploadBytesPerFrame) break;
+                // A single row exceeds the per-frame budget: upload the level from the mapping instead
+                UploadDirect(entry, level);
+                mStats.uploadedBytesThisFrame += data.size();
+                entry.uploadedRows = rowCount;
+                completed.push_back(i);
+                continue;
+            }
+            const StreamAllocation allocation = mStaging.Allocate(rows * rowBytes, 16);
+            if (!allocation) break;
+
+            std::memcpy(allocation.data, data.data() + entry.uploadedRows * rowBytes, rows * rowBytes);
+            if (compressed)
+                slices.push_back({i, level, entry.uploadedRows * 4, width, std::min(rows * 4, height - entry.uploadedRows * 4),
+                                  allocation.offset, rows * rowBytes});
+            else
+                slices.push_back({i, level, entry.uploadedRows, width, rows, allocation.offset, rows * rowBytes});
+            budget -= rows * rowBytes;
+            entry.uploadedRows += rows;
+            if (entry.uploadedRows == rowCount) completed.push_back(i);
+        }
+        mStaging.Flush();
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, mStaging.ID());
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        for (const Slice& slice : slices) {
+            const Entry& entry = mEntries[slice.entry];
+            const auto offset = reinterpret_cast<const void*>(slice.offset);
+            if (entry.file->Compression())
+                entry.texture.SetCompressedSubImage(slice.level - entry.allocated, 0, slice.y, slice.width, slice.rows, slice.bytes, offset);
+            else
+                entry.texture.SetSubImage(slice.level - entry.allocated, 0, slice.y, slice.width, slice.rows,
+                                          entry.file->ClientFormat(), GL_UNSIGNED_BYTE, offset);
+            mStats.uploadedBytesThisFrame += slice.bytes;
+        }
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        mStaging.EndFrame();
+
+        // Completed levels become sampleable
+        for (const std::uint32_t i : completed) {
+            Entry& entry = mEntries[i];
+            --entry.resident;
+            entry.uploadedRows = 0;
+            entry.texture.SetLevelRange(entry.resident - entry.allocated, entry.file->Levels() - 1 - entry.allocated);
+            ++mStats.streamedLevels;
+            mStats.streamedBytes += LevelBytes(entry, entry.resident);
+            if (entry.target < entry.resident) Prefetch(entry, entry.resident - 1);
+        }
+
+        mStats.textures = static_cast<std::uint32_t>(mEntries.size());
+        mStats.streaming = 0;
+        mStats.residentBytes = mStats.allocatedBytes = mStats.pendingBytes = mStats.requestedBytes = 0;
+        for (const Entry& entry : mEntries) {
+            mStats.residentBytes += RangeBytes(entry, entry.resident);
+            mStats.allocatedBytes += entry.texture.EstimatedBytes();
+            mStats.requestedBytes += RangeBytes(entry, entry.requested);
+            if (entry.target < entry.resident) {
+                ++mStats.streaming;
+                mStats.pendingBytes += RangeBytes(entry, entry.target) - RangeBytes(entry, entry.resident);
+            }
+        }
+        mStats.budgetBytes = mSettings.budgetBytes;
+        ++mFrame;
+        mStats.updateMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    float TextureStreamer::UvDensity(const MeshData& mesh) {
+        double surface = 0.0, uv = 0.0;
+        for (std::size_t i = 0; i + 2 < mesh.indices.size(); i += 3) {
+            const MeshVertex& a = mesh.vertices[mesh.indices[i]];
+            const MeshVertex& b = mesh.vertices[mesh.indices[i + 1]];
+            const MeshVertex& c = mesh.vertices[mesh.indices[i + 2]];
+            surface += glm::length(glm::cross(b.position - a.position, c.position - a.position));
+            const glm::vec2 u = b.uv - a.uv, v = c.uv - a.uv;
+            uv += std::abs(u.x * v.y - u.y * v.x);
+        }
+        return surface > 0.0 ? static_cast<float>(std::sqrt(uv / surface)) : 0.0f;
+    }
+
+    std::uint64_t TextureStreamer::LevelBytes(const Entry& entry, const int level) const {
+        const CookedTexture& cooked = *entry.file;
+        return Texture2D::ImageBytes(cooked.InternalFormat(), LevelSize(cooked.Width(), level), LevelSize(cooked.Height(), level));
+    }
+
+    std::uint64_t TextureStreamer::RangeBytes(const Entry& entry, const int first) const {
+        std::uint64_t bytes = 0;
+        for (int level = first; level < entry.file->Levels(); ++level) bytes += LevelBytes(entry, level);
+        return bytes;
+    }
+
+    void TextureStreamer::Reallocate(Entry& entry, const int allocated) {
+        const CookedTexture& cooked = *entry.file;
+        const int levels = cooked.Levels();
+        Texture2D texture(LevelSize(cooked.Width(), allocated), LevelSize(cooked.Height(), allocated), cooked.InternalFormat(),
+                          levels - allocated, entry.path);
+        texture.CopySampling(entry.texture);
+        const bool copy = Caps::Get().copyImage;
+        if (copy) texture.CopyLevels(entry.texture, entry.resident - entry.allocated, entry.resident - allocated, levels - entry.resident);
+        entry.texture = std::move(texture);
+        entry.allocated = allocated;
+        if (!copy)
+            for (int level = entry.resident; level < levels; ++level) UploadDirect(entry, level);
+        entry.texture.SetLevelRange(entry.resident - allocated, levels - 1 - allocated);
+        entry.uploadedRows = 0;
+        ++mStats.reallocations;
+    }
+
+    void TextureStreamer::UploadDirect(const Entry& entry, const int level) const {
+        const CookedTexture& cooked = *entry.file;
+        const std::span<const std::byte> data = cooked.Level(level);
+        const int width = LevelSize(cooked.Width(), level), height = LevelSize(cooked.Height(), level);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        if (cooked.Compression())
+            entry.texture.SetCompressedSubImage(level - entry.allocated, 0, 0, width, height, data.size(), data.data());
+        else
+            entry.texture.SetSubImage(level - entry.allocated, 0, 0, width, height, cooked.ClientFormat(), GL_UNSIGNED_BYTE, data.data());
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    }
+
+    void TextureStreamer::Prefetch(Entry& entry, const int level) {
+        // Fault the level's pages in on the pool; the copy into the staging buffer then never waits on the disk
+        if (entry.prefetch.valid()) entry.prefetch.wait();
+        entry.prefetched = level;
+        entry.prefetch = mPool.Submit([data = entry.file->Level(level)] {
+            unsigned int touched = 0;
+            for (std::size_t offset = 0; offset < data.size(); offset += 4096) touched += static_cast<unsigned int>(data[offset]);
+            [[maybe_unused]] volatile unsigned int sink = touched;
+        });
+    }
+
+    void TextureStreamer::Evict(Entry& entry, const int level) {
+        for (int evicted = entry.resident; evicted < level; ++evicted) {
+            mStats.evictedBytes += LevelBytes(entry, evicted);
+            ++mStats.evictedLevels;
+        }
+        entry.resident = level;
+        entry.uploadedRows = 0;
+        entry.texture.SetLevelRange(entry.resident - entry.allocated, entry.file->Levels() - 1 - entry.allocated);
+    }
+
+}
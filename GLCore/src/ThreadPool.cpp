@@ -0,0 +1,96 @@
+//
+// Created by niek on 11/18/2025.
+//
+
+#include "GLCore/ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace GLCore {
+
+    ThreadPool::ThreadPool(unsigned int threadCount) {
+        if (threadCount == 0) threadCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+        mWorkers.reserve(threadCount);
+        for (unsigned int i = 0; i < threadCount; ++i) mWorkers.emplace_back([this] { WorkerLoop(); });
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard lock(mMutex);
+            mStopping = true;
+        }
+        mWake.notify_all();
+        for (std::thread& worker : mWorkers) worker.join();
+    }
+
+    void ThreadPool::Enqueue(std::function<void()> task) {
+        {
+            std::lock_guard lock(mMutex);
+            mQueue.push_back(std::move(task));
+        }
+        mWake.notify_one();
+    }
+
+    void ThreadPool::WorkerLoop() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(mMutex);
+                mWake.wait(lock, [this] { return mStopping || !mQueue.empty(); });
+                if (mQueue.empty()) return;   // stopping, and everything queued has run
+                task = std::move(mQueue.front());
+                mQueue.pop_front();
+            }
+            task();
+        }
+    }
+
+    void ThreadPool::ParallelFor(const std::size_t count, const std::function<void(std::size_t)>& body) {
+        if (count == 0) return;
+
+        // Shared so helpers that only get scheduled after the loop finished can still look at it safely
+        struct State {
+            std::function<void(std::size_t)> body;
+            std::size_t count = 0;
+            std::atomic<std::size_t> next{0};
+            std::atomic<std::size_t> done{0};
+            std::mutex mutex;
+            std::condition_variable finished;
+            std::exception_ptr error;
+        };
+        const auto state = std::make_shared<State>();
+        state->body = body;
+        state->count = count;
+
+        const auto drain = [](State& s) {
+            for (std::size_t i = s.next.fetch_add(1); i < s.count; i = s.next.fetch_add(1)) {
+                try {
+                    s.body(i);
+                } catch (...) {
+                    std::lock_guard lock(s.mutex);
+                    if (!s.error) s.error = std::current_exception();
+                }
+                if (s.done.fetch_add(1) + 1 == s.count) {
+                    std::lock_guard lock(s.mutex);
+                    s.finished.notify_all();
+                }
+            }
+        };
+
+        const std::size_t helpers = std::min<std::size_t>(mWorkers.size(), count - 1);
+        for (std::size_t h = 0; h < helpers; ++h) Enqueue([state, drain] { drain(*state); });
+        drain(*state);
+
+        std::unique_lock lock(state->mutex);
+        state->finished.wait(lock, [&state] { return state->done.load() == state->count; });
+        if (state->error) std::rethrow_exception(state->error);
+    }
+
+    ThreadPool& ThreadPool::Shared() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+}
@@ -0,0 +1,136 @@
+//
+// Created by niek on 11/10/2025.
+//
+
+#include "GLCore/VertexArray.h"
+#include "GLCore/Caps.h"
+#include "GLCore/Debug.h"
+
+#include <utility>
+
+namespace GLCore {
+
+    VertexArray::VertexArray(const std::string& label) {
+        if (Caps::Get().directStateAccess) {
+            glCreateVertexArrays(1, &mID);
+        } else {
+            glGenVertexArrays(1, &mID);
+            glBindVertexArray(mID);
+            glBindVertexArray(0);
+        }
+        Debug::Label(GL_VERTEX_ARRAY, mID, label.empty() ? "VertexArray" : label);
+    }
+
+    VertexArray::~VertexArray() {
+        if (mID) {
+            glDeleteVertexArrays(1, &mID);
+            mID = 0;
+        }
+    }
+
+    VertexArray::VertexArray(VertexArray&& other) noexcept
+        : mID(std::exchange(other.mID, 0)), mIndexType(other.mIndexType), mStreams(std::move(other.mStreams)) {}
+
+    VertexArray& VertexArray::operator=(VertexArray&& other) noexcept {
+        if (this != &other) {
+            if (mID) glDeleteVertexArrays(1, &mID);
+            mID = std::exchange(other.mID, 0);
+            mIndexType = other.mIndexType;
+            mStreams = std::move(other.mStreams);
+        }
+        return *this;
+    }
+
+    VertexArray::Stream* VertexArray::FindStream(const unsigned int binding) {
+        for (Stream& stream : mStreams)
+            if (stream.binding == binding) return &stream;
+        return nullptr;
+    }
+
+    void VertexArray::SpecifyAttributes(const Stream& stream, const unsigned int bufferID, const std::size_t offset) const {
+        glBindVertexArray(mID);
+        glBindBuffer(GL_ARRAY_BUFFER, bufferID);
+        for (const VertexAttribute& attribute : stream.format.attributes) {
+            const unsigned int location = stream.firstLocation + attribute.location;
+            const auto* pointer = reinterpret_cast<const void*>(offset + attribute.offset);
+            const auto stride = static_cast<GLsizei>(stream.format.stride);
+            if (attribute.mode == AttribMode::Integer)
+                glVertexAttribIPointer(location, attribute.components, attribute.type, stride, pointer);
+            else
+                glVertexAttribPointer(location, attribute.components, attribute.type,
+                                      attribute.mode == AttribMode::Normalized ? GL_TRUE : GL_FALSE, stride, pointer);
+            glEnableVertexAttribArray(location);
+            glVertexAttribDivisor(location, stream.divisor);
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+    }
+
+    void VertexArray::SetVertexFormat(const unsigned int binding, const VertexFormat& format,
+                                      const unsigned int firstLocation, const unsigned int divisor) {
+        Stream* stream = FindStream(binding);
+        if (!stream) stream = &mStreams.emplace_back();
+        *stream = Stream{binding, format, firstLocation, divisor};
+
+        // The classic path can only specify attributes together with a buffer, see RebindVertexBuffer()
+        if (!Caps::Get().directStateAccess) return;
+
+        glVertexArrayBindingDivisor(mID, binding, divisor);
+        for (const VertexAttribute& attribute : format.attributes) {
+            const unsigned int location = firstLocation + attribute.location;
+            glEnableVertexArrayAttrib(mID, location);
+            if (attribute.mode == AttribMode::Integer)
+                glVertexArrayAttribIFormat(mID, location, attribute.components, attribute.type, attribute.offset);
+            else
+                glVertexArrayAttribFormat(mID, location, attribute.components, attribute.type,
+                                          attribute.mode == AttribMode::Normalized ? GL_TRUE : GL_FALSE, attribute.offset);
+            glVertexArrayAttribBinding(mID, location, binding);
+        }
+    }
+
+    void VertexArray::SetVertexBuffer(const unsigned int binding, const Buffer& buffer, const VertexFormat& format,
+                                      const unsigned int firstLocation, const std::size_t offset, const unsigned int divisor) {
+        SetVertexFormat(binding, format, firstLocation, divisor);
+        RebindVertexBuffer(binding, buffer.ID(), offset);
+    }
+
+    void VertexArray::SetVertexBuffer(const unsigned int binding, const VertexBuffer& buffer,
+                                      const unsigned int firstLocation, const unsigned int divisor) {
+        SetVertexBuffer(binding, buffer, buffer.Format(), firstLocation, 0, divisor);
+    }
+
+    void VertexArray::RebindVertexBuffer(const unsigned int binding, const unsigned int bufferID, const std::size_t offset) {
+        const Stream* stream = FindStream(binding);
+        if (!stream) return;
+
+        if (Caps::Get().directStateAccess)
+            glVertexArrayVertexBuffer(mID, binding, bufferID, static_cast<GLintptr>(offset), static_cast<GLsizei>(stream->format.stride));
+        else
+            SpecifyAttributes(*stream, bufferID, offset);
+    }
+
+    void VertexArray::SetIndexBuffer(const IndexBuffer& buffer) {
+        SetIndexBuffer(buffer, buffer.IndexType());
+    }
+
+    void VertexArray::SetIndexBuffer(const Buffer& buffer, const GLenum indexType) {
+        mIndexType = indexType;
+        if (Caps::Get().directStateAccess) {
+            glVertexArrayElementBuffer(mID, buffer.ID());
+            return;
+        }
+        // The element binding is VAO state, so keep the VAO bound while changing it
+        glBindVertexArray(mID);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer.ID());
+        glBindVertexArray(0);
+    }
+
+    void VertexArray::Bind() const {
+        glBindVertexArray(mID);
+    }
+
+    void VertexArray::Unbind() {
+        glBindVertexArray(0);
+    }
+
+}
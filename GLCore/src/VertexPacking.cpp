@@ -0,0 +1,312 @@
+//
+// Created by niek on 11/15/2025.
+//
+
+#include "GLCore/VertexPacking.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GLCORE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace GLCore::VertexPacking {
+
+    namespace {
+        constexpr std::uint16_t kHalfOne = 0x3C00;
+
+        template<int N>
+        glm::vec<N, float> Load(const void* src, const std::size_t stride, const std::uint32_t i) {
+            glm::vec<N, float> v;
+            std::memcpy(&v, static_cast<const std::byte*>(src) + i * stride, sizeof(v));
+            return v;
+        }
+
+        template<class T>
+        void Store(void* dst, const std::size_t stride, const std::uint32_t i, const T& value) {
+            std::memcpy(static_cast<std::byte*>(dst) + i * stride, &value, sizeof(T));
+        }
+
+        // Finite floats only; magnitudes below half's smallest normal flush to zero, above 65504 clamp
+        std::uint16_t FloatToHalf(const float value) {
+            std::uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            const std::uint32_t sign = (bits >> 16) & 0x8000u;
+            const std::uint32_t abs = bits & 0x7FFFFFFFu;
+            if (abs < (113u << 23)) return static_cast<std::uint16_t>(sign);
+            const std::uint32_t half = std::min((abs + 0x1000u - (112u << 23)) >> 13, 0x7BFFu);
+            return static_cast<std::uint16_t>(sign | half);
+        }
+
+        glm::vec2 OctahedralEncode(const glm::vec3& n) {
+            const float inv = 1.0f / std::max(std::abs(n.x) + std::abs(n.y) + std::abs(n.z), 1e-20f);
+            float x = n.x * inv, y = n.y * inv;
+            if (n.z < 0.0f) {
+                const float wx = (1.0f - std::abs(y)) * std::copysign(1.0f, x);
+                const float wy = (1.0f - std::abs(x)) * std::copysign(1.0f, y);
+                x = wx;
+                y = wy;
+            }
+            return {x, y};
+        }
+
+        std::int32_t Snorm10(const float v) {
+            return static_cast<std::int32_t>(std::nearbyint(std::clamp(v, -1.0f, 1.0f) * 511.0f));
+        }
+
+        std::uint32_t Pack1010102(const std::int32_t x, const std::int32_t y, const std::int32_t z, const std::int32_t w) {
+            return (static_cast<std::uint32_t>(x) & 0x3FFu) | (static_cast<std::uint32_t>(y) & 0x3FFu) << 10
+                   | (static_cast<std::uint32_t>(z) & 0x3FFu) << 20 | (static_cast<std::uint32_t>(w) & 0x3u) << 30;
+        }
+
+#ifdef GLCORE_SSE2
+        // Four vertices' worth of one vector attribute, transposed into one register per component
+        template<int N>
+        void Load4(const void* src, const std::size_t stride, const std::uint32_t i, __m128 (&out)[N]) {
+            const glm::vec<N, float> a = Load<N>(src, stride, i), b = Load<N>(src, stride, i + 1),
+                                     c = Load<N>(src, stride, i + 2), d = Load<N>(src, stride, i + 3);
+            for (int k = 0; k < N; ++k) out[k] = _mm_setr_ps(a[k], b[k], c[k], d[k]);
+        }
+
+        __m128 Clamp(const __m128 v, const float lo, const float hi) {
+            return _mm_min_ps(_mm_max_ps(v, _mm_set1_ps(lo)), _mm_set1_ps(hi));
+        }
+
+        __m128i Select(const __m128i mask, const __m128i a, const __m128i b) {
+            return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+        }
+
+        // Same bit recipe as FloatToHalf(), one value per 32-bit lane
+        __m128i FloatToHalf4(const __m128 v) {
+            const __m128i bits = _mm_castps_si128(v);
+            const __m128i sign = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x8000));
+            const __m128i abs = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+            __m128i half = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(abs, _mm_set1_epi32(0x1000)), _mm_set1_epi32(112 << 23)), 13);
+            half = Select(_mm_cmpgt_epi32(half, _mm_set1_epi32(0x7BFF)), _mm_set1_epi32(0x7BFF), half);
+            half = _mm_andnot_si128(_mm_cmplt_epi32(abs, _mm_set1_epi32(113 << 23)), half);
+            return _mm_or_si128(half, sign);
+        }
+
+        void OctahedralEncode4(const __m128 (&n)[3], __m128& outX, __m128& outY) {
+            const __m128 signMask = _mm_set1_ps(-0.0f);
+            const __m128 one = _mm_set1_ps(1.0f);
+            const auto abs = [signMask](const __m128 v) { return _mm_andnot_ps(signMask, v); };
+            const auto copysignOne = [signMask, one](const __m128 v) { return _mm_or_ps(_mm_and_ps(v, signMask), one); };
+
+            const __m128 l1 = _mm_max_ps(_mm_add_ps(_mm_add_ps(abs(n[0]), abs(n[1])), abs(n[2])), _mm_set1_ps(1e-20f));
+            const __m128 inv = _mm_div_ps(one, l1);
+            const __m128 x = _mm_mul_ps(n[0], inv), y = _mm_mul_ps(n[1], inv);
+            const __m128 wx = _mm_mul_ps(_mm_sub_ps(one, abs(y)), copysignOne(x));
+            const __m128 wy = _mm_mul_ps(_mm_sub_ps(one, abs(x)), copysignOne(y));
+            const __m128 lower = _mm_cmplt_ps(n[2], _mm_setzero_ps());
+            outX = _mm_or_ps(_mm_and_ps(lower, wx), _mm_andnot_ps(lower, x));
+            outY = _mm_or_ps(_mm_and_ps(lower, wy), _mm_andnot_ps(lower, y));
+        }
+
+        __m128i Snorm10x4(const __m128 v) {
+            return _mm_cvtps_epi32(_mm_mul_ps(Clamp(v, -1.0f, 1.0f), _mm_set1_ps(511.0f)));
+        }
+
+        __m128i Pack1010102x4(const __m128i x, const __m128i y, const __m128i z, const __m128i w) {
+            const __m128i mask10 = _mm_set1_epi32(0x3FF);
+            return _mm_or_si128(_mm_or_si128(_mm_and_si128(x, mask10), _mm_slli_epi32(_mm_and_si128(y, mask10), 10)),
+                                _mm_or_si128(_mm_slli_epi32(_mm_and_si128(z, mask10), 20), _mm_slli_epi32(w, 30)));
+        }
+
+        void Store4(void* dst, const std::size_t stride, const std::uint32_t i, const __m128i packed) {
+            alignas(16) std::uint32_t lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), packed);
+            for (std::uint32_t k = 0; k < 4; ++k) Store(dst, stride, i + k, lanes[k]);
+        }
+#endif
+    }
+
+    PositionQuantization FitPositions(const void* src, const std::size_t srcStride, const std::uint32_t count) {
+        if (count == 0) return {};
+        glm::vec3 lo(std::numeric_limits<float>::max()), hi(std::numeric_limits<float>::lowest());
+        for (std::uint32_t i = 0; i < count; ++i) {
+            const glm::vec3 p = Load<3>(src, srcStride, i);
+            lo = glm::min(lo, p);
+            hi = glm::max(hi, p);
+        }
+        const glm::vec3 extent = (hi - lo) * 0.5f;
+        return {(lo + hi) * 0.5f, glm::vec3(extent.x > 0.0f ? extent.x : 1.0f, extent.y > 0.0f ? extent.y : 1.0f,
+                                            extent.z > 0.0f ? extent.z : 1.0f)};
+    }
+
+    UVQuantization FitUVs(const void* src, const std::size_t srcStride, const std::uint32_t count) {
+        if (count == 0) return {};
+        glm::vec2 lo(std::numeric_limits<float>::max()), hi(std::numeric_limits<float>::lowest());
+        for (std::uint32_t i = 0; i < count; ++i) {
+            const glm::vec2 uv = Load<2>(src, srcStride, i);
+            lo = glm::min(lo, uv);
+            hi = glm::max(hi, uv);
+        }
+        const glm::vec2 extent = hi - lo;
+        return {lo, glm::vec2(extent.x > 0.0f ? extent.x : 1.0f, extent.y > 0.0f ? extent.y : 1.0f)};
+    }
+
+    void QuantizePositions(const void* src, const std::size_t srcStride, void* dst, const std::size_t dstStride,
+                           const std::uint32_t count, const PositionQuantization& quantization) {
+        const glm::vec3 invScale = 1.0f / quantization.scale;
+        std::uint32_t i = 0;
+#ifdef GLCORE_SSE2
+        for (; i + 4 <= count; i += 4) {
+            __m128 p[3];
+            Load4<3>(src, srcStride, i, p);
+            alignas(16) std::uint32_t halves[3][4];
+            for (int k = 0; k < 3; ++k) {
+                const __m128 q = _mm_mul_ps(_mm_sub_ps(p[k], _mm_set1_ps(quantization.offset[k])), _mm_set1_ps(invScale[k]));
+                _mm_store_si128(reinterpret_cast<__m128i*>(halves[k]), FloatToHalf4(Clamp(q, -1.0f, 1.0f)));
+            }
+            for (std::uint32_t lane = 0; lane < 4; ++lane) {
+                const Half4 h{static_cast<std::uint16_t>(halves[0][lane]), static_cast<std::uint16_t>(halves[1][lane]),
+                              static_cast<std::uint16_t>(halves[2][lane]), kHalfOne};
+                Store(dst, dstStride, i + lane, h);
+            }
+        }
+#endif
+        for (; i < count; ++i) {
+            const glm::vec3 q = glm::clamp((Load<3>(src, srcStride, i) - quantization.offset) * invScale, -1.0f, 1.0f);
+            Store(dst, dstStride, i, Half4{FloatToHalf(q.x), FloatToHalf(q.y), FloatToHalf(q.z), kHalfOne});
+        }
+    }
+
+    void QuantizeNormals(const void* src, const std::size_t srcStride, void* dst, const std::size_t dstStride,
+                         const std::uint32_t count) {
+        std::uint32_t i = 0;
+#ifdef GLCORE_SSE2
+        for (; i + 4 <= count; i += 4) {
+            __m128 n[3];
+            Load4<3>(src, srcStride, i, n);
+            __m128 x, y;
+            OctahedralEncode4(n, x, y);
+            Store4(dst, dstStride, i, Pack1010102x4(Snorm10x4(x), Snorm10x4(y), _mm_setzero_si128(), _mm_setzero_si128()));
+        }
+#endif
+        for (; i < count; ++i) {
+            const glm::vec2 e = OctahedralEncode(Load<3>(src, srcStride, i));
+            Store(dst, dstStride, i, PackedSnorm1010102{Pack1010102(Snorm10(e.x), Snorm10(e.y), 0, 0)});
+        }
+    }
+
+    void QuantizeTangents(const void* src, const std::size_t srcStride, void* dst, const std::size_t dstStride,
+                          const std::uint32_t count) {
+        std::uint32_t i = 0;
+#ifdef GLCORE_SSE2
+        for (; i + 4 <= count; i += 4) {
+            __m128 t[4];
+            Load4<4>(src, srcStride, i, t);
+            __m128 x, y;
+            OctahedralEncode4({t[0], t[1], t[2]}, x, y);
+            // Handedness as 2-bit snorm: +1 -> 1, -1 -> 3
+            const __m128i negative = _mm_castps_si128(_mm_cmplt_ps(t[3], _mm_setzero_ps()));
+            const __m128i w = Select(negative, _mm_set1_epi32(3), _mm_set1_epi32(1));
+            Store4(dst, dstStride, i, Pack1010102x4(Snorm10x4(x), Snorm10x4(y), _mm_setzero_si128(), w));
+        }
+#endif
+        for (; i < count; ++i) {
+            const glm::vec4 t = Load<4>(src, srcStride, i);
+            const glm::vec2 e = OctahedralEncode(glm::vec3(t));
+            Store(dst, dstStride, i, PackedSnorm1010102{Pack1010102(Snorm10(e.x), Snorm10(e.y), 0, t.w < 0.0f ? -1 : 1)});
+        }
+    }
+
+    void QuantizeUVs(const void* src, const std::size_t srcStride, void* dst, const std::size_t dstStride,
+                     const std::uint32_t count, const UVQuantization& quantization) {
+        const glm::vec2 invScale = 1.0f / quantization.scale;
+        std::uint32_t i = 0;
+#ifdef GLCORE_SSE2
+        for (; i + 4 <= count; i += 4) {
+            __m128 uv[2];
+            Load4<2>(src, srcStride, i, uv);
+            __m128i q[2];
+            for (int k = 0; k < 2; ++k) {
+                const __m128 t = Clamp(_mm_mul_ps(_mm_sub_ps(uv[k], _mm_set1_ps(quantization.offset[k])), _mm_set1_ps(invScale[k])), 0.0f, 1.0f);
+                q[k] = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(t, _mm_set1_ps(65535.0f)), _mm_set1_ps(0.5f)));
+            }
+            Store4(dst, dstStride, i, _mm_or_si128(q[0], _mm_slli_epi32(q[1], 16)));
+        }
+#endif
+        for (; i < count; ++i) {
+            const glm::vec2 t = glm::clamp((Load<2>(src, srcStride, i) - quantization.offset) * invScale, 0.0f, 1.0f);
+            Store(dst, dstStride, i, glm::u16vec2(static_cast<std::uint16_t>(t.x * 65535.0f + 0.5f),
+                                                  static_cast<std::uint16_t>(t.y * 65535.0f + 0.5f)));
+        }
+    }
+
+    void QuantizeColors(const void* src, const std::size_t srcStride, void* dst, const std::size_t dstStride,
+                        const std::uint32_t count) {
+        std::uint32_t i = 0;
+#ifdef GLCORE_SSE2
+        for (; i + 4 <= count; i += 4) {
+            __m128 c[4];
+            Load4<4>(src, srcStride, i, c);
+            __m128i q[4];
+            for (int k = 0; k < 4; ++k)
+                q[k] = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(Clamp(c[k], 0.0f, 1.0f), _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f)));
+            Store4(dst, dstStride, i, _mm_or_si128(_mm_or_si128(q[0], _mm_slli_epi32(q[1], 8)),
+                                                   _mm_or_si128(_mm_slli_epi32(q[2], 16), _mm_slli_epi32(q[3], 24))));
+        }
+#endif
+        for (; i < count; ++i) {
+            const glm::vec4 c = glm::clamp(Load<4>(src, srcStride, i), 0.0f, 1.0f) * 255.0f + 0.5f;
+            Store(dst, dstStride, i, glm::u8vec4(c));
+        }
+    }
+
+    PackedMesh PackMesh(const MeshData& mesh) {
+        PackedMesh packed;
+        const auto count = static_cast<std::uint32_t>(mesh.vertices.size());
+        packed.vertices.resize(count);
+        packed.indices = mesh.indices;
+        if (count == 0) return packed;
+
+        const MeshVertex* src = mesh.vertices.data();
+        PackedMeshVertex* dst = packed.vertices.data();
+        constexpr std::size_t srcStride = sizeof(MeshVertex), dstStride = sizeof(PackedMeshVertex);
+
+        packed.position = FitPositions(&src->position, srcStride, count);
+        packed.uv = FitUVs(&src->uv, srcStride, count);
+        QuantizePositions(&src->position, srcStride, &dst->position, dstStride, count, packed.position);
+        QuantizeNormals(&src->normal, srcStride, &dst->normal, dstStride, count);
+        QuantizeUVs(&src->uv, srcStride, &dst->uv, dstStride, count, packed.uv);
+        return packed;
+    }
+
+    float HalfToFloat(const std::uint16_t half) {
+        const std::uint32_t sign = static_cast<std::uint32_t>(half & 0x8000u) << 16;
+        const std::uint32_t exponent = (half >> 10) & 0x1Fu;
+        const std::uint32_t mantissa = half & 0x3FFu;
+
+        float value;
+        if (exponent == 0) {
+            value = std::ldexp(static_cast<float>(mantissa), -24);
+        } else if (exponent == 31) {
+            value = mantissa ? std::numeric_limits<float>::quiet_NaN() : std::numeric_limits<float>::infinity();
+        } else {
+            const std::uint32_t bits = ((exponent + 112) << 23) | (mantissa << 13);
+            std::memcpy(&value, &bits, sizeof(value));
+        }
+        return sign ? -value : value;
+    }
+
+    glm::vec3 DecodeOctahedral(const PackedSnorm1010102 packed) {
+        // Sign-extend the 10-bit fields
+        const auto field = [&packed](const int shift) {
+            const auto raw = static_cast<std::int32_t>(packed.bits << (22 - shift)) >> 22;
+            return std::max(static_cast<float>(raw) / 511.0f, -1.0f);
+        };
+        glm::vec3 n(field(0), field(10), 0.0f);
+        n.z = 1.0f - std::abs(n.x) - std::abs(n.y);
+        const float t = std::max(-n.z, 0.0f);
+        n.x += n.x >= 0.0f ? -t : t;
+        n.y += n.y >= 0.0f ? -t : t;
+        return glm::normalize(n);
+    }
+
+}
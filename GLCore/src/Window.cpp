@@ -3,12 +3,20 @@
 //
 
 #include "GLCore/Window.h"
+#include "GLCore/Caps.h"
+#include "GLCore/Debug.h"
 
 #include "glad/glad.h"
 #include <GLFW/glfw3.h>
 
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <cmath>
 #include <stdexcept>
+#include <thread>
+#include <utility>
 
 namespace GLCore {
 
@@ -16,6 +24,25 @@ namespace GLCore {
         GLFWwindow* handle{nullptr};
         WindowProperties props{};
 
+        // Latest framebuffer size reported by GLFW; coalesced until consumed once per frame
+        int pendingWidth{0};
+        int pendingHeight{0};
+        bool resizePending{false};
+
+        // Presentation timing
+        using Clock = std::chrono::steady_clock;
+        static constexpr int kTimingSamples = 120;
+        std::array<double, kTimingSamples> swapIntervalsMs{};
+        int swapSampleCount{0};
+        int swapSampleIndex{0};
+        Clock::time_point lastSwap{};
+
+        // Frame limiter: sleep until spinThreshold before the deadline, then spin the rest
+        Clock::time_point nextDeadline{};
+        Clock::duration spinThreshold{std::chrono::microseconds(1500)};
+
+        static constexpr std::pair<int, int> kContextVersions[] = {{4, 6}, {4, 5}, {4, 3}, {4, 1}, {3, 3}};
+
         static std::atomic<int> sWindowCount;
         static std::atomic<bool> sGLFWInitialized;
         static std::atomic<bool> sGLADLoaded;
@@ -23,12 +50,15 @@ namespace GLCore {
         explicit Impl(const WindowProperties& p) : props(p) {
             InitializeGLFWOnce();
 
-            // Set for OpenGL 3.3
-            glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-            glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+            // Request the highest core version available, down to OpenGL 3.3
             glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-
-            handle = glfwCreateWindow(props.width, props.height, props.title, nullptr, nullptr);
+            glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, props.debugContext ? GLFW_TRUE : GLFW_FALSE);
+            for (const auto& [major, minor] : kContextVersions) {
+                glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, major);
+                glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, minor);
+                handle = glfwCreateWindow(props.width, props.height, props.title, nullptr, nullptr);
+                if (handle) break;
+            }
             if (!handle) {
                 TerminateGLFWIfLast();
                 throw std::runtime_error("Failed to create GLFW window");
@@ -37,6 +67,7 @@ namespace GLCore {
             ++sWindowCount;
             glfwMakeContextCurrent(handle);
             glfwSetWindowUserPointer(handle, this);
+            ApplySwapInterval(props.vsync);
 
             // Load GLAD once per process (after a context is current)
             if (!sGLADLoaded.load()) {
@@ -47,21 +78,26 @@ namespace GLCore {
                     throw std::runtime_error("Failed to load GLAD");
                 }
                 sGLADLoaded = true;
+                Caps::Load();
             }
 
-            // Initial viewport and resize callback
+            if (props.debugContext) Debug::Enable();
+
+            // Initial viewport; later resizes are only recorded here and applied by the owner
             glViewport(0, 0, props.width, props.height);
             glfwSetFramebufferSizeCallback(handle, [](GLFWwindow* win, const int w, const int h) {
+                if (w <= 0 || h <= 0) return; // minimized, keep the last valid size
                 if (Impl* self = static_cast<Impl*>(glfwGetWindowUserPointer(win))) {
-                    self->props.width = w;
-                    self->props.height = h;
+                    self->pendingWidth = w;
+                    self->pendingHeight = h;
+                    self->resizePending = true;
                 }
-                glViewport(0, 0, w, h);
             });
         }
 
         ~Impl() {
             if (handle) {
+                Debug::OnContextDestroyed(handle);
                 glfwDestroyWindow(handle);
                 handle = nullptr;
                 --sWindowCount;
@@ -69,6 +105,57 @@ namespace GLCore {
             TerminateGLFWIfLast();
         }
 
+        void ApplySwapInterval(VSyncMode mode) {
+            int interval = mode == VSyncMode::Off ? 0 : 1;
+            if (mode == VSyncMode::Adaptive) {
+                if (glfwExtensionSupported("WGL_EXT_swap_control_tear") || glfwExtensionSupported("GLX_EXT_swap_control_tear"))
+                    interval = -1;
+                else
+                    mode = VSyncMode::On; // tearing swaps unavailable, fall back to regular vsync
+            }
+            glfwSwapInterval(interval);
+            props.vsync = mode;
+        }
+
+        void LimitFrameRate() {
+            if (props.vsync != VSyncMode::Off || props.maxFrameRate <= 0.0) return;
+
+            const auto period = std::chrono::duration_cast<Clock::duration>(
+                std::chrono::duration<double>(1.0 / props.maxFrameRate));
+            const Clock::time_point now = Clock::now();
+
+            // Re-anchor after a long frame instead of bursting to catch up
+            if (nextDeadline == Clock::time_point{} || now - nextDeadline > period)
+                nextDeadline = now;
+
+            // Coarse sleep, leaving a margin for the scheduler to overshoot into
+            const Clock::duration remaining = nextDeadline - now;
+            if (remaining > spinThreshold) {
+                const Clock::duration request = remaining - spinThreshold;
+                std::this_thread::sleep_for(request);
+                const Clock::duration overshoot = Clock::now() - now - request;
+
+                // Track the worst recent overshoot, decaying slowly so the spin margin can shrink again
+                constexpr Clock::duration minSpin = std::chrono::microseconds(250);
+                constexpr Clock::duration maxSpin = std::chrono::milliseconds(4);
+                spinThreshold = std::clamp(std::max(overshoot, spinThreshold - spinThreshold / 64), minSpin, maxSpin);
+            }
+
+            // Precise spin to the deadline
+            while (Clock::now() < nextDeadline) { }
+            nextDeadline += period;
+        }
+
+        void RecordSwap() {
+            const Clock::time_point now = Clock::now();
+            if (lastSwap != Clock::time_point{}) {
+                swapIntervalsMs[swapSampleIndex] = std::chrono::duration<double, std::milli>(now - lastSwap).count();
+                swapSampleIndex = (swapSampleIndex + 1) % kTimingSamples;
+                swapSampleCount = std::min(swapSampleCount + 1, kTimingSamples);
+            }
+            lastSwap = now;
+        }
+
         static void InitializeGLFWOnce() {
             bool expected = false;
             if (sGLFWInitialized.compare_exchange_strong(expected, true)) {
@@ -106,14 +193,76 @@ namespace GLCore {
         return mImpl ? glfwWindowShouldClose(mImpl->handle) != 0 : true;
     }
 
+    void Window::RequestClose() const {
+        if (mImpl && mImpl->handle) glfwSetWindowShouldClose(mImpl->handle, GLFW_TRUE);
+    }
+
     void Window::SwapBuffers() const {
-        if (mImpl && mImpl->handle) glfwSwapBuffers(mImpl->handle);
+        if (!mImpl || !mImpl->handle) return;
+        mImpl->LimitFrameRate();
+        glfwSwapBuffers(mImpl->handle);
+        mImpl->RecordSwap();
+        if (Debug::IsEnabled()) Debug::EndFrame();
     }
 
     void Window::PollEvents() {
         glfwPollEvents();
     }
 
+    bool Window::ConsumePendingResize(int& width, int& height) {
+        if (!mImpl || !mImpl->resizePending) return false;
+        mImpl->resizePending = false;
+        if (mImpl->pendingWidth == mImpl->props.width && mImpl->pendingHeight == mImpl->props.height)
+            return false;
+
+        mImpl->props.width = mImpl->pendingWidth;
+        mImpl->props.height = mImpl->pendingHeight;
+        width = mImpl->props.width;
+        height = mImpl->props.height;
+        return true;
+    }
+
+    void Window::SetVSync(const VSyncMode mode) {
+        if (!mImpl || !mImpl->handle) return;
+        if (glfwGetCurrentContext() != mImpl->handle) glfwMakeContextCurrent(mImpl->handle);
+        mImpl->ApplySwapInterval(mode);
+        mImpl->nextDeadline = {};
+    }
+
+    VSyncMode Window::GetVSync() const { return mImpl ? mImpl->props.vsync : VSyncMode::On; }
+
+    void Window::SetFrameRateLimit(const double framesPerSecond) {
+        if (!mImpl) return;
+        mImpl->props.maxFrameRate = std::max(0.0, framesPerSecond);
+        mImpl->nextDeadline = {};
+    }
+
+    FrameTiming Window::GetFrameTiming() const {
+        FrameTiming timing{};
+        if (!mImpl || mImpl->swapSampleCount == 0) return timing;
+
+        const int count = mImpl->swapSampleCount;
+        double sum = 0.0;
+        timing.minMs = mImpl->swapIntervalsMs[0];
+        timing.maxMs = mImpl->swapIntervalsMs[0];
+        for (int i = 0; i < count; ++i) {
+            const double ms = mImpl->swapIntervalsMs[i];
+            sum += ms;
+            timing.minMs = std::min(timing.minMs, ms);
+            timing.maxMs = std::max(timing.maxMs, ms);
+        }
+        timing.averageMs = sum / count;
+
+        double variance = 0.0;
+        for (int i = 0; i < count; ++i) {
+            const double d = mImpl->swapIntervalsMs[i] - timing.averageMs;
+            variance += d * d;
+        }
+        timing.jitterMs = std::sqrt(variance / count);
+        timing.sampleCount = count;
+        return timing;
+    }
+
     int Window::Width() const { return mImpl ? mImpl->props.width : 0; }
     int Window::Height() const { return mImpl ? mImpl->props.height : 0; }
     const char* Window::Title() const { return mImpl ? mImpl->props.title : ""; }
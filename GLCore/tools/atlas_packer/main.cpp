@@ -0,0 +1,151 @@
+//
+// Created by niek on 11/26/2025.
+//
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <GLCore/Atlas.h>
+#include <GLCore/Image.h>
+using namespace GLCore;
+
+namespace {
+    bool IsImage(const std::filesystem::path& path) {
+        std::string ext = path.extension().string();
+        std::transform(ext.begin(), ext.end(), ext.begin(), [](const unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".tga" || ext == ".bmp" || ext == ".psd"
+               || ext == ".gif" || ext == ".ppm" || ext == ".pgm" || ext == ".qoi";
+    }
+
+    // "ui/button-ok" -> "ui_button_ok"
+    // C++20 keywords and alternative tokens: a sprite called "new" or "and" gets a trailing '_'
+    constexpr std::string_view kKeywords[] = {
+        "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor", "bool", "break", "case", "catch", "char",
+        "char8_t", "char16_t", "char32_t", "class", "compl", "concept", "const", "consteval", "constexpr", "constinit",
+        "const_cast", "continue", "co_await", "co_return", "co_yield", "decltype", "default", "delete", "do", "double",
+        "dynamic_cast", "else", "enum", "explicit", "export", "extern", "false", "float", "for", "friend", "goto", "if",
+        "inline", "int", "long", "mutable", "namespace", "new", "noexcept", "not", "not_eq", "nullptr", "operator", "or",
+        "or_eq", "private", "protected", "public", "register", "reinterpret_cast", "requires", "return", "short", "signed",
+        "sizeof", "static", "static_assert", "static_cast", "struct", "switch", "template", "this", "thread_local", "throw",
+        "true", "try", "typedef", "typeid", "typename", "union", "unsigned", "using", "virtual", "void", "volatile",
+        "wchar_t", "while", "xor", "xor_eq"};
+
+    std::string Identifier(const std::string& name) {
+        std::string id;
+        for (const char c : name) id += std::isalnum(static_cast<unsigned char>(c)) ? c : '_';
+        if (id.empty() || std::isdigit(static_cast<unsigned char>(id[0]))) id.insert(id.begin(), '_');
+        if (std::find(std::begin(kKeywords), std::end(kKeywords), id) != std::end(kKeywords)) id += '_';
+        return id;
+    }
+
+    // Different names can sanitize to the same identifier ("ui/button-ok" and "ui/button_ok", or "new" and "new_"),
+    // which would not compile
+    void CheckIdentifiers(const std::vector<std::string>& names) {
+        std::unordered_map<std::string, std::size_t> identifiers;
+        for (std::size_t i = 0; i < names.size(); ++i) {
+            const auto [it, inserted] = identifiers.emplace(Identifier(names[i]), i);
+            if (!inserted)
+                throw std::runtime_error("ERROR::ATLAS_PACKER::IDENTIFIER_COLLISION: '" + names[it->second] + "' and '" + names[i]
+                                         + "' both become " + it->first);
+        }
+    }
+
+    void WriteIdHeader(const std::string& path, const std::string& atlas, const std::vector<std::string>& names,
+                       const std::vector<std::uint32_t>& ids) {
+        const std::string space = Identifier(std::filesystem::path(atlas).stem().string()) + "_sprites";
+        std::string guard = space + "_H";
+
+        std::transform(guard.begin(), guard.end(), guard.begin(), [](const unsigned char c) { return static_cast<char>(std::toupper(c)); });
+
+        std::ofstream file(path);
+        file << "// Generated by AtlasPacker for " << std::filesystem::path(atlas).filename().string() << "; do not edit.\n\n"
+             << "#ifndef " << guard << "\n#define " << guard << "\n\n#include <cstdint>\n\nnamespace " << space << " {\n";
+        for (std::size_t i = 0; i < names.size(); ++i)
+            file << "    inline constexpr std::uint32_t " << Identifier(names[i]) << " = " << ids[i] << ";\n";
+        file << "}\n\n#endif //" << guard << "\n";
+        if (!file) throw std::runtime_error("ERROR::ATLAS_PACKER::FILE_NOT_WRITABLE: " + path);
+    }
+}
+
+/**
+ * Offline atlas packer: every image below a directory -> one .gatlas file (see Atlas.h).
+ * Usage: AtlasPacker <input dir> [output.gatlas] [--max-size N] [--gutter N] [--mips N] [--linear] [--header ids.h] [--quiet]
+ * Sprite names are paths relative to the input directory, '/'-separated and without extension ("ui/button").
+ * Writes <input dir>.gatlas when no output is given. --header also writes the sprite IDs as constexpr constants, so
+ * runtime code draws by ID without a name lookup.
+ */
+int main(const int argc, char** argv) {
+    std::string input, output, header;
+    AtlasSettings settings;
+    bool quiet = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--max-size" && i + 1 < argc) settings.maxSize = std::atoi(argv[++i]);
+        else if (arg == "--gutter" && i + 1 < argc) settings.gutter = std::atoi(argv[++i]);
+        else if (arg == "--mips" && i + 1 < argc) settings.mipLevels = std::atoi(argv[++i]);
+        else if (arg == "--linear") settings.srgb = false;
+        else if (arg == "--header" && i + 1 < argc) header = argv[++i];
+        else if (arg == "--quiet") quiet = true;
+        else if (input.empty()) input = arg;
+        else output = arg;
+    }
+    if (input.empty()) {
+        std::cerr << "Usage: AtlasPacker <input dir> [output.gatlas] [--max-size N] [--gutter N] [--mips N] [--linear] "
+                     "[--header ids.h] [--quiet]" << std::endl;
+        return 1;
+    }
+    const std::filesystem::path root = std::filesystem::path(input).lexically_normal();
+    if (output.empty()) {
+        std::filesystem::path dir = root.has_filename() ? root : root.parent_path();
+        output = dir.replace_extension(".gatlas").string();
+    }
+
+    try {
+        if (!std::filesystem::is_directory(root)) throw std::runtime_error("ERROR::ATLAS_PACKER::NOT_A_DIRECTORY: " + input);
+        std::vector<std::filesystem::path> files;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(root)) {
+            if (entry.is_regular_file() && IsImage(entry.path())) files.push_back(entry.path());
+        }
+        std::sort(files.begin(), files.end());
+        if (files.empty()) throw std::runtime_error("ERROR::ATLAS_PACKER::NO_IMAGES: " + input);
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::string> names;
+        std::vector<Image> images;
+        for (const std::filesystem::path& file : files)
+            names.push_back(std::filesystem::relative(file, root).replace_extension().generic_string());
+        if (!header.empty()) CheckIdentifiers(names);
+        for (const std::filesystem::path& file : files) images.push_back(LoadImageFile(file.string()));
+        const double loadMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        std::vector<std::uint32_t> ids;
+        const AtlasLayout layout = CookAtlas(names, images, output, settings, &ids);
+        const double cookMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (!header.empty()) WriteIdHeader(header, output, names, ids);
+
+        if (!quiet) {
+            std::cout << input << " -> " << output << ": " << images.size() << " sprites, " << layout.pages << " page"
+                      << (layout.pages == 1 ? "" : "s") << " of " << layout.width << "x" << layout.height << ", "
+                      << std::fixed << std::setprecision(1) << layout.Occupancy() * 100.0 << "% occupied\n"
+                      << "  " << std::setprecision(2) << static_cast<double>(std::filesystem::file_size(output)) / (1024.0 * 1024.0)
+                      << " MB, load " << loadMs << " ms, pack + mips + write " << cookMs << " ms" << std::endl;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,61 @@
+//
+// Created by niek on 11/20/2025.
+//
+
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <GLCore/CookedMesh.h>
+#include <GLCore/GltfLoader.h>
+#include <GLCore/ObjLoader.h>
+using namespace GLCore;
+
+/**
+ * Offline mesh cooker: source mesh -> .gmesh (see CookedMesh.h) for zero-parse loading at runtime.
+ * Usage: MeshCooker <input.obj|.gltf|.glb> [output.gmesh] [--packed] [--lods N] [--no-meshlets] [--quiet]
+ * Writes next to the input with a .gmesh extension when no output is given. LODs already present as
+ * "lodN error=E" groups (MeshOptimizer --lods) are kept; --lods N generates a chain otherwise.
+ */
+int main(const int argc, char** argv) {
+    std::string input, output;
+    CookSettings settings;
+    bool quiet = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--packed") settings.packVertices = true;
+        else if (arg == "--lods" && i + 1 < argc) settings.maxLods = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        else if (arg == "--no-meshlets") settings.meshlets = false;
+        else if (arg == "--quiet") quiet = true;
+        else if (input.empty()) input = arg;
+        else output = arg;
+    }
+    if (input.empty()) {
+        std::cerr << "Usage: MeshCooker <input.obj|.gltf|.glb> [output.gmesh] [--packed] [--lods N] [--no-meshlets] [--quiet]" << std::endl;
+        return 1;
+    }
+    if (output.empty()) output = std::filesystem::path(input).replace_extension(".gmesh").string();
+
+    try {
+        const std::string extension = std::filesystem::path(input).extension().string();
+        const MeshData mesh = extension == ".gltf" || extension == ".glb" ? LoadGltf(input).geometry : LoadObj(input);
+        CookMesh(mesh, output, settings);
+
+        if (!quiet) {
+            const CookedMesh cooked(output);
+            const CookedMeshHeader& header = cooked.Header();
+            std::cout << input << " -> " << output << ": " << std::fixed << std::setprecision(2)
+                      << static_cast<double>(cooked.FileSize()) / (1024.0 * 1024.0) << " MB\n"
+                      << "  " << header.vertexCount << " vertices x " << header.vertexStride << " bytes, "
+                      << header.indexCount / 3 << " triangles, " << header.groupCount << " groups\n"
+                      << "  " << header.lodCount << " LODs, " << header.meshletCount << " meshlets" << std::endl;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,90 @@
+//
+// Created by niek on 11/15/2025.
+//
+
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <GLCore/MeshData.h>
+#include <GLCore/MeshLod.h>
+#include <GLCore/MeshOptimizer.h>
+#include <GLCore/ObjLoader.h>
+using namespace GLCore;
+
+/**
+ * Offline mesh optimizer: vertex cache order (Tipsify), overdraw cluster order, vertex fetch remap.
+ * Usage: MeshOptimizer <input.obj> [output.obj] [--cache N] [--overdraw THRESHOLD] [--lods N] [--quiet]
+ * Writes to the input path when no output is given. Prints ACMR/ATVR before and after.
+ * With --lods N (N > 1) a LOD chain is appended as OBJ groups "lod0 error=E" ... sharing one vertex list.
+ */
+int main(const int argc, char** argv) {
+    std::string input, output;
+    std::uint32_t cacheSize = 16;
+    float threshold = 1.05f;
+    std::uint32_t lodCount = 1;
+    bool quiet = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--cache" && i + 1 < argc) cacheSize = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        else if (arg == "--overdraw" && i + 1 < argc) threshold = std::strtof(argv[++i], nullptr);
+        else if (arg == "--lods" && i + 1 < argc) lodCount = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        else if (arg == "--quiet") quiet = true;
+        else if (input.empty()) input = arg;
+        else output = arg;
+    }
+    if (input.empty()) {
+        std::cerr << "Usage: MeshOptimizer <input.obj> [output.obj] [--cache N] [--overdraw THRESHOLD] [--lods N] [--quiet]" << std::endl;
+        return 1;
+    }
+    if (output.empty()) output = input;
+
+    try {
+        ObjLoadStats load;
+        MeshData mesh = LoadObj(input, ThreadPool::Shared(), &load);
+        const auto vertexCount = static_cast<std::uint32_t>(mesh.vertices.size());
+        const MeshOptimizer::VertexCacheStats before = MeshOptimizer::AnalyzeVertexCache(mesh.indices, vertexCount, cacheSize);
+
+        // A LOD chain replaces the groups; otherwise each group is optimized within its own range
+        if (lodCount > 1) mesh.groups.clear();
+        std::vector<MeshGroup> ranges = mesh.groups;
+        if (ranges.empty()) ranges.push_back({"", 0, static_cast<std::uint32_t>(mesh.indices.size())});
+        else if (ranges.front().firstIndex > 0) ranges.insert(ranges.begin(), {"", 0, ranges.front().firstIndex});   // faces before the first group
+        for (const MeshGroup& range : ranges) {
+            const std::span<const std::uint32_t> source(mesh.indices.data() + range.firstIndex, range.indexCount);
+            std::vector<std::uint32_t> optimized = MeshOptimizer::OptimizeVertexCache(source, vertexCount, cacheSize);
+            if (threshold > 0.0f)
+                optimized = MeshOptimizer::OptimizeOverdraw(optimized, mesh.vertices.data(), vertexCount, sizeof(MeshVertex),
+                                                            cacheSize, threshold);
+            std::ranges::copy(optimized, mesh.indices.begin() + range.firstIndex);
+        }
+
+        std::vector<MeshLod> lods;
+        if (lodCount > 1) lods = GenerateLods(mesh, LodSettings{.maxLods = lodCount});
+        mesh.vertices.resize(MeshOptimizer::OptimizeVertexFetch(mesh.vertices.data(), vertexCount, sizeof(MeshVertex), mesh.indices));
+
+        const std::span<const std::uint32_t> lod0(mesh.indices.data(), lods.empty() ? mesh.indices.size() : lods[0].indexCount);
+        const MeshOptimizer::VertexCacheStats after =
+            MeshOptimizer::AnalyzeVertexCache(lod0, static_cast<std::uint32_t>(mesh.vertices.size()), cacheSize);
+        SaveObj(mesh, output);
+
+        if (!quiet) {
+            std::cout << input << ": " << lod0.size() / 3 << " triangles, " << mesh.vertices.size() << " vertices\n"
+                      << std::fixed << std::setprecision(1)
+                      << "  load " << load.totalMs << " ms (" << load.megabytesPerSecond << " MB/s, " << load.threads << " threads)\n"
+                      << std::setprecision(3)
+                      << "  ACMR " << before.acmr << " -> " << after.acmr << '\n'
+                      << "  ATVR " << before.atvr << " -> " << after.atvr << std::endl;
+            for (std::size_t i = 0; i < lods.size(); ++i)
+                std::cout << "  LOD " << i << ": " << lods[i].indexCount / 3 << " triangles, error " << std::setprecision(5)
+                          << lods[i].error << std::endl;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,78 @@
+//
+// Created by niek on 11/28/2025.
+//
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <GLCore/Image.h>
+#include <GLCore/Qoi.h>
+using namespace GLCore;
+
+/**
+ * Offline image converter: any image stb_image reads -> .qoi (see Qoi.h), lossless.
+ * Usage: QoiConverter <input image> [output.qoi] [--linear] [--quiet]
+ * Writes next to the input with a .qoi extension when no output is given. --linear marks the file as linear data
+ * (normal maps, masks) in the header; the pixels are the same either way.
+ */
+int main(const int argc, char** argv) {
+    std::string input, output;
+    bool srgb = true;
+    bool quiet = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--linear") srgb = false;
+        else if (arg == "--quiet") quiet = true;
+        else if (input.empty()) input = arg;
+        else output = arg;
+    }
+    if (input.empty()) {
+        std::cerr << "Usage: QoiConverter <input image> [output.qoi] [--linear] [--quiet]" << std::endl;
+        return 1;
+    }
+    if (output.empty()) output = std::filesystem::path(input).replace_extension(".qoi").string();
+
+    try {
+        // Top row first, as QOI stores it
+        auto start = std::chrono::steady_clock::now();
+        const Image source = LoadImageFile(input, false);
+        const double loadMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        start = std::chrono::steady_clock::now();
+        const std::vector<std::uint8_t> encoded = EncodeQoi(source, false, srgb);
+        const double encodeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        std::ofstream file(output, std::ios::binary);
+        if (!file.write(reinterpret_cast<const char*>(encoded.data()), static_cast<std::streamsize>(encoded.size())))
+            throw std::runtime_error("ERROR::QOI_CONVERTER::FILE_NOT_WRITABLE: " + output);
+        file.close();
+
+        if (!quiet) {
+            start = std::chrono::steady_clock::now();
+            const Image decoded = DecodeQoi(std::as_bytes(std::span(encoded)), false, output);
+            const double decodeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            const double inputMB = static_cast<double>(std::filesystem::file_size(input)) / (1024.0 * 1024.0);
+            const double outputMB = static_cast<double>(encoded.size()) / (1024.0 * 1024.0);
+            const double rawMB = static_cast<double>(decoded.pixels.size()) / (1024.0 * 1024.0);
+            std::cout << input << " -> " << output << ": " << std::fixed << std::setprecision(2) << inputMB << " -> "
+                      << outputMB << " MB (" << rawMB / outputMB << ":1 vs raw RGBA)\n"
+                      << "  " << source.width << "x" << source.height << ", " << source.channels << " channels\n"
+                      << "  source decode " << loadMs << " ms, QOI encode " << encodeMs << " ms, QOI decode " << decodeMs
+                      << " ms (" << rawMB / (decodeMs / 1000.0) << " MB/s)" << std::endl;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,114 @@
+//
+// Created by niek on 11/23/2025.
+//
+
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <GLCore/BlockCompression.h>
+#include <GLCore/CookedTexture.h>
+#include <GLCore/Image.h>
+#include <GLCore/MipGenerator.h>
+using namespace GLCore;
+
+/**
+ * Offline texture cooker: source image -> .gtex (see CookedTexture.h) with a CPU-filtered mip chain.
+ * Usage: TextureCooker <input image> [output.gtex] [--filter box|kaiser|lanczos] [--linear] [--no-premultiply]
+ *                      [--wrap] [--levels N] [--bc auto|bc1|bc3|bc4|bc5|bc7] [--quality fast|normal|high] [--quiet]
+ * Writes next to the input with a .gtex extension when no output is given. --linear is for data textures
+ * (normal, roughness, masks): no sRGB conversion while filtering and an RGBA8 format instead of SRGB8_ALPHA8.
+ * --bc block-compresses every level; auto picks BC4 for grey, BC5 for grey + alpha and BC7 otherwise.
+ */
+int main(const int argc, char** argv) {
+    std::string input, output;
+    MipSettings settings;
+    TextureCookSettings cook;
+    std::string bc;
+    bool quiet = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--filter" && i + 1 < argc) {
+            const std::string filter = argv[++i];
+            settings.filter = filter == "box" ? MipFilter::Box : filter == "lanczos" ? MipFilter::Lanczos3 : MipFilter::Kaiser;
+        } else if (arg == "--linear") settings.srgb = false;
+        else if (arg == "--no-premultiply") settings.premultiplyAlpha = false;
+        else if (arg == "--wrap") settings.wrap = true;
+        else if (arg == "--levels" && i + 1 < argc) settings.maxLevels = std::atoi(argv[++i]);
+        else if (arg == "--bc" && i + 1 < argc) bc = argv[++i];
+        else if (arg == "--quality" && i + 1 < argc) {
+            const std::string quality = argv[++i];
+            cook.quality = quality == "fast" ? BlockQuality::Fast : quality == "high" ? BlockQuality::High : BlockQuality::Normal;
+        }
+        else if (arg == "--quiet") quiet = true;
+        else if (input.empty()) input = arg;
+        else output = arg;
+    }
+    if (input.empty()) {
+        std::cerr << "Usage: TextureCooker <input image> [output.gtex] [--filter box|kaiser|lanczos] [--linear] "
+                     "[--no-premultiply] [--wrap] [--levels N] [--bc auto|bc1|bc3|bc4|bc5|bc7] [--quality fast|normal|high] "
+                     "[--quiet]" << std::endl;
+        return 1;
+    }
+    if (output.empty()) output = std::filesystem::path(input).replace_extension(".gtex").string();
+
+    try {
+        const Image source = LoadImageFile(input);
+        if (bc == "auto") cook.compression = source.channels == 1 ? BlockFormat::BC4 : source.channels == 2 ? BlockFormat::BC5 : BlockFormat::BC7;
+        else if (bc == "bc1") cook.compression = BlockFormat::BC1;
+        else if (bc == "bc3") cook.compression = BlockFormat::BC3;
+        else if (bc == "bc4") cook.compression = BlockFormat::BC4;
+        else if (bc == "bc5") cook.compression = BlockFormat::BC5;
+        else if (bc == "bc7") cook.compression = BlockFormat::BC7;
+        else if (!bc.empty()) throw std::runtime_error("ERROR::TEXTURE_COOKER::UNKNOWN_BLOCK_FORMAT: " + bc);
+        cook.srgb = settings.srgb;
+
+        auto start = std::chrono::steady_clock::now();
+        const std::vector<Image> levels = GenerateMips(source, settings);
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        start = std::chrono::steady_clock::now();
+        CookTexture(levels, output, cook);
+        const double cookMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        if (!quiet) {
+            const CookedTexture cooked(output);
+            std::cout << input << " -> " << output << ": " << std::fixed << std::setprecision(2)
+                      << static_cast<double>(cooked.FileSize()) / (1024.0 * 1024.0) << " MB\n"
+                      << "  " << cooked.Width() << "x" << cooked.Height() << ", " << cooked.Channels() << " channels, "
+                      << cooked.Levels() << " levels (" << ToString(DetectSimdLevel()) << ")\n"
+                      << "  mips in " << ms << " ms, "
+                      << static_cast<double>(source.width) * source.height / 1.0e6 / (ms / 1000.0) << " MP/s" << std::endl;
+
+            if (const std::optional<BlockFormat> format = cooked.Compression()) {
+                std::size_t raw = 0, compressed = 0, pixels = 0;
+                for (int level = 0; level < cooked.Levels(); ++level) {
+                    raw += levels[level].pixels.size();
+                    compressed += cooked.Level(level).size();
+                    pixels += static_cast<std::size_t>(levels[level].width) * levels[level].height;
+                }
+                // BC1 drops alpha; grey + alpha expanded to RGBA only lines up on the grey channel
+                int channels = *format == BlockFormat::BC1 ? 3 : 0;
+                if (source.channels == 2 && BlockChannels(*format) == 4) channels = 1;
+                const std::span<const std::byte> top = cooked.Level(0);
+                const Image decoded = DecompressImage({reinterpret_cast<const std::uint8_t*>(top.data()), top.size()}, *format,
+                                                      cooked.Width(), cooked.Height());
+                std::cout << "  " << ToString(*format) << " in " << cookMs << " ms, "
+                          << static_cast<double>(pixels) / 1.0e6 / (cookMs / 1000.0) << " MP/s, PSNR "
+                          << Psnr(levels[0], decoded, channels) << " dB, " << static_cast<double>(raw) / (1024.0 * 1024.0)
+                          << " -> " << static_cast<double>(compressed) / (1024.0 * 1024.0) << " MB ("
+                          << static_cast<double>(raw) / static_cast<double>(compressed) << ":1)" << std::endl;
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -2,42 +2,38 @@
 // Created by niek on 11/6/2025.
 //
 
-#include <iostream>
-#include <GLcore/App.h>
+#include <memory>
+#include <GLCore/App.h>
 #include <GLCore/Shader.h>
+#include <GLCore/VertexArray.h>
 using namespace GLCore;
 
+struct ColoredVertex {
+    glm::vec3 position;
+    glm::vec3 color;
+
+    // stride and offsets are derived from this list at compile time
+    using Layout = VertexLayout<Attrib<glm::vec3>, Attrib<glm::vec3>>;
+};
+
 class ShaderApp final : public App {
 public:
     using App::App;
 
 protected:
     void OnInit() override {
-        // Generate buffers
-        glGenVertexArrays(1, &VAO);
-        glGenBuffers(1, &VBO);
-        glBindVertexArray(VAO);
-        glBindBuffer(GL_ARRAY_BUFFER, VBO);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-        // position attribute
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), static_cast<void*>(nullptr));
-        glEnableVertexAttribArray(0);
-
-        // color attribute
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), reinterpret_cast<void*>(3 * sizeof(float)));
-        glEnableVertexAttribArray(1);
-
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-        glBindVertexArray(0);
+        // position attribute at location 0, color attribute at location 1
+        VBO = std::make_unique<VertexBuffer>(vertices, BufferUsage::Static, "Shaders VBO");
+        VAO = std::make_unique<VertexArray>("Shaders VAO");
+        VAO->SetVertexBuffer(0, *VBO);
 
         shader = new Shader("assets/vert.glsl", "assets/frag.glsl");
     }
 
     void OnShutdown() override {
         delete shader;
-        glDeleteBuffers(1, &VBO);
-        glDeleteVertexArrays(1, &VAO);
+        VAO.reset();
+        VBO.reset();
     }
 
     void OnUpdate() override { }
@@ -52,18 +48,19 @@ protected:
         The output of the fragment color is equal to the coordinate of the triangle.
         The bottom left is (-0.5f, -0.5f, 0.0f). Since the xy components are negative, they are clamped to 0.0f.
         */
-        glBindVertexArray(VAO);
+        VAO->Bind();
         glDrawArrays(GL_TRIANGLES, 0, 3);
     }
 
 private:
-    float vertices[18] = {
-        // positions        // colors
-        0.5f, -0.5f, 0.0f,  1.0f, 0.0f, 0.0f,   // bottom right
-       -0.5f, -0.5f, 0.0f,  0.0f, 1.0f, 0.0f,   // bottom left
-        0.0f,  0.5f, 0.0f,  0.0f, 0.0f, 1.0f    // top
+    ColoredVertex vertices[3] = {
+        // positions                  // colors
+        {{ 0.5f, -0.5f, 0.0f},  {1.0f, 0.0f, 0.0f}},   // bottom right
+        {{-0.5f, -0.5f, 0.0f},  {0.0f, 1.0f, 0.0f}},   // bottom left
+        {{ 0.0f,  0.5f, 0.0f},  {0.0f, 0.0f, 1.0f}}    // top
     };
-    unsigned int VAO, VBO;
+    std::unique_ptr<VertexBuffer> VBO;
+    std::unique_ptr<VertexArray> VAO;
 
     Shader* shader;
 };
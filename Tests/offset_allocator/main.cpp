@@ -0,0 +1,79 @@
+//
+// Created by niek on 11/29/2025.
+//
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include <GLCore/OffsetAllocator.h>
+using namespace GLCore;
+
+namespace {
+    int failures = 0;
+
+    void Check(const bool condition, const std::string& what) {
+        if (condition) return;
+        std::cerr << "FAILED: " << what << std::endl;
+        ++failures;
+    }
+}
+
+/**
+ * OffsetAllocator checks:
+ * - allocating exactly the capacity of a fresh allocator, for every capacity below 5000
+ * - filling an allocator exactly with two allocations
+ * - random allocate / free without overlapping ranges, merging back into one range at the end
+ */
+int main() {
+    for (std::uint32_t capacity = 1; capacity < 5000; ++capacity) {
+        OffsetAllocator allocator(capacity);
+        const OffsetAllocator::Allocation allocation = allocator.Allocate(capacity);
+        Check(allocation.Valid() && allocation.offset == 0, "Allocate(" + std::to_string(capacity) + ") on a fresh allocator of that size");
+        Check(!allocator.Allocate(1).Valid(), "Allocate(1) on a full allocator of size " + std::to_string(capacity));
+    }
+
+    {
+        OffsetAllocator allocator(1000);
+        const OffsetAllocator::Allocation first = allocator.Allocate(600);
+        const OffsetAllocator::Allocation second = allocator.Allocate(400);
+        Check(first.Valid() && second.Valid(), "Allocate(600) then Allocate(400) with capacity 1000");
+        Check(allocator.GetStorageReport().totalFree == 0, "no free storage left after filling to capacity");
+        allocator.Free(first);
+        Check(allocator.Allocate(600).Valid(), "Allocate(600) into the freed range");
+    }
+
+    {
+        constexpr std::uint32_t kCapacity = 100000;
+        OffsetAllocator allocator(kCapacity);
+        std::vector<std::uint8_t> used(kCapacity, 0);
+        std::vector<std::pair<OffsetAllocator::Allocation, std::uint32_t>> live;
+        std::mt19937 random(7);
+        int overlaps = 0;
+        for (int i = 0; i < 100000; ++i) {
+            if (live.empty() || random() % 2) {
+                const std::uint32_t size = 1 + random() % 2000;
+                const OffsetAllocator::Allocation allocation = allocator.Allocate(size);
+                if (!allocation.Valid()) continue;
+                for (std::uint32_t j = 0; j < size; ++j) overlaps += used[allocation.offset + j]++ != 0;
+                live.emplace_back(allocation, size);
+            } else {
+                const std::size_t k = random() % live.size();
+                const auto [allocation, size] = live[k];
+                for (std::uint32_t j = 0; j < size; ++j) used[allocation.offset + j] = 0;
+                allocator.Free(allocation);
+                live[k] = live.back();
+                live.pop_back();
+            }
+        }
+        Check(overlaps == 0, "random allocations never overlap");
+        for (const auto& [allocation, size] : live) allocator.Free(allocation);
+        const OffsetAllocator::StorageReport report = allocator.GetStorageReport();
+        Check(report.totalFree == kCapacity && report.largestFree == kCapacity, "freeing everything merges back into one range");
+    }
+
+    if (failures == 0) std::cout << "OffsetAllocator: all checks passed" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
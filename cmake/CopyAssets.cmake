@@ -1,19 +1,40 @@
 # Reusable function to copy an assets directory next to a target's binary after build
 #
 # Usage:
-#   copy_assets(<TARGET_NAME> <ASSETS_DIR> [DESTINATION <dest_dir>])
+#   copy_assets(<TARGET_NAME> <ASSETS_DIR> [DESTINATION <dest_dir>] [OPTIMIZE_MESHES] [MESH_LODS <count>]
+#               [COOK_MESHES] [PACKED_VERTICES] [COOK_TEXTURES] [LINEAR_TEXTURES] [COMPRESS_TEXTURES]
+#               [PACK_ATLASES] [QOI_IMAGES])
 #
 # - <TARGET_NAME>: Name of an existing CMake target (executable or library).
 # - <ASSETS_DIR>: Source directory with assets to copy.
 # - DESTINATION: Optional destination directory. Defaults to "$<TARGET_FILE_DIR:<TARGET_NAME>>/assets".
+# - OPTIMIZE_MESHES: Run the GLCore MeshOptimizer tool over every copied .obj (vertex cache, overdraw and fetch order).
+#   Opt-in: the tool rewrites the .obj with positions, UVs, normals and groups only (no mtllib / usemtl, `o` becomes
+#   `g`), so only pass it for meshes that do not rely on their materials.
+# - MESH_LODS: Also append a LOD chain of up to <count> levels to every copied .obj (implies OPTIMIZE_MESHES).
+# - COOK_MESHES: Run the GLCore MeshCooker tool over every copied .obj / .gltf / .glb (after optimization), writing a
+#   <name>.gmesh next to it with GPU-ready vertex/index data, LODs and meshlets (see GLCore/CookedMesh.h).
+# - PACKED_VERTICES: Cook 16-byte PackedMeshVertex data instead of MeshVertex (implies COOK_MESHES).
+# - COOK_TEXTURES: Run the GLCore TextureCooker tool over every copied .png / .jpg / .jpeg / .tga / .bmp, writing a
+#   <name>.gtex next to it with an sRGB-correct CPU mip chain (see GLCore/MipGenerator.h, GLCore/CookedTexture.h).
+# - LINEAR_TEXTURES: Cook the textures as linear data (normal maps, masks) instead of sRGB color (implies COOK_TEXTURES).
+# - COMPRESS_TEXTURES: Block-compress the cooked levels (BC4 grey, BC5 grey + alpha, BC7 color; see
+#   GLCore/BlockCompression.h) for 4x less texture memory (implies COOK_TEXTURES).
+# - PACK_ATLASES: Run the GLCore AtlasPacker tool over every copied <name>.atlas directory, writing <name>.gatlas next
+#   to it: all images inside packed into power-of-two pages plus a sprite lookup table (see GLCore/Atlas.h). Images in
+#   .atlas directories are not cooked as separate textures.
+# - QOI_IMAGES: Run the GLCore QoiConverter tool over every copied .png / .jpg / .jpeg / .tga / .bmp, writing a lossless
+#   <name>.qoi next to it that LoadImageFile() and TextureLoader decode several times faster (see GLCore/Qoi.h).
+#   Images that differ only in their extension (foo.png, foo.jpg) would share a .qoi and are a configure error
+#   (also Foo.png vs foo.jpg on Windows and macOS, whose file systems ignore case).
 #
 # Notes:
 # - Adds a per-target custom dependency that runs on every build of the target, ensuring assets are copied whenever you build the application.
 # - For MSVC, sets VS_DEBUGGER_WORKING_DIRECTORY to the target's output directory for better F5 experience.
 #
 function(copy_assets TARGET_NAME ASSETS_DIR)
-    set(options)
-    set(oneValueArgs DESTINATION)
+    set(options OPTIMIZE_MESHES COOK_MESHES PACKED_VERTICES COOK_TEXTURES LINEAR_TEXTURES COMPRESS_TEXTURES PACK_ATLASES QOI_IMAGES)
+    set(oneValueArgs DESTINATION MESH_LODS)
     set(multiValueArgs)
     cmake_parse_arguments(CA "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
 
@@ -37,12 +58,111 @@ function(copy_assets TARGET_NAME ASSETS_DIR)
     file(GLOB_RECURSE _asset_files CONFIGURE_DEPENDS "${ASSETS_DIR}/*")
     set(_stamp "${CMAKE_CURRENT_BINARY_DIR}/copy_assets_${TARGET_NAME}.stamp")
 
+    # Optional post-copy processing of the copied files (the sources stay untouched)
+    set(_process_commands)
+    set(_process_depends)
+    if (CA_OPTIMIZE_MESHES OR CA_MESH_LODS)
+        if (NOT TARGET MeshOptimizer)
+            message(FATAL_ERROR "copy_assets: OPTIMIZE_MESHES requires the MeshOptimizer target (GLCore/tools)")
+        endif()
+        set(_mesh_args --quiet)
+        if (CA_MESH_LODS)
+            list(APPEND _mesh_args --lods ${CA_MESH_LODS})
+        endif()
+        file(GLOB_RECURSE _meshes RELATIVE "${ASSETS_DIR}" CONFIGURE_DEPENDS "${ASSETS_DIR}/*.obj")
+        foreach(_mesh ${_meshes})
+            list(APPEND _process_commands COMMAND $<TARGET_FILE:MeshOptimizer> "${_dest}/${_mesh}" ${_mesh_args})
+        endforeach()
+        list(APPEND _process_depends MeshOptimizer)
+    endif()
+    if (CA_COOK_MESHES OR CA_PACKED_VERTICES)
+        if (NOT TARGET MeshCooker)
+            message(FATAL_ERROR "copy_assets: COOK_MESHES requires the MeshCooker target (GLCore/tools)")
+        endif()
+        set(_cook_args --quiet)
+        if (CA_PACKED_VERTICES)
+            list(APPEND _cook_args --packed)
+        endif()
+        file(GLOB_RECURSE _sources RELATIVE "${ASSETS_DIR}" CONFIGURE_DEPENDS "${ASSETS_DIR}/*.obj" "${ASSETS_DIR}/*.gltf" "${ASSETS_DIR}/*.glb")
+        foreach(_source ${_sources})
+            list(APPEND _process_commands COMMAND $<TARGET_FILE:MeshCooker> "${_dest}/${_source}" ${_cook_args})
+        endforeach()
+        list(APPEND _process_depends MeshCooker)
+    endif()
+    if (CA_COOK_TEXTURES OR CA_LINEAR_TEXTURES OR CA_COMPRESS_TEXTURES)
+        if (NOT TARGET TextureCooker)
+            message(FATAL_ERROR "copy_assets: COOK_TEXTURES requires the TextureCooker target (GLCore/tools)")
+        endif()
+        set(_texture_args --quiet)
+        if (CA_LINEAR_TEXTURES)
+            list(APPEND _texture_args --linear)
+        endif()
+        if (CA_COMPRESS_TEXTURES)
+            list(APPEND _texture_args --bc auto)
+        endif()
+        file(GLOB_RECURSE _images RELATIVE "${ASSETS_DIR}" CONFIGURE_DEPENDS "${ASSETS_DIR}/*.png" "${ASSETS_DIR}/*.jpg"
+             "${ASSETS_DIR}/*.jpeg" "${ASSETS_DIR}/*.tga" "${ASSETS_DIR}/*.bmp")
+        if (CA_PACK_ATLASES)
+            list(FILTER _images EXCLUDE REGEX "\\.atlas/")
+        endif()
+        foreach(_image ${_images})
+            list(APPEND _process_commands COMMAND $<TARGET_FILE:TextureCooker> "${_dest}/${_image}" ${_texture_args})
+        endforeach()
+        list(APPEND _process_depends TextureCooker)
+    endif()
+    if (CA_PACK_ATLASES)
+        if (NOT TARGET AtlasPacker)
+            message(FATAL_ERROR "copy_assets: PACK_ATLASES requires the AtlasPacker target (GLCore/tools)")
+        endif()
+        file(GLOB_RECURSE _atlas_dirs RELATIVE "${ASSETS_DIR}" LIST_DIRECTORIES true CONFIGURE_DEPENDS "${ASSETS_DIR}/*.atlas")
+        foreach(_atlas ${_atlas_dirs})
+            if (IS_DIRECTORY "${ASSETS_DIR}/${_atlas}")
+                string(REGEX REPLACE "\\.atlas$" ".gatlas" _packed "${_atlas}")
+                list(APPEND _process_commands COMMAND $<TARGET_FILE:AtlasPacker> "${_dest}/${_atlas}" "${_dest}/${_packed}" --quiet)
+            endif()
+        endforeach()
+        list(APPEND _process_depends AtlasPacker)
+    endif()
+    if (CA_QOI_IMAGES)
+        if (NOT TARGET QoiConverter)
+            message(FATAL_ERROR "copy_assets: QOI_IMAGES requires the QoiConverter target (GLCore/tools)")
+        endif()
+        set(_qoi_args --quiet)
+        if (CA_LINEAR_TEXTURES)
+            list(APPEND _qoi_args --linear)
+        endif()
+        file(GLOB_RECURSE _qoi_images RELATIVE "${ASSETS_DIR}" CONFIGURE_DEPENDS "${ASSETS_DIR}/*.png" "${ASSETS_DIR}/*.jpg"
+             "${ASSETS_DIR}/*.jpeg" "${ASSETS_DIR}/*.tga" "${ASSETS_DIR}/*.bmp")
+        if (CA_PACK_ATLASES)
+            list(FILTER _qoi_images EXCLUDE REGEX "\\.atlas/")
+        endif()
+        set(_qoi_outputs)
+        foreach(_image ${_qoi_images})
+            string(REGEX REPLACE "\\.[^.]*$" ".qoi" _qoi "${_image}")
+            # foo.png and foo.jpg would both write foo.qoi, the second silently replacing the first;
+            # Foo.qoi and foo.qoi are only the same file on case-insensitive file systems (Windows, macOS)
+            set(_qoi_key "${_qoi}")
+            if (WIN32 OR APPLE)
+                string(TOLOWER "${_qoi_key}" _qoi_key)
+            endif()
+            list(FIND _qoi_outputs "${_qoi_key}" _qoi_index)
+            if (_qoi_index GREATER_EQUAL 0)
+                list(GET _qoi_images ${_qoi_index} _qoi_other)
+                message(FATAL_ERROR "copy_assets: QOI_IMAGES: '${_qoi_other}' and '${_image}' in '${ASSETS_DIR}' both convert to '${_qoi}'")
+            endif()
+            list(APPEND _qoi_outputs "${_qoi_key}")
+            list(APPEND _process_commands COMMAND $<TARGET_FILE:QoiConverter> "${_dest}/${_image}" "${_dest}/${_qoi}" ${_qoi_args})
+        endforeach()
+        list(APPEND _process_depends QoiConverter)
+    endif()
+
     add_custom_command(OUTPUT "${_stamp}"
         COMMAND ${CMAKE_COMMAND} -E remove_directory "${_dest}"
         COMMAND ${CMAKE_COMMAND} -E make_directory "${_dest}"
         COMMAND ${CMAKE_COMMAND} -E copy_directory "${ASSETS_DIR}" "${_dest}"
+        ${_process_commands}
         COMMAND ${CMAKE_COMMAND} -E touch "${_stamp}"
-        DEPENDS ${_asset_files}
+        DEPENDS ${_asset_files} ${_process_depends}
         COMMENT "Copying assets for ${TARGET_NAME}: '${ASSETS_DIR}' -> '${_dest}'"
         VERBATIM)
 